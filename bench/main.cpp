@@ -0,0 +1,561 @@
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLoggingCategory>
+#include <QRandomGenerator>
+#include <QSaveFile>
+#include <QThread>
+#include <QDateTime>
+#include <QDebug>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
+
+#include "data/TLEParser.h"
+#include "data/TLECatalog.h"
+#include "data/SGP4Propagator.h"
+#include "propagation/BatchPropagator.h"
+#include "propagation/SGP4Kernel.h"
+#include "orbit/OrbitPath.h"
+#include "analysis/ConjunctionScreener.h"
+#include "simulation/Sunlight.h"
+#include "simulation/Frames.h"
+
+/**
+ * @brief Mesures de performance sans interface (parsing, propagation, orbites, conjonctions)
+ *
+ * Usage : orbifrance_bench [--sizes 1000,10000,100000] [--repeats 3]
+ *                          [--filter sgp4] [--output resultats.json] [--verbose]
+ *
+ * Chaque mesure est exécutée sur des catalogues synthétiques déterministes
+ * (mêmes TLE d'une exécution à l'autre) et rapportée en JSON sur la sortie
+ * standard : ns/op, objets/s, allocations et pic de mémoire résidente.
+ * Le meilleur des essais est retenu pour le temps ; les allocations sont
+ * la moyenne par essai.
+ */
+
+// ============================================
+// COMPTAGE DES ALLOCATIONS
+// ============================================
+
+namespace {
+std::atomic<qint64> g_allocations(0);
+std::atomic<qint64> g_allocatedBytes(0);
+
+inline void countAllocation(size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_allocatedBytes.fetch_add(qint64(size), std::memory_order_relaxed);
+}
+} // namespace
+
+#if defined(__GLIBC__)
+// glibc : malloc remplacé dans l'exécutable, ce qui couvre aussi les
+// conteneurs Qt (QArrayData alloue par malloc) et operator new
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+void __libc_free(void* pointer);
+
+void* malloc(size_t size) noexcept
+{
+    countAllocation(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) noexcept
+{
+    countAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) noexcept
+{
+    countAllocation(size);
+    return __libc_realloc(pointer, size);
+}
+
+void free(void* pointer) noexcept
+{
+    __libc_free(pointer);
+}
+}
+const char* const ALLOCATION_COUNTER = "malloc";
+#else
+// Ailleurs : seules les allocations C++ (operator new) sont comptées
+#include <new>
+void* operator new(size_t size)
+{
+    countAllocation(size);
+    if (void* pointer = std::malloc(size ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+const char* const ALLOCATION_COUNTER = "operator_new";
+#endif
+
+namespace {
+
+// ============================================
+// CATALOGUE SYNTHÉTIQUE
+// ============================================
+
+const double UNITS_PER_KM = Frames::SCENE_UNITS_PER_KM;
+const double DEG_PER_REV = 360.0;
+const int PROPAGATION_STEPS = 16;          // Instants par satellite (sur une journée)
+const double PROPAGATION_SPAN_MINUTES = 1440.0;
+
+// Part d'objets en espace lointain (période >= 225 min), comme le catalogue public
+const double DEEP_SPACE_FRACTION = 0.1;
+
+// Conjonctions : objets surveillés répartis dans le catalogue, sur 6 heures
+const int CONJUNCTION_PRIMARIES = 20;
+const double CONJUNCTION_SPAN_DAYS = 0.25;
+
+int tleChecksum(const QByteArray& line)
+{
+    int sum = 0;
+    for (char c : line) {
+        if (c >= '0' && c <= '9') {
+            sum += c - '0';
+        } else if (c == '-') {
+            sum += 1;
+        }
+    }
+    return sum % 10;
+}
+
+/**
+ * @brief Catalogue 3LE de count objets, reproductible (graine fixe)
+ */
+QByteArray syntheticCatalog(int count)
+{
+    QRandomGenerator rng(20251104u + quint32(count));
+    QByteArray text;
+    text.reserve(count * 165);
+
+    char line[80];
+    for (int i = 0; i < count; ++i) {
+        const bool deepSpace = rng.generateDouble() < DEEP_SPACE_FRACTION;
+        const double meanMotion = deepSpace ? 1.0 + 5.0 * rng.generateDouble()
+                                            : 11.25 + 4.5 * rng.generateDouble();
+        const double eccentricity = deepSpace ? 0.6 * rng.generateDouble()
+                                              : 0.02 * rng.generateDouble();
+        const double inclination = 180.0 * rng.generateDouble();
+        const double raan = DEG_PER_REV * rng.generateDouble();
+        const double argOfPerigee = DEG_PER_REV * rng.generateDouble();
+        const double meanAnomaly = DEG_PER_REV * rng.generateDouble();
+        const double epochDay = 1.0 + 364.0 * rng.generateDouble();
+        const int norad = 10000 + i % 90000;
+
+        text += QByteArray("BENCH ") + QByteArray::number(i) + '\n';
+
+        std::snprintf(line, sizeof(line), "1 %05dU %-8s %02d%012.8f  .%08d  00000+0  %05d-4 0 %4d",
+                      norad, "25001A", 25, epochDay, int(rng.bounded(100000)),
+                      10000 + int(rng.bounded(89999)), i % 10000);
+        QByteArray line1(line);
+        text += line1 + QByteArray::number(tleChecksum(line1)) + '\n';
+
+        std::snprintf(line, sizeof(line), "2 %05d %8.4f %8.4f %07d %8.4f %8.4f %11.8f%5d",
+                      norad, inclination, raan, int(eccentricity * 1.0e7), argOfPerigee,
+                      meanAnomaly, meanMotion, i % 100000);
+        QByteArray line2(line);
+        text += line2 + QByteArray::number(tleChecksum(line2)) + '\n';
+    }
+
+    return text;
+}
+
+// ============================================
+// MESURE
+// ============================================
+
+volatile double g_sink = 0.0;   // Empêche l'élimination des calculs mesurés
+
+qint64 peakRssKb()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return qint64(counters.PeakWorkingSetSize / 1024);
+    }
+    return -1;
+#elif defined(Q_OS_UNIX)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#if defined(Q_OS_MACOS)
+    return qint64(usage.ru_maxrss / 1024);   // Octets sous macOS
+#else
+    return qint64(usage.ru_maxrss);          // Ko sous Linux
+#endif
+#else
+    return -1;
+#endif
+}
+
+struct BenchContext {
+    int repeats = 3;
+    QString filter;
+    QJsonArray results;
+};
+
+/**
+ * @brief Exécute run() repeats fois et ajoute le résultat au rapport
+ * @param objects Taille du catalogue
+ * @param operations Opérations élémentaires par essai (base de ns/op)
+ * @param setup Préparation avant chaque essai, hors mesure
+ * @return false si le scénario est exclu par --filter (run() non exécuté)
+ */
+template <typename Setup, typename Run>
+bool measure(BenchContext& context, const QString& name, int objects, qint64 operations,
+             Setup setup, Run run)
+{
+    if (!context.filter.isEmpty() && !name.contains(context.filter)) {
+        return false;
+    }
+
+    qint64 bestNs = std::numeric_limits<qint64>::max();
+    qint64 totalNs = 0;
+    qint64 allocations = 0;
+    qint64 allocatedBytes = 0;
+
+    for (int r = 0; r < context.repeats; ++r) {
+        setup();
+
+        const qint64 allocationsBefore = g_allocations.load();
+        const qint64 bytesBefore = g_allocatedBytes.load();
+        QElapsedTimer timer;
+        timer.start();
+
+        run();
+
+        const qint64 elapsed = timer.nsecsElapsed();
+        allocations += g_allocations.load() - allocationsBefore;
+        allocatedBytes += g_allocatedBytes.load() - bytesBefore;
+        bestNs = qMin(bestNs, elapsed);
+        totalNs += elapsed;
+    }
+
+    const double bestSeconds = bestNs / 1.0e9;
+    const double allocationsPerRun = double(allocations) / context.repeats;
+
+    QJsonObject result;
+    result["name"] = name;
+    result["objects"] = objects;
+    result["operations"] = operations;
+    result["ns_per_op"] = double(bestNs) / operations;
+    result["ops_per_s"] = operations / bestSeconds;
+    result["objects_per_s"] = objects / bestSeconds;
+    result["best_ms"] = bestNs / 1.0e6;
+    result["mean_ms"] = totalNs / 1.0e6 / context.repeats;
+    result["allocations"] = allocationsPerRun;
+    result["allocations_per_op"] = allocationsPerRun / operations;
+    result["allocated_bytes"] = double(allocatedBytes) / context.repeats;
+    result["peak_rss_kb"] = peakRssKb();
+    context.results.append(result);
+
+    qInfo().noquote() << QString("⏱️  %1 [%2] : %3 ns/op, %4 objets/s, %5 allocations/op")
+                             .arg(name, -36)
+                             .arg(objects)
+                             .arg(double(bestNs) / operations, 0, 'f', 1)
+                             .arg(objects / bestSeconds, 0, 'e', 3)
+                             .arg(allocationsPerRun / operations, 0, 'f', 2);
+    return true;
+}
+
+template <typename Run>
+bool measure(BenchContext& context, const QString& name, int objects, qint64 operations, Run run)
+{
+    return measure(context, name, objects, operations, []() {}, run);
+}
+
+// ============================================
+// SCÉNARIOS
+// ============================================
+
+void benchCatalog(BenchContext& context, int count)
+{
+    const QByteArray text = syntheticCatalog(count);
+    const QList<QByteArray> lines = text.split('\n');
+
+    // Lignes pré-découpées : seul le parsing est mesuré
+    QVector<QString> names, lines1, lines2;
+    for (int i = 0; i + 2 < lines.size(); i += 3) {
+        names.append(QString::fromLatin1(lines.at(i)));
+        lines1.append(QString::fromLatin1(lines.at(i + 1)));
+        lines2.append(QString::fromLatin1(lines.at(i + 2)));
+    }
+
+    // === Parsing ===
+    measure(context, "tle.parse_qstring", count, count, [&]() {
+        for (int i = 0; i < names.size(); ++i) {
+            const TLEData tle = TLEParser::parseTLE(names.at(i), lines1.at(i), lines2.at(i));
+            g_sink = g_sink + tle.meanMotion;
+        }
+    });
+
+    TLECatalog catalog;
+    catalog.setThreadCount(1);
+    measure(context, "tle.catalog_parse_serial", count, count, [&]() {
+        catalog.parse(text.constData(), text.size());
+        g_sink = g_sink + catalog.size();
+    });
+
+    catalog.setThreadCount(0);
+    const auto parseCatalog = [&]() {
+        catalog.parse(text.constData(), text.size());
+        g_sink = g_sink + catalog.size();
+    };
+    if (!measure(context, "tle.catalog_parse_parallel", count, count, parseCatalog)) {
+        // Les scénarios suivants partent du catalogue parsé, même filtrés
+        parseCatalog();
+    }
+
+    const QVector<ElementSet>& elements = catalog.elements();
+    const double startJulian = elements.isEmpty() ? 2460676.5 : elements.first().epochJulianDate();
+    const double stepMinutes = PROPAGATION_SPAN_MINUTES / PROPAGATION_STEPS;
+
+    // === SGP4 objet par objet ===
+    QVector<SGP4Propagator*> propagators;
+    const auto resetPropagators = [&]() {
+        qDeleteAll(propagators);
+        propagators.clear();
+        propagators.reserve(elements.size());
+    };
+    const auto createPropagators = [&]() {
+        for (const ElementSet& set : elements) {
+            SGP4Propagator* propagator = new SGP4Propagator;
+            propagator->initialize(TLEParser::fromElementSet(set));
+            propagators.append(propagator);
+        }
+    };
+    if (!measure(context, "sgp4.single_init", count, count, resetPropagators, createPropagators)) {
+        createPropagators();
+    }
+
+    measure(context, "sgp4.single_propagate", count, qint64(count) * PROPAGATION_STEPS, [&]() {
+        QVector3D position, velocity;
+        for (const SGP4Propagator* propagator : std::as_const(propagators)) {
+            for (int step = 0; step < PROPAGATION_STEPS; ++step) {
+                if (propagator->propagateMinutes(step * stepMinutes, position, velocity)) {
+                    g_sink = g_sink + position.x();
+                }
+            }
+        }
+    });
+    qDeleteAll(propagators);
+    propagators.clear();
+
+    // === SGP4 par lots ===
+    BatchPropagator batch;
+    const auto initializeBatch = [&]() {
+        batch.initialize(elements);
+    };
+    if (!measure(context, "sgp4.batch_init", count, count, initializeBatch)) {
+        initializeBatch();
+    }
+
+    QVector<float> positions(3 * batch.size());
+    QVector<float> velocities(3 * batch.size());
+    measure(context, "sgp4.batch_propagate", count, qint64(count) * PROPAGATION_STEPS, [&]() {
+        for (int step = 0; step < PROPAGATION_STEPS; ++step) {
+            batch.propagate(startJulian + step * stepMinutes / 1440.0,
+                            positions.data(), velocities.data());
+        }
+        g_sink = g_sink + positions.first();
+    });
+
+    QVector<float> series(3 * batch.size() * PROPAGATION_STEPS);
+    measure(context, "sgp4.batch_series", count, qint64(count) * PROPAGATION_STEPS, [&]() {
+        batch.propagateSeries(startJulian, stepMinutes * 60.0, PROPAGATION_STEPS, series.data());
+        g_sink = g_sink + series.last();
+    });
+
+    // === Orbites de démonstration (une par objet du catalogue) ===
+    OrbitPath path;
+    path.setResolution(256);
+    for (OrbitPath::SamplingMode mode : { OrbitPath::UniformSampling, OrbitPath::AdaptiveSampling }) {
+        path.setSamplingMode(mode);
+        const QString name = (mode == OrbitPath::UniformSampling)
+                                 ? QStringLiteral("orbit_path.generate_uniform")
+                                 : QStringLiteral("orbit_path.generate_adaptive");
+        measure(context, name, count, count, [&]() {
+            for (const ElementSet& set : elements) {
+                path.setSemiMajorAxis(set.semiMajorAxis * UNITS_PER_KM);
+                path.setEccentricity(set.eccentricity);
+                path.setInclination(set.inclination);
+                g_sink = g_sink + path.generateOrbitPoints().size();
+            }
+        });
+    }
+
+    // === Conversions de coordonnées et de temps ===
+    batch.propagate(startJulian, positions.data());
+    measure(context, "coordinates.eci_to_display", count, count, [&]() {
+        for (int i = 0; i < batch.size(); ++i) {
+            const QVector3D eci(positions[3 * i], positions[3 * i + 1], positions[3 * i + 2]);
+            g_sink = g_sink + SGP4Propagator::eciToDisplay(eci).x();
+        }
+    });
+
+    // Transformations par lots en place : copie des positions TEME avant
+    // chaque essai, hors mesure (positions sert encore)
+    QVector<float> transformed(positions.size());
+    const auto copyPositions = [&]() {
+        std::copy(positions.cbegin(), positions.cend(), transformed.begin());
+    };
+    measure(context, "coordinates.teme_to_ecef_batch", count, count, copyPositions, [&]() {
+        Frames::temeToEcef(transformed.data(), batch.size(), startJulian);
+        g_sink = g_sink + transformed.last();
+    });
+
+    measure(context, "coordinates.teme_to_geodetic_batch", count, count, copyPositions, [&]() {
+        Frames::temeToGeodetic(transformed.data(), batch.size(), startJulian);
+        g_sink = g_sink + transformed.last();
+    });
+
+    measure(context, "coordinates.teme_to_scene_batch", count, count, copyPositions, [&]() {
+        Frames::temeToScene(transformed.data(), batch.size());
+        g_sink = g_sink + transformed.last();
+    });
+
+    measure(context, "coordinates.epoch_to_datetime", count, count, [&]() {
+        for (const ElementSet& set : elements) {
+            g_sink = g_sink + TLEParser::epochToDateTime(set.epochYear % 100, set.epochDay).toMSecsSinceEpoch();
+        }
+    });
+
+    QVector<QDateTime> epochs;
+    epochs.reserve(elements.size());
+    for (const ElementSet& set : elements) {
+        epochs.append(TLEParser::epochToDateTime(set.epochYear % 100, set.epochDay));
+    }
+    measure(context, "coordinates.to_julian", count, count, [&]() {
+        for (const QDateTime& epoch : std::as_const(epochs)) {
+            g_sink = g_sink + SGP4Propagator::toJulian(epoch);
+        }
+    });
+
+    // === Éclairement du catalogue (Soleil une fois par lot, un passage sur les positions) ===
+    QVector<quint8> illumination(batch.size());
+    measure(context, "eclipse.classify_catalog", count, count, [&]() {
+        double sun[3];
+        Sunlight::sunPositionKm(startJulian, sun);
+        Sunlight::classify(positions.constData(), batch.size(), sun, illumination.data());
+        g_sink = g_sink + illumination.last();
+    });
+
+    // === Conjonctions (une opération = un objet à un instant, pas de 60 s) ===
+    QVector<int> primaries;
+    const int primaryStride = qMax(1, count / CONJUNCTION_PRIMARIES);
+    for (int i = 0; i < count && primaries.size() < CONJUNCTION_PRIMARIES; i += primaryStride) {
+        primaries.append(i);
+    }
+
+    ConjunctionScreener screener;
+    screener.setStepSeconds(60.0);
+    const qint64 screeningSteps = qint64(CONJUNCTION_SPAN_DAYS * 1440.0) + 1;
+    measure(context, "conjunction.screen_primaries", count, qint64(count) * screeningSteps, [&]() {
+        g_sink = g_sink + screener.screen(elements, primaries, startJulian, CONJUNCTION_SPAN_DAYS).size();
+    });
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("orbifrance_bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Mesures de performance OrbiFrance (sortie JSON)");
+    parser.addHelpOption();
+    QCommandLineOption sizesOption("sizes", "Tailles de catalogue, séparées par des virgules.",
+                                   "liste", "1000,10000,100000");
+    QCommandLineOption repeatsOption("repeats", "Essais par mesure (le meilleur est retenu).",
+                                     "n", "3");
+    QCommandLineOption filterOption("filter", "Ne mesure que les scénarios dont le nom contient ce texte.",
+                                    "texte");
+    QCommandLineOption outputOption("output", "Fichier JSON (sortie standard par défaut).",
+                                    "fichier");
+    QCommandLineOption verboseOption("verbose", "Conserve les messages qDebug des modules mesurés.");
+    parser.addOptions({ sizesOption, repeatsOption, filterOption, outputOption, verboseOption });
+    parser.process(app);
+
+    // Les modules journalisent à chaque initialisation : hors de la sortie par défaut
+    if (!parser.isSet(verboseOption)) {
+        QLoggingCategory::setFilterRules(QStringLiteral("default.debug=false"));
+    }
+
+    QVector<int> sizes;
+    for (const QString& size : parser.value(sizesOption).split(',', Qt::SkipEmptyParts)) {
+        bool ok = false;
+        const int count = size.trimmed().toInt(&ok);
+        if (!ok || count <= 0) {
+            qCritical() << "❌ Taille de catalogue invalide:" << size;
+            return 1;
+        }
+        sizes.append(count);
+    }
+
+    BenchContext context;
+    context.repeats = qMax(1, parser.value(repeatsOption).toInt());
+    context.filter = parser.value(filterOption);
+
+    QElapsedTimer total;
+    total.start();
+
+    for (int count : std::as_const(sizes)) {
+        qInfo() << "📊 Catalogue synthétique de" << count << "objets";
+        benchCatalog(context, count);
+    }
+
+    QJsonObject report;
+    report["benchmark"] = QStringLiteral("orbifrance_bench");
+    report["version"] = QStringLiteral(ORBIFRANCE_VERSION);
+    report["timestamp"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    report["qt_version"] = QString::fromLatin1(qVersion());
+    report["cpu_architecture"] = QSysInfo::currentCpuArchitecture();
+    report["threads"] = QThread::idealThreadCount();
+    report["sgp4_kernel"] = QString::fromLatin1(SGP4Kernel::implementationName(SGP4Kernel::implementation()));
+    report["allocation_counter"] = QString::fromLatin1(ALLOCATION_COUNTER);
+    report["repeats"] = context.repeats;
+    report["propagation_steps"] = PROPAGATION_STEPS;
+    report["total_ms"] = total.elapsed();
+    report["results"] = context.results;
+
+    const QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+
+    if (parser.isSet(outputOption)) {
+        QSaveFile file(parser.value(outputOption));
+        if (!file.open(QIODevice::WriteOnly) || file.write(json) != json.size() || !file.commit()) {
+            qCritical() << "❌ Écriture impossible:" << parser.value(outputOption);
+            return 1;
+        }
+        qInfo() << "✅ Résultats écrits dans" << parser.value(outputOption);
+    } else {
+        std::fwrite(json.constData(), 1, size_t(json.size()), stdout);
+    }
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 import QtQuick
 import QtQuick.Controls
 import QtQuick3D
+import OrbiFrance 1.0
 
 Window {
     visible: true
@@ -8,7 +9,9 @@ Window {
     height: 800
     title: "OrbiFrance 3D"
 
-    property double simTime: 0
+    // Le temps de simulation est porté par simulationClock (C++) : le
+    // catalogue, la trace de l'ISS et le satellite sont recalculés une fois
+    // par image et publiés ici par leurs propriétés
 
     // === PROPRIÉTÉS DE CONTRÔLE CAMÉRA ===
     property real cameraDistance: 1000
@@ -17,9 +20,18 @@ Window {
     property real cameraPanX: 0
     property real cameraPanY: 0
 
+    // Longitude du méridien de Greenwich dans la texture de la Terre (degrés)
+    property real earthTextureOffset: 0
+
     // === OPTIONS D'AFFICHAGE ORBITE ===
     property bool showOrbitLine: true
 
+    // Couleur du catalogue : éclairement (Soleil, pénombre, ombre) au lieu de l'altitude
+    property bool colorByIllumination: false
+
+    // Traces au sol, empreinte de l'ISS et fauchées des imageurs
+    property bool showGroundTracks: true
+
     // États de la souris
     property bool isDragging: false
     property bool isPanning: false
@@ -65,34 +77,20 @@ Window {
             source: "#Sphere"
             position: Qt.vector3d(0, 0, 0)  // Devant la Terre
             scale: Qt.vector3d(100, 100, 100)
+            // Pas de texture de remplacement : fond noir jusqu'au chargement
+            visible: textureLoader.sources["stars"] !== undefined
 
             materials: DefaultMaterial {
                 diffuseMap: Texture {
                     id: starsTexture
-                    source: "qrc:/res/textures/stars.jpg"
+                    source: textureLoader.sources["stars"] || ""
+                    mipFilter: Texture.Linear
                 }
                 lighting: DefaultMaterial.NoLighting
                 cullMode: Material.NoCulling
             }
         }
 
-        // Lumière principale (Soleil)
-        DirectionalLight {
-            id: sunLight
-            eulerRotation.x: -45
-            eulerRotation.y: 45
-            brightness: 1.5
-            castsShadow: false  // Désactivé pour éviter les artefacts
-        }
-
-        // Lumière ambiante faible pour éviter que la face cachée soit totalement noire
-        DirectionalLight {
-            eulerRotation.x: 135
-            eulerRotation.y: -135
-            brightness: 0.15
-            color: "#1a3a52"  // Teinte bleutée subtile
-        }
-
         // ========================================
         // TERRE - Sphère principale
         // ========================================
@@ -102,9 +100,10 @@ Window {
             scale: Qt.vector3d(3, 3, 3)
 
             materials: PrincipledMaterial {
+                // KTX prémipmappé (TextureLoader), petite image du qrc en attendant
                 baseColorMap: Texture {
-                    source: "qrc:/res/textures/earth-day.jpg"
-                    generateMipmaps: true
+                    source: textureLoader.sources["earth-day"] || "qrc:/res/textures/earth-day2.jpg"
+                    generateMipmaps: textureLoader.sources["earth-day"] === undefined
                     mipFilter: Texture.Linear
                 }
                 // Propriétés pour un aspect plus réaliste
@@ -112,107 +111,219 @@ Window {
                 roughness: 0.9
             }
 
-            NumberAnimation on eulerRotation.y {
-                from: 0
-                to: 360
-                duration: 30000
-                loops: Animation.Infinite
-            }
+            // Rotation terrestre : temps sidéral de Greenwich de l'horloge de simulation
+            // (axe des pôles = y de la scène, voir temeFrame)
+            eulerRotation.y: simulationClock.gmstDegrees + earthTextureOffset
         }
 
         // ========================================
-        // NUAGES - Sphère atmosphérique
+        // TRAJECTOIRE ORBITALE - LIGNE (UN SEUL MODEL)
         // ========================================
         Model {
-            id: clouds
-            source: "#Sphere"
-            // Légèrement plus grande pour éviter le z-fighting
-            scale: Qt.vector3d(3.06, 3.06, 3.06)
-
-            materials: PrincipledMaterial {
-                baseColorMap: Texture {
-                    source: "qrc:/res/textures/earth-clouds.jpg"
-                    generateMipmaps: true
-                    mipFilter: Texture.Linear
-                }
-                // Configuration de transparence
-                alphaMode: PrincipledMaterial.Blend
-                opacity: 0.6
-
-                // Pas d'éclairage direct pour effet translucide
-                lighting: PrincipledMaterial.NoLighting
-
-                // Légère émission pour les nuages éclairés
-                emissiveFactor: Qt.vector3d(0.4, 0.4, 0.4)
+            id: orbitLine
+            visible: showOrbitLine
 
-                // Propriétés physiques
-                metalness: 0.0
-                roughness: 1.0
+            // L'orbite n'est rééchantillonnée que si l'erreur écran dépasse le budget
+            Binding { target: orbitPath; property: "cameraDistance"; value: cameraDistance }
+            Binding { target: orbitPath; property: "fieldOfView"; value: camera.fieldOfView }
+            Binding { target: orbitPath; property: "viewportHeight"; value: view3d.height }
 
-                // Culling désactivé pour voir les deux faces
-                cullMode: Material.NoCulling
+            geometry: OrbitGeometry {
+                id: orbitGeometry
+                path: orbitPath
             }
 
-            // Rotation légèrement plus lente pour effet de dérive
-            // (les nuages ne suivent pas exactement la rotation terrestre)
-            NumberAnimation on eulerRotation.y {
-                from: 0
-                to: 360
-                duration: 32000  // 2s de plus que la Terre
-                loops: Animation.Infinite
+            materials: DefaultMaterial {
+                lighting: DefaultMaterial.NoLighting
+                diffuseColor: "#e6e6e6"
             }
         }
 
         // ========================================
-        // TRAJECTOIRE ORBITALE - LIGNE SIMULÉE
+        // REPÈRE TEME (positions SGP4) : pôle nord (z) vers le haut de la scène (y)
         // ========================================
         Node {
-            id: orbitContainer
-            visible: showOrbitLine
-
-            property var orbitPoints: []
+            id: temeFrame
+            eulerRotation.x: -90
 
-            Component {
-                id: orbitPointComponent
+            // ========================================
+            // SOLEIL - éphéméride de l'horloge (terminateur jour/nuit)
+            // ========================================
+            Node {
+                // +z local vers le Soleil : les lumières suivent -z
+                rotation: simulationClock.sunRotation
+
+                // Lumière principale (Soleil)
+                DirectionalLight {
+                    id: sunLight
+                    brightness: 1.5
+                    castsShadow: false  // Désactivé pour éviter les artefacts
+                }
 
-                Model {
-                    source: "#Sphere"
-                    scale: Qt.vector3d(0.015, 0.015, 0.015)  // Très petites sphères
+                // Lumière ambiante faible depuis l'anti-Soleil : la face de nuit n'est pas totalement noire
+                DirectionalLight {
+                    eulerRotation.y: 180
+                    brightness: 0.15
+                    color: "#1a3a52"  // Teinte bleutée subtile
+                }
+            }
 
-                    materials: PrincipledMaterial {
-                        lighting: PrincipledMaterial.NoLighting
-                        emissiveFactor: Qt.vector3d(1.5, 1.5, 1.5)
-                    }
+            // ========================================
+            // ISS - TRACE SGP4 GLISSANTE
+            // ========================================
+            Model {
+                id: issPastTrack
+                visible: !issTrack.culled
+                geometry: OrbitGeometry {
+                    track: issTrack
+                    segment: OrbitGeometry.PastSegment
+                }
+                materials: DefaultMaterial {
+                    lighting: DefaultMaterial.NoLighting
+                    diffuseColor: "#5a7a99"     // Passé : atténué
                 }
             }
 
-            Component.onCompleted: {
-                var points = orbitPath.generateOrbitPoints()
-                console.log("🛰️ Génération orbite:", points.length, "points")
+            Model {
+                id: issFutureTrack
+                visible: !issTrack.culled
+                geometry: OrbitGeometry {
+                    track: issTrack
+                    segment: OrbitGeometry.FutureSegment
+                }
+                materials: DefaultMaterial {
+                    lighting: DefaultMaterial.NoLighting
+                    diffuseColor: "#66ccff"     // Futur : vif
+                }
+            }
 
-                if (points.length < 2) {
-                    console.warn("Pas assez de points")
-                    return
+            Model {
+                id: issMarker
+                source: "#Sphere"
+                visible: !issTrack.culled
+                position: issTrack.currentPosition
+                scale: Qt.vector3d(0.03, 0.03, 0.03)
+                materials: DefaultMaterial {
+                    lighting: DefaultMaterial.NoLighting
+                    diffuseColor: "#66ccff"
                 }
+            }
 
-                console.log("📍 Premier point:", points[0].x, points[0].y, points[0].z)
-                orbitPoints = points
+            // ========================================
+            // REPÈRE TERRESTRE (ECEF) : tourné du temps sidéral, comme la Terre
+            // ========================================
+            Node {
+                id: earthFrame
+                eulerRotation.z: simulationClock.gmstDegrees
+                visible: showGroundTracks
 
-                // Créer une sphère pour chaque point
-                var createdCount = 0
-                for (var i = 0; i < points.length; i++) {
-                    var pt = points[i]
+                // ISS : trace au sol et cercle de visibilité (0° d'élévation)
+                Model {
+                    id: issGroundLine
+                    geometry: GroundTrackGeometry {
+                        track: issGroundTrack
+                        part: GroundTrackGeometry.TrackLine
+                    }
+                    materials: DefaultMaterial {
+                        lighting: DefaultMaterial.NoLighting
+                        diffuseColor: "#66ccff"
+                    }
+                }
 
-                    var sphere = orbitPointComponent.createObject(orbitContainer, {
-                        "position": Qt.vector3d(pt.x, pt.y, pt.z)
-                    })
+                Model {
+                    id: issFootprint
+                    geometry: GroundTrackGeometry {
+                        track: issGroundTrack
+                        part: GroundTrackGeometry.Footprint
+                    }
+                    materials: DefaultMaterial {
+                        lighting: DefaultMaterial.NoLighting
+                        diffuseColor: "#3399cc"
+                    }
+                }
 
-                    if (sphere !== null) {
-                        createdCount++
+                // Imageurs français : trace et fauchée du capteur
+                Repeater3D {
+                    model: imagerTracks
+
+                    delegate: Node {
+                        Model {
+                            geometry: GroundTrackGeometry {
+                                track: modelData
+                                part: GroundTrackGeometry.TrackLine
+                            }
+                            materials: DefaultMaterial {
+                                lighting: DefaultMaterial.NoLighting
+                                diffuseColor: "#ffcc33"
+                            }
+                        }
+
+                        Model {
+                            geometry: GroundTrackGeometry {
+                                track: modelData
+                                part: GroundTrackGeometry.SwathArea
+                            }
+                            materials: DefaultMaterial {
+                                lighting: DefaultMaterial.NoLighting
+                                diffuseColor: "#ffcc33"
+                                opacity: 0.35
+                                cullMode: Material.NoCulling
+                            }
+                        }
                     }
                 }
+            }
+
+            // ========================================
+            // CATALOGUE - CULLING PUIS UNE INSTANCE PAR SATELLITE VISIBLE
+            // ========================================
+            // Caméra transmise au culler (dans le repère TEME) : frustum, occultation, LOD
+            Binding { target: satelliteCuller; property: "cameraPosition"; value: temeFrame.mapPositionFromScene(camera.scenePosition) }
+            Binding { target: satelliteCuller; property: "cameraForward"; value: temeFrame.mapDirectionFromScene(camera.forward) }
+            Binding { target: satelliteCuller; property: "cameraUp"; value: temeFrame.mapDirectionFromScene(camera.up) }
+            Binding { target: satelliteCuller; property: "fieldOfView"; value: camera.fieldOfView }
+            Binding { target: satelliteCuller; property: "aspectRatio"; value: view3d.width / Math.max(1, view3d.height) }
+            Binding { target: satelliteCuller; property: "viewportHeight"; value: view3d.height }
+            Binding { target: satelliteCuller; property: "clipNear"; value: camera.clipNear }
+            Binding { target: satelliteCuller; property: "clipFar"; value: camera.clipFar }
+
+            // Proches : modèle complet
+            Model {
+                id: catalogSatellites
+                source: "#Cube"
+
+                instancing: SatelliteInstancing {
+                    id: satelliteInstancing
+                    culler: satelliteCuller
+                    lod: SatelliteCuller.Model
+                    colorMode: colorByIllumination ? SatelliteInstancing.ColorByIllumination
+                                                   : SatelliteInstancing.ColorByAltitude
+                }
 
-                console.log("✅ Orbite créée:", createdCount, "points sur", points.length)
+                materials: DefaultMaterial {
+                    lighting: DefaultMaterial.NoLighting
+                    diffuseColor: "white"
+                }
+            }
+
+            // Lointains : billboard face à la caméra, taille constante à l'écran
+            Model {
+                id: catalogBillboards
+                source: "#Rectangle"
+
+                instancing: SatelliteInstancing {
+                    id: billboardInstancing
+                    culler: satelliteCuller
+                    lod: SatelliteCuller.Billboard
+                    colorMode: colorByIllumination ? SatelliteInstancing.ColorByIllumination
+                                                   : SatelliteInstancing.ColorByAltitude
+                }
+
+                materials: DefaultMaterial {
+                    lighting: DefaultMaterial.NoLighting
+                    cullMode: Material.NoCulling
+                    diffuseColor: "white"
+                }
             }
         }
 
@@ -232,8 +343,7 @@ Window {
                 emissiveFactor: Qt.vector3d(0.2, 0.05, 0.05)
             }
 
-            property var pos: orbitCalculator.getSatellitePosition(simTime)
-            position: pos
+            position: orbitCalculator.satellitePosition
         }
     }
 
@@ -319,19 +429,22 @@ Window {
                     height: timeSlider.height
                 }
 
+                // Une semaine de part et d'autre du lancement
                 Slider {
                     id: timeSlider
-                    width: parent.width - 180
-                    from: 0
-                    to: 100
-                    value: 0
-                    onValueChanged: simTime = value
+                    width: parent.width - 280
+                    from: -7 * 86400
+                    to: 7 * 86400
+                    value: simulationClock.simulationSeconds
+                    onMoved: simulationClock.simulationSeconds = value
                 }
 
                 Text {
-                    text: simTime.toFixed(1) + " s"
+                    // Date julienne -> date UTC (époque Unix : JD 2440587.5)
+                    text: new Date((simulationClock.julianDate - 2440587.5) * 86400000)
+                              .toISOString().substring(0, 19).replace("T", " ") + " UTC"
                     color: "white"
-                    width: 80
+                    width: 180
                     verticalAlignment: Text.AlignVCenter
                     height: timeSlider.height
                 }
@@ -341,6 +454,30 @@ Window {
             Row {
                 spacing: 10
 
+                Button {
+                    text: "⏮"
+                    onClicked: simulationClock.step(-simulationClock.timeScale)
+                }
+
+                Button {
+                    text: simulationClock.running ? "⏸ Pause" : "▶ Lecture"
+                    onClicked: simulationClock.running = !simulationClock.running
+                }
+
+                Button {
+                    text: "⏭"
+                    // Un pas = une seconde réelle au facteur d'accélération courant
+                    onClicked: simulationClock.step(simulationClock.timeScale)
+                }
+
+                ComboBox {
+                    id: timeScaleBox
+                    width: 110
+                    model: [1, 10, 100, 1000, 10000, 100000]
+                    displayText: "× " + currentText
+                    onActivated: (index) => simulationClock.timeScale = model[index]
+                }
+
                 Button {
                     text: "📷 Réinitialiser Vue"
                     onClicked: {
@@ -357,6 +494,16 @@ Window {
                     onClicked: showOrbitLine = !showOrbitLine
                 }
 
+                Button {
+                    text: colorByIllumination ? "🌈 Couleur: altitude" : "🌗 Couleur: éclairement"
+                    onClicked: colorByIllumination = !colorByIllumination
+                }
+
+                Button {
+                    text: showGroundTracks ? "🗺️ Masquer traces au sol" : "🗺️ Afficher traces au sol"
+                    onClicked: showGroundTracks = !showGroundTracks
+                }
+
                 Text {
                     text: "Distance: " + cameraDistance.toFixed(0)
                     color: "#888888"
@@ -370,6 +517,7 @@ Window {
 
     // Aide des contrôles
     Rectangle {
+        id: helpPanel
         anchors {
             top: parent.top
             right: parent.right
@@ -406,6 +554,88 @@ Window {
                 color: "white"
                 font.pixelSize: 12
             }
+            Text {
+                text: "⏱️ F3 : Profilage"
+                color: "white"
+                font.pixelSize: 12
+            }
+        }
+    }
+
+    Shortcut {
+        sequence: "F3"
+        onActivated: profiler.enabled = !profiler.enabled
+    }
+
+    // Profilage (sous l'aide, visible avec F3)
+    Rectangle {
+        anchors {
+            top: helpPanel.bottom
+            right: parent.right
+            margins: 10
+        }
+        visible: profiler.enabled
+        width: 240
+        height: profilerColumn.height + 20
+        color: "#cc000000"
+        radius: 5
+
+        Column {
+            id: profilerColumn
+            anchors.centerIn: parent
+            spacing: 3
+
+            Text {
+                text: "⏱️ PROFILAGE"
+                color: "#ffcc33"
+                font.bold: true
+                font.pixelSize: 12
+            }
+            Text {
+                text: "Image: " + profiler.frameTimeMs.toFixed(2) + " ms (max "
+                      + profiler.frameTimeMaxMs.toFixed(1) + "), "
+                      + profiler.framesPerSecond.toFixed(0) + " i/s"
+                color: "white"
+                font.pixelSize: 10
+            }
+            Text {
+                text: "Propagation: " + profiler.propagationMs.toFixed(2) + " ms"
+                      + "  Culling: " + profiler.cullingMs.toFixed(2) + " ms"
+                color: "white"
+                font.pixelSize: 10
+            }
+            Text {
+                text: "Synchro: " + profiler.syncMs.toFixed(2) + " ms"
+                      + "  Rendu: " + profiler.renderMs.toFixed(2) + " ms"
+                color: "white"
+                font.pixelSize: 10
+            }
+            Text {
+                text: "Par image: " + profiler.propagatedObjectsPerFrame.toFixed(0) + " propagés, "
+                      + profiler.culledObjectsPerFrame.toFixed(0) + " écartés"
+                color: "white"
+                font.pixelSize: 10
+            }
+            Text {
+                text: "Allocations: " + profiler.allocationsPerFrame.toFixed(0) + " / image"
+                color: "white"
+                font.pixelSize: 10
+            }
+            Button {
+                id: traceButton
+                property string lastTrace: ""
+                text: "💾 Exporter la trace (" + profiler.recordedEvents + ")"
+                font.pixelSize: 10
+                onClicked: lastTrace = profiler.exportChromeTrace()
+            }
+            Text {
+                visible: traceButton.lastTrace !== ""
+                text: traceButton.lastTrace
+                color: "#888888"
+                font.pixelSize: 9
+                width: 220
+                elide: Text.ElideLeft
+            }
         }
     }
 
@@ -416,7 +646,7 @@ Window {
             left: parent.left
             margins: 10
         }
-        width: 200
+        width: 280
         height: debugColumn.height + 20
         color: "#cc000000"
         radius: 5
@@ -433,17 +663,57 @@ Window {
                 font.pixelSize: 12
             }
             Text {
-                text: "Position X: " + satellite.pos.x.toFixed(1)
+                text: "Position X: " + satellite.position.x.toFixed(1)
+                color: "white"
+                font.pixelSize: 10
+            }
+            Text {
+                text: "Position Y: " + satellite.position.y.toFixed(1)
+                color: "white"
+                font.pixelSize: 10
+            }
+            Text {
+                text: "Position Z: " + satellite.position.z.toFixed(1)
+                color: "white"
+                font.pixelSize: 10
+            }
+
+            Text {
+                text: "📡 CATALOGUE"
+                color: "#66ccff"
+                font.bold: true
+                font.pixelSize: 12
+            }
+            Text {
+                text: "Dessinés: " + satelliteCuller.drawnCount + " / " + satelliteCuller.totalCount
+                      + " (" + satelliteCuller.modelCount + " modèles, "
+                      + satelliteCuller.billboardCount + " points)"
+                color: "white"
+                font.pixelSize: 10
+            }
+            Text {
+                text: "Hors champ: " + satelliteCuller.frustumCulledCount
+                      + "  Cachés: " + satelliteCuller.occludedCount
+                      + "  Ignorés: " + satelliteCuller.skippedCount
+                color: "white"
+                font.pixelSize: 10
+            }
+            Text {
+                text: "Éclairés: " + satelliteCuller.sunlitCount
+                      + "  Pénombre: " + satelliteCuller.penumbraCount
+                      + "  Ombre: " + satelliteCuller.umbraCount
                 color: "white"
                 font.pixelSize: 10
             }
             Text {
-                text: "Position Y: " + satellite.pos.y.toFixed(1)
+                text: "Images clés: " + satelliteCuller.keyframeStep.toFixed(0) + " s, "
+                      + satelliteCuller.propagationCount + " propagations"
                 color: "white"
                 font.pixelSize: 10
             }
             Text {
-                text: "Position Z: " + satellite.pos.z.toFixed(1)
+                text: "🖼️ Textures: palier " + ["low", "medium", "high"][textureLoader.tier]
+                      + (textureLoader.pendingCount > 0 ? ", " + textureLoader.pendingCount + " en chargement" : "")
                 color: "white"
                 font.pixelSize: 10
             }
@@ -0,0 +1,137 @@
+#ifndef COARSESCAN_H
+#define COARSESCAN_H
+
+#include <QVector>
+#include <QThread>
+#include <QThreadPool>
+#include <cmath>
+#include "../data/SGP4Propagator.h"
+
+/**
+ * @brief Grille grossière par satellite et répartition entre threads
+ *
+ * Schéma commun aux prédictions d'événements (passages, éclipses) : chaque
+ * satellite est propagé sur une grille de pas période / 20 (10 min au plus),
+ * puis ses événements sont affinés à la demande (RootFinding). Une tâche du
+ * pool par satellite, chacune avec son propre SGP4Propagator.
+ */
+namespace CoarseScan {
+
+const double MINUTES_PER_DAY = 1440.0;
+
+// 20 échantillons par révolution encadrent chaque extremum de la fonction
+// suivie (un par survol ou par orbite), 10 min au plus pour les orbites
+// hautes dont la géométrie varie lentement
+const double SAMPLES_PER_REVOLUTION = 20.0;
+const double MAX_STEP_MINUTES = 10.0;
+
+/**
+ * @brief Positions TEME d'un satellite à la demande (minutes depuis le début de la fenêtre)
+ */
+class Track
+{
+public:
+    Track(const SGP4Propagator& propagator, double startJulian)
+        : m_propagator(propagator)
+        , m_startJulian(startJulian)
+        , m_offsetMinutes((startJulian - propagator.epochJulian()) * MINUTES_PER_DAY)
+        , m_propagations(0)
+    {
+    }
+
+    /**
+     * @return false si SGP4 échoue
+     */
+    bool temeAt(double minutes, double* teme)
+    {
+        ++m_propagations;
+        return m_propagator.computeState(m_offsetMinutes + minutes, teme) == SGP4Status::Ok;
+    }
+
+    double julian(double minutes) const { return m_startJulian + minutes / MINUTES_PER_DAY; }
+    qint64 propagations() const { return m_propagations; }
+
+private:
+    const SGP4Propagator& m_propagator;
+    double m_startJulian;
+    double m_offsetMinutes;
+    qint64 m_propagations;
+};
+
+/**
+ * @brief Instants de la grille grossière (minutes depuis le début, croissants, bornés à la fenêtre)
+ */
+inline QVector<double> gridTimes(const TLEData& tle, double durationMinutes)
+{
+    const double period = (tle.period > 0.0) ? tle.period : MINUTES_PER_DAY / qMax(tle.meanMotion, 1.0);
+    const double step = qMin(period / SAMPLES_PER_REVOLUTION, MAX_STEP_MINUTES);
+    const int intervals = qMax(1, int(std::ceil(durationMinutes / step)));
+
+    QVector<double> times(intervals + 1);
+    for (int k = 0; k <= intervals; ++k) {
+        times[k] = qMin(k * step, durationMinutes);
+    }
+    return times;
+}
+
+/**
+ * @brief Bilan cumulé de toutes les tâches
+ */
+struct Totals {
+    qint64 propagations = 0;        // Appels SGP4 (grossiers + affinage)
+    int failedSatellites = 0;       // TLE rejetés par SGP4
+};
+
+/**
+ * @brief Événements de tous les satellites, une tâche du pool par satellite
+ *
+ * TrackType dérive de Track (construit avec le propagateur et le début de
+ * la fenêtre). scan(track, satellite, tle, times, events) ajoute à events
+ * les événements du satellite trouvés à partir de la grille times.
+ *
+ * @param threadCount Nombre de threads de travail (0 = nombre de cœurs)
+ * @return Événements dans l'ordre des satellites (à trier par l'appelant)
+ */
+template <typename TrackType, typename Event, typename Scan>
+QVector<Event> scanSatellites(const QVector<TLEData>& satellites, double startJulian, double durationMinutes,
+                              int threadCount, Scan scan, Totals& totals)
+{
+    struct SatelliteResult {
+        QVector<Event> events;
+        qint64 propagations = 0;
+        bool failed = false;
+    };
+    QVector<SatelliteResult> results(satellites.size());
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threadCount > 0 ? threadCount : QThread::idealThreadCount());
+    for (int i = 0; i < satellites.size(); ++i) {
+        pool.start([&satellites, &results, &scan, i, startJulian, durationMinutes]() {
+            SatelliteResult& result = results[i];
+            SGP4Propagator propagator;
+            if (!propagator.initialize(satellites[i])) {
+                result.failed = true;
+                return;
+            }
+
+            TrackType track(propagator, startJulian);
+            scan(track, i, satellites[i], gridTimes(satellites[i], durationMinutes), result.events);
+            result.propagations = track.propagations();
+        });
+    }
+    pool.waitForDone();
+
+    // === FUSION ===
+    QVector<Event> events;
+    for (const SatelliteResult& result : std::as_const(results)) {
+        events += result.events;
+        totals.propagations += result.propagations;
+        if (result.failed) {
+            ++totals.failedSatellites;
+        }
+    }
+    return events;
+}
+}
+
+#endif // COARSESCAN_H
@@ -0,0 +1,697 @@
+#include "ConjunctionScreener.h"
+#include "../propagation/BatchPropagator.h"
+#include "../data/SGP4Propagator.h"
+#include <QElapsedTimer>
+#include <QThread>
+#include <QThreadPool>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+
+const double SECONDS_PER_DAY = 86400.0;
+
+const double DEFAULT_THRESHOLD_KM = 5.0;
+
+// Pas automatique : les objets surveillés ne coûtent que la propagation du
+// catalogue (pas long) ; toutes les paires coûtent surtout les requêtes de
+// grille, dont le voisinage croît avec le pas (pas court)
+const double PRIMARIES_STEP_SECONDS = 60.0;
+const double ALL_PAIRS_STEP_SECONDS = 30.0;
+const double MIN_STEP_SECONDS = 1.0;
+const double MAX_STEP_SECONDS = 300.0;
+
+// Bornes du mouvement relatif de deux objets en orbite : croisement frontal
+// LEO / HEO au périgée, et gravités opposées à basse altitude (2 g)
+const double MAX_RELATIVE_SPEED_KMS = 20.0;
+const double MAX_RELATIVE_ACCEL_KMS2 = 0.02;
+
+// Écart toléré entre les rayons osculateurs SGP4 et la coquille moyenne
+// a(1 ± e) : termes courte période J2 et décroissance sur la fenêtre
+const double SHELL_MARGIN_KM = 50.0;
+
+// Pas de temps par tâche : deux propagations de bord par tranche
+const int STEPS_PER_TASK = 128;
+
+// Affinage : échantillonnage du demi-pas puis section dorée
+const int REFINE_SAMPLES = 8;
+const int GOLDEN_ITERATIONS = 40;
+const double GOLDEN_RATIO = 0.6180339887498949;
+
+namespace {
+
+/**
+ * @brief État du catalogue à un pas de temps
+ */
+struct Snapshot {
+    QVector<double> positions;
+    QVector<double> velocities;
+    QVector<quint8> status;
+    int step = -1;              // -1 : hors de la fenêtre
+
+    bool valid(int i) const { return step >= 0 && status[i] == SGP4Status::Ok; }
+};
+
+/**
+ * @brief Grille uniforme hachée (table de puissance de 2, tri par comptage)
+ *
+ * Cellules de deux fois le rayon de recherche : la sphère autour d'un objet
+ * ne touche que 8 cellules (sa cellule et les voisines du côté le plus
+ * proche sur chaque axe), au lieu de 27. Chaque entrée recopie la cellule
+ * et la position de l'objet : une requête lit ses seaux d'un bloc, sans
+ * doublon ni faux voisin quand deux cellules tombent dans le même seau.
+ */
+class SpatialGrid
+{
+public:
+    void build(const Snapshot& snapshot, int count, double radius)
+    {
+        m_inverseCell = 1.0 / (2.0 * radius);
+        m_radiusSquared = radius * radius;
+
+        int tableSize = 64;
+        while (tableSize < 2 * count) {
+            tableSize *= 2;
+        }
+        m_mask = quint32(tableSize - 1);
+
+        m_cellStart.fill(0, tableSize + 1);
+        m_bucketOf.resize(count);
+        m_entries.resize(count);
+
+        const double* p = snapshot.positions.constData();
+        for (int i = 0; i < count; ++i) {
+            if (!snapshot.valid(i) || !std::isfinite(p[3 * i] + p[3 * i + 1] + p[3 * i + 2])) {
+                m_bucketOf[i] = INVALID;
+                continue;
+            }
+            m_bucketOf[i] = bucket(cell(p[3 * i]), cell(p[3 * i + 1]), cell(p[3 * i + 2]));
+            ++m_cellStart[m_bucketOf[i] + 1];
+        }
+
+        for (int k = 0; k < tableSize; ++k) {
+            m_cellStart[k + 1] += m_cellStart[k];
+        }
+
+        m_cursor = m_cellStart;
+        for (int i = 0; i < count; ++i) {
+            if (m_bucketOf[i] == INVALID) {
+                continue;
+            }
+            const double* position = p + 3 * i;
+            m_entries[m_cursor[m_bucketOf[i]]++] = {
+                i, cell(position[0]), cell(position[1]), cell(position[2]),
+                position[0], position[1], position[2]
+            };
+        }
+    }
+
+    /**
+     * @brief Objet présent dans la grille (propagé sans échec, position finie)
+     */
+    bool contains(int i) const { return m_bucketOf[i] != INVALID; }
+
+    /**
+     * @brief Objets de la grille, dans l'ordre des seaux : des requêtes
+     * successives dans cet ordre relisent les mêmes cellules (cache)
+     */
+    int size() const { return m_cellStart.last(); }
+    int objectAt(int n) const { return m_entries[n].object; }
+
+    /**
+     * @brief Appelle visit(j) pour chaque objet à moins du rayon de recherche de position
+     */
+    template <typename Visit>
+    void forEachNeighbor(const double position[3], Visit visit) const
+    {
+        int first[3];
+        int second[3];
+        for (int a = 0; a < 3; ++a) {
+            const double scaled = position[a] * m_inverseCell;
+            first[a] = int(std::floor(scaled));
+            second[a] = (scaled - first[a] < 0.5) ? first[a] - 1 : first[a] + 1;
+        }
+
+        for (int x : { first[0], second[0] }) {
+            for (int y : { first[1], second[1] }) {
+                for (int z : { first[2], second[2] }) {
+                    const quint32 b = bucket(x, y, z);
+                    for (int n = m_cellStart[b]; n < m_cellStart[b + 1]; ++n) {
+                        const Entry& entry = m_entries[n];
+                        if (entry.x != x || entry.y != y || entry.z != z) {
+                            continue;
+                        }
+                        const double dx = entry.px - position[0];
+                        const double dy = entry.py - position[1];
+                        const double dz = entry.pz - position[2];
+                        if (dx * dx + dy * dy + dz * dz <= m_radiusSquared) {
+                            visit(entry.object);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr quint32 INVALID = 0xFFFFFFFFu;
+
+    struct Entry {
+        int object;
+        int x, y, z;            // Cellule
+        double px, py, pz;      // Position (km)
+    };
+
+    double m_inverseCell = 1.0;
+    double m_radiusSquared = 0.0;
+    quint32 m_mask = 0;
+    QVector<int> m_cellStart;       // Début de chaque seau dans m_entries
+    QVector<int> m_cursor;
+    QVector<quint32> m_bucketOf;    // Seau de chaque objet
+    QVector<Entry> m_entries;       // Objets triés par seau
+
+    int cell(double coordinate) const { return int(std::floor(coordinate * m_inverseCell)); }
+
+    quint32 bucket(int x, int y, int z) const
+    {
+        return ((quint32(x) * 73856093u) ^ (quint32(y) * 19349663u) ^ (quint32(z) * 83492791u)) & m_mask;
+    }
+};
+
+/**
+ * @brief Données partagées (lecture seule) par toutes les tâches
+ *
+ * batch est propre à chaque tâche (copie de travail, voir screen()).
+ */
+struct ScreeningContext {
+    const BatchPropagator* batch = nullptr;
+    int count = 0;
+    const double* perigee = nullptr;
+    const double* apogee = nullptr;
+    const bool* isPrimary = nullptr;
+    const QVector<int>* primaries = nullptr;    // Vide : toutes les paires
+
+    double startJulian = 0.0;
+    double stepSeconds = 0.0;
+    int stepCount = 0;
+
+    double thresholdKm = 0.0;
+    double searchRadiusKm = 0.0;    // Rayon de voisinage à l'échantillon
+    double linearLimitKm = 0.0;     // Seuil du test linéaire (écart de courbure compris)
+    double shellPadKm = 0.0;
+
+    std::atomic<bool>* cancelled = nullptr;
+    std::atomic<int>* completedSteps = nullptr;
+
+    double julianAt(int step) const { return startJulian + step * stepSeconds / SECONDS_PER_DAY; }
+};
+
+/**
+ * @brief Résultat d'une tranche de pas (indices du sous-catalogue propagé)
+ */
+struct TaskResult {
+    QVector<Conjunction> conjunctions;
+    qint64 candidatePairs = 0;
+    qint64 refinedPairs = 0;
+};
+
+void propagateStep(const ScreeningContext& context, Snapshot& snapshot, int step)
+{
+    if (step < 0 || step >= context.stepCount) {
+        snapshot.step = -1;
+        return;
+    }
+
+    snapshot.positions.resize(3 * context.count);
+    snapshot.velocities.resize(3 * context.count);
+    snapshot.status.resize(context.count);
+    context.batch->propagateRange(context.julianAt(step), 0, context.count,
+                                  snapshot.positions.data(), snapshot.velocities.data(),
+                                  snapshot.status.data());
+    snapshot.step = step;
+}
+
+/**
+ * @brief Mouvement relatif de deux objets autour d'un échantillon
+ *
+ * Deux segments d'Hermite cubique : [-h, 0] (pas précédent) et [0, h]
+ * (pas suivant), en secondes depuis l'échantillon central.
+ */
+struct RelativeMotion {
+    double h;
+    double p[3][3];     // Position relative aux pas k - 1, k, k + 1
+    double v[3][3];     // Vitesse relative
+
+    void load(const Snapshot* snapshots[3], int i, int j)
+    {
+        for (int s = 0; s < 3; ++s) {
+            // Pas hors fenêtre : jamais interpolé, mais multiplié par des
+            // poids nuls au bord (sans NaN)
+            if (snapshots[s]->step < 0) {
+                std::fill(p[s], p[s] + 3, 0.0);
+                std::fill(v[s], v[s] + 3, 0.0);
+                continue;
+            }
+            const double* pos = snapshots[s]->positions.constData();
+            const double* vel = snapshots[s]->velocities.constData();
+            for (int a = 0; a < 3; ++a) {
+                p[s][a] = pos[3 * j + a] - pos[3 * i + a];
+                v[s][a] = vel[3 * j + a] - vel[3 * i + a];
+            }
+        }
+    }
+
+    void evaluate(double tau, double position[3], double velocity[3]) const
+    {
+        const int first = (tau < 0.0) ? 0 : 1;
+        const double s = (tau < 0.0) ? (tau + h) / h : tau / h;
+        const double s2 = s * s;
+        const double s3 = s2 * s;
+
+        const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+        const double h10 = (s3 - 2.0 * s2 + s) * h;
+        const double h01 = -2.0 * s3 + 3.0 * s2;
+        const double h11 = (s3 - s2) * h;
+
+        // Dérivées par rapport au temps
+        const double d00 = (6.0 * s2 - 6.0 * s) / h;
+        const double d10 = 3.0 * s2 - 4.0 * s + 1.0;
+        const double d01 = (-6.0 * s2 + 6.0 * s) / h;
+        const double d11 = 3.0 * s2 - 2.0 * s;
+
+        const double* p0 = p[first];
+        const double* p1 = p[first + 1];
+        const double* v0 = v[first];
+        const double* v1 = v[first + 1];
+        for (int a = 0; a < 3; ++a) {
+            position[a] = h00 * p0[a] + h10 * v0[a] + h01 * p1[a] + h11 * v1[a];
+            velocity[a] = d00 * p0[a] + d10 * v0[a] + d01 * p1[a] + d11 * v1[a];
+        }
+    }
+
+    double distanceSquared(double tau) const
+    {
+        double position[3];
+        double velocity[3];
+        evaluate(tau, position, velocity);
+        return position[0] * position[0] + position[1] * position[1] + position[2] * position[2];
+    }
+
+    /**
+     * @brief Instant de plus courte distance sur [lo, hi]
+     */
+    double closestApproach(double lo, double hi) const
+    {
+        // Échantillonnage : isole le minimum (la distance peut ne pas être
+        // unimodale sur le pas entier pour des objets quasi co-orbitaux)
+        double best = lo;
+        double bestDistance = distanceSquared(lo);
+        const double spacing = (hi - lo) / REFINE_SAMPLES;
+        for (int n = 1; n <= REFINE_SAMPLES; ++n) {
+            const double tau = lo + n * spacing;
+            const double distance = distanceSquared(tau);
+            if (distance < bestDistance) {
+                bestDistance = distance;
+                best = tau;
+            }
+        }
+        if (spacing <= 0.0) {
+            return best;
+        }
+
+        // Section dorée sur les deux intervalles autour du meilleur échantillon
+        double a = qMax(lo, best - spacing);
+        double b = qMin(hi, best + spacing);
+        double c = b - GOLDEN_RATIO * (b - a);
+        double d = a + GOLDEN_RATIO * (b - a);
+        double fc = distanceSquared(c);
+        double fd = distanceSquared(d);
+        for (int n = 0; n < GOLDEN_ITERATIONS; ++n) {
+            if (fc < fd) {
+                b = d;
+                d = c;
+                fd = fc;
+                c = b - GOLDEN_RATIO * (b - a);
+                fc = distanceSquared(c);
+            } else {
+                a = c;
+                c = d;
+                fc = fd;
+                d = a + GOLDEN_RATIO * (b - a);
+                fd = distanceSquared(d);
+            }
+        }
+
+        const double tau = 0.5 * (a + b);
+        return (distanceSquared(tau) < bestDistance) ? tau : best;
+    }
+};
+
+/**
+ * @brief Traite les pas [firstStep, lastStep[ (propage aussi les deux pas de bord)
+ */
+void screenSteps(const ScreeningContext& context, int firstStep, int lastStep, TaskResult& result)
+{
+    Snapshot buffers[3];
+    Snapshot* previous = &buffers[0];
+    Snapshot* current = &buffers[1];
+    Snapshot* next = &buffers[2];
+
+    propagateStep(context, *previous, firstStep - 1);
+    propagateStep(context, *current, firstStep);
+
+    SpatialGrid grid;
+    RelativeMotion motion;
+    motion.h = context.stepSeconds;
+    const double halfStep = 0.5 * context.stepSeconds;
+
+    for (int step = firstStep; step < lastStep; ++step) {
+        if (context.cancelled->load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        propagateStep(context, *next, step + 1);
+        grid.build(*current, context.count, context.searchRadiusKm);
+
+        const Snapshot* snapshots[3] = { previous, current, next };
+        const double* pos = current->positions.constData();
+        const double* vel = current->velocities.constData();
+
+        // Paire voisine dans la grille (à moins du rayon de recherche)
+        const auto consider = [&](int i, int j) {
+            ++result.candidatePairs;
+
+            // Coquilles périgée/apogée disjointes
+            if (context.perigee[i] > context.apogee[j] + context.shellPadKm
+                || context.perigee[j] > context.apogee[i] + context.shellPadKm) {
+                return;
+            }
+
+            // Demi-pas de part et d'autre, réduit en bord de fenêtre ou d'échec SGP4
+            const double lo = (previous->valid(i) && previous->valid(j)) ? -halfStep : 0.0;
+            const double hi = (next->valid(i) && next->valid(j)) ? halfStep : 0.0;
+
+            // Mouvement linéaire : plus courte distance sur [lo, hi]
+            const double dr[3] = { pos[3 * j] - pos[3 * i], pos[3 * j + 1] - pos[3 * i + 1],
+                                   pos[3 * j + 2] - pos[3 * i + 2] };
+            const double dv[3] = { vel[3 * j] - vel[3 * i], vel[3 * j + 1] - vel[3 * i + 1],
+                                   vel[3 * j + 2] - vel[3 * i + 2] };
+            const double dv2 = dv[0] * dv[0] + dv[1] * dv[1] + dv[2] * dv[2];
+            double tau = (dv2 > 0.0) ? -(dr[0] * dv[0] + dr[1] * dv[1] + dr[2] * dv[2]) / dv2 : 0.0;
+            tau = qBound(lo, tau, hi);
+            const double lx = dr[0] + dv[0] * tau;
+            const double ly = dr[1] + dv[1] * tau;
+            const double lz = dr[2] + dv[2] * tau;
+            if (lx * lx + ly * ly + lz * lz > context.linearLimitKm * context.linearLimitKm) {
+                return;
+            }
+            ++result.refinedPairs;
+
+            // === Affinage (Hermite sur les états encadrants) ===
+            motion.load(snapshots, i, j);
+            const double tca = motion.closestApproach(lo, hi);
+            double position[3];
+            double velocity[3];
+            motion.evaluate(tca, position, velocity);
+
+            const double miss = std::sqrt(position[0] * position[0] + position[1] * position[1]
+                                          + position[2] * position[2]);
+            if (!(miss <= context.thresholdKm)) {
+                return;
+            }
+
+            Conjunction conjunction;
+            conjunction.primary = i;
+            conjunction.secondary = j;
+            conjunction.primaryNoradId = 0;
+            conjunction.secondaryNoradId = 0;
+            conjunction.tcaJulian = context.julianAt(step) + tca / SECONDS_PER_DAY;
+            conjunction.missDistanceKm = miss;
+            conjunction.relativeSpeedKmS = std::sqrt(velocity[0] * velocity[0] + velocity[1] * velocity[1]
+                                                     + velocity[2] * velocity[2]);
+            result.conjunctions.append(conjunction);
+        };
+
+        if (context.primaries->isEmpty()) {
+            // Toutes les paires, chacune une seule fois (i < j)
+            for (int n = 0; n < grid.size(); ++n) {
+                const int i = grid.objectAt(n);
+                grid.forEachNeighbor(pos + 3 * i, [&](int j) {
+                    if (j > i) {
+                        consider(i, j);
+                    }
+                });
+            }
+        } else {
+            // Objets surveillés contre le reste ; paire de deux surveillés vue une fois
+            for (int p : *context.primaries) {
+                if (!grid.contains(p)) {
+                    continue;
+                }
+                grid.forEachNeighbor(pos + 3 * p, [&](int j) {
+                    if (j != p && !(context.isPrimary[j] && j < p)) {
+                        consider(p, j);
+                    }
+                });
+            }
+        }
+
+        context.completedSteps->fetch_add(1, std::memory_order_relaxed);
+
+        Snapshot* recycled = previous;
+        previous = current;
+        current = next;
+        next = recycled;
+    }
+}
+
+} // namespace
+
+QDateTime Conjunction::tcaDateTime() const
+{
+    return SGP4Propagator::fromJulian(tcaJulian);
+}
+
+ConjunctionScreener::ConjunctionScreener()
+    : m_thresholdKm(DEFAULT_THRESHOLD_KM)
+    , m_stepSeconds(0.0)
+    , m_threadCount(0)
+    , m_cancelled(false)
+    , m_completedSteps(0)
+    , m_totalSteps(0)
+{
+}
+
+void ConjunctionScreener::setThresholdKm(double km)
+{
+    m_thresholdKm = qMax(0.001, km);
+}
+
+void ConjunctionScreener::setStepSeconds(double seconds)
+{
+    m_stepSeconds = (seconds > 0.0) ? qBound(MIN_STEP_SECONDS, seconds, MAX_STEP_SECONDS) : 0.0;
+}
+
+void ConjunctionScreener::setThreadCount(int threads)
+{
+    m_threadCount = qMax(0, threads);
+}
+
+double ConjunctionScreener::progress() const
+{
+    const int total = m_totalSteps.load(std::memory_order_relaxed);
+    return total > 0 ? double(m_completedSteps.load(std::memory_order_relaxed)) / total : 0.0;
+}
+
+QVector<Conjunction> ConjunctionScreener::screen(const QVector<ElementSet>& elements,
+                                                 const QVector<int>& primaries,
+                                                 double startJulian, double durationDays)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    m_completedSteps.store(0, std::memory_order_relaxed);
+    m_stats = ConjunctionScreeningStats();
+    m_stats.catalogSize = elements.size();
+
+    const double shellPad = m_thresholdKm + SHELL_MARGIN_KM;
+
+    QVector<bool> isPrimary(elements.size(), false);
+    QVector<int> validPrimaries;
+    for (int p : primaries) {
+        if (p >= 0 && p < elements.size() && !isPrimary[p]) {
+            isPrimary[p] = true;
+            validPrimaries.append(p);
+        }
+    }
+    if (!primaries.isEmpty() && validPrimaries.isEmpty()) {
+        qWarning() << "⚠️ Conjonctions: aucun objet surveillé valide";
+        m_totalSteps.store(0, std::memory_order_relaxed);
+        m_cancelled.store(false, std::memory_order_relaxed);
+        return QVector<Conjunction>();
+    }
+
+    // === FILTRE PÉRIGÉE/APOGÉE : objets à propager ===
+    QVector<ElementSet> subset;
+    QVector<int> catalogIndex;
+    QVector<double> perigee;
+    QVector<double> apogee;
+    QVector<bool> subsetPrimary;
+    QVector<int> subsetPrimaries;
+    subset.reserve(elements.size());
+
+    for (int i = 0; i < elements.size(); ++i) {
+        const ElementSet& set = elements[i];
+        const double q = set.semiMajorAxis * (1.0 - set.eccentricity);
+        const double Q = set.semiMajorAxis * (1.0 + set.eccentricity);
+
+        bool keep = validPrimaries.isEmpty() || isPrimary[i];
+        for (int n = 0; !keep && n < validPrimaries.size(); ++n) {
+            const ElementSet& primary = elements[validPrimaries[n]];
+            const double pq = primary.semiMajorAxis * (1.0 - primary.eccentricity);
+            const double pQ = primary.semiMajorAxis * (1.0 + primary.eccentricity);
+            keep = (q <= pQ + shellPad) && (pq <= Q + shellPad);
+        }
+        if (!keep) {
+            continue;
+        }
+
+        if (isPrimary[i]) {
+            subsetPrimaries.append(subset.size());
+        }
+        subset.append(set);
+        catalogIndex.append(i);
+        perigee.append(q);
+        apogee.append(Q);
+        subsetPrimary.append(isPrimary[i]);
+    }
+
+    BatchPropagator batch;
+    batch.initialize(subset);
+
+    // === GRILLE DE TEMPS ===
+    const double stepSeconds = (m_stepSeconds > 0.0) ? m_stepSeconds
+                             : validPrimaries.isEmpty() ? ALL_PAIRS_STEP_SECONDS : PRIMARIES_STEP_SECONDS;
+    const int stepCount = int(std::floor(qMax(0.0, durationDays) * SECONDS_PER_DAY / stepSeconds)) + 1;
+    const double halfStep = 0.5 * stepSeconds;
+    const double curvature = 0.5 * MAX_RELATIVE_ACCEL_KMS2 * halfStep * halfStep;
+
+    ScreeningContext context;
+    context.count = subset.size();
+    context.perigee = perigee.constData();
+    context.apogee = apogee.constData();
+    context.isPrimary = subsetPrimary.constData();
+    context.primaries = &subsetPrimaries;
+    context.startJulian = startJulian;
+    context.stepSeconds = stepSeconds;
+    context.stepCount = stepCount;
+    context.thresholdKm = m_thresholdKm;
+    context.searchRadiusKm = m_thresholdKm + MAX_RELATIVE_SPEED_KMS * halfStep + curvature;
+    context.linearLimitKm = m_thresholdKm + curvature;
+    context.shellPadKm = shellPad;
+    context.cancelled = &m_cancelled;
+    context.completedSteps = &m_completedSteps;
+
+    m_totalSteps.store(stepCount, std::memory_order_relaxed);
+
+    // === TRANCHES DE PAS EN PARALLÈLE ===
+    const int taskCount = (stepCount + STEPS_PER_TASK - 1) / STEPS_PER_TASK;
+    QVector<TaskResult> results(taskCount);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(m_threadCount > 0 ? m_threadCount : QThread::idealThreadCount());
+    for (int t = 0; t < taskCount; ++t) {
+        pool.start([&context, &batch, &results, t, stepCount]() {
+            // Copie de travail : objets libsgp4 non partagés entre tranches
+            BatchPropagator taskBatch;
+            taskBatch.initialize(batch);
+            ScreeningContext taskContext = context;
+            taskContext.batch = &taskBatch;
+
+            screenSteps(taskContext, t * STEPS_PER_TASK, qMin(stepCount, (t + 1) * STEPS_PER_TASK), results[t]);
+        });
+    }
+    pool.waitForDone();
+
+    // === FUSION ===
+    QVector<Conjunction> raw;
+    for (const TaskResult& result : std::as_const(results)) {
+        raw += result.conjunctions;
+        m_stats.candidatePairs += result.candidatePairs;
+        m_stats.refinedPairs += result.refinedPairs;
+    }
+
+    std::sort(raw.begin(), raw.end(), [](const Conjunction& a, const Conjunction& b) {
+        if (a.primary != b.primary) {
+            return a.primary < b.primary;
+        }
+        if (a.secondary != b.secondary) {
+            return a.secondary < b.secondary;
+        }
+        return a.tcaJulian < b.tcaJulian;
+    });
+
+    // Un minimum en bord de demi-pas est vu par les deux échantillons
+    // voisins, et deux objets qui restent proches donnent un minimum par
+    // pas : une seule conjonction par chaîne d'instants espacés de moins
+    // d'un pas et demi, la plus proche
+    const double mergeDays = 1.5 * stepSeconds / SECONDS_PER_DAY;
+    QVector<Conjunction> conjunctions;
+    double chainEnd = 0.0;
+    for (const Conjunction& conjunction : std::as_const(raw)) {
+        if (!conjunctions.isEmpty()) {
+            Conjunction& last = conjunctions.last();
+            if (last.primary == conjunction.primary && last.secondary == conjunction.secondary
+                && conjunction.tcaJulian - chainEnd <= mergeDays) {
+                if (conjunction.missDistanceKm < last.missDistanceKm) {
+                    last = conjunction;
+                }
+                chainEnd = conjunction.tcaJulian;
+                continue;
+            }
+        }
+        conjunctions.append(conjunction);
+        chainEnd = conjunction.tcaJulian;
+    }
+
+    // Indices du catalogue complet
+    for (Conjunction& conjunction : conjunctions) {
+        conjunction.primary = catalogIndex[conjunction.primary];
+        conjunction.secondary = catalogIndex[conjunction.secondary];
+        conjunction.primaryNoradId = elements[conjunction.primary].noradId;
+        conjunction.secondaryNoradId = elements[conjunction.secondary].noradId;
+    }
+
+    std::sort(conjunctions.begin(), conjunctions.end(), [](const Conjunction& a, const Conjunction& b) {
+        return a.tcaJulian < b.tcaJulian;
+    });
+
+    m_stats.screenedObjects = subset.size();
+    m_stats.timeSteps = m_completedSteps.load(std::memory_order_relaxed);
+    m_stats.conjunctions = conjunctions.size();
+    m_stats.elapsedMs = timer.elapsed();
+
+    qDebug() << "🎯 Conjonctions:" << m_stats.conjunctions << "sous" << m_thresholdKm << "km,"
+             << m_stats.screenedObjects << "/" << m_stats.catalogSize << "objets après filtrage périgée/apogée,"
+             << m_stats.timeSteps << "pas de" << stepSeconds << "s,"
+             << m_stats.candidatePairs << "paires voisines," << m_stats.refinedPairs << "affinées, en"
+             << m_stats.elapsedMs << "ms"
+             << (m_cancelled.load(std::memory_order_relaxed) ? "(interrompu)" : "");
+
+    m_cancelled.store(false, std::memory_order_relaxed);
+    return conjunctions;
+}
+
+QVector<int> ConjunctionScreener::selectByName(const QVector<ElementSet>& elements, const QStringList& prefixes)
+{
+    QVector<int> indices;
+    for (int i = 0; i < elements.size(); ++i) {
+        const QString name = QString::fromLatin1(elements[i].name).trimmed();
+        for (const QString& prefix : prefixes) {
+            if (name.startsWith(prefix, Qt::CaseInsensitive)) {
+                indices.append(i);
+                break;
+            }
+        }
+    }
+    return indices;
+}
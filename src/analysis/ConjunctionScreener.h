@@ -0,0 +1,134 @@
+#ifndef CONJUNCTIONSCREENER_H
+#define CONJUNCTIONSCREENER_H
+
+#include <QVector>
+#include <QStringList>
+#include <QDateTime>
+#include <atomic>
+#include "../data/TLECatalog.h"
+
+/**
+ * @brief Rapprochement entre deux objets du catalogue
+ */
+struct Conjunction {
+    int primary;                // Indice du jeu d'éléments surveillé
+    int secondary;              // Indice de l'autre jeu d'éléments
+    qint32 primaryNoradId;
+    qint32 secondaryNoradId;
+    double tcaJulian;           // Instant de plus courte distance (date julienne UTC)
+    double missDistanceKm;      // Distance minimale (km)
+    double relativeSpeedKmS;    // Vitesse relative au TCA (km/s)
+
+    /**
+     * @brief Instant de plus courte distance (UTC)
+     */
+    QDateTime tcaDateTime() const;
+};
+
+/**
+ * @brief Bilan de la dernière recherche de conjonctions
+ */
+struct ConjunctionScreeningStats {
+    int catalogSize = 0;
+    int screenedObjects = 0;        // Objets propagés après filtrage périgée/apogée
+    int timeSteps = 0;
+    qint64 candidatePairs = 0;      // Paires voisines dans la grille
+    qint64 refinedPairs = 0;        // Paires affinées (Hermite)
+    int conjunctions = 0;
+    qint64 elapsedMs = 0;
+};
+
+/**
+ * @brief Recherche des rapprochements sur un catalogue entier
+ *
+ * Trois filtres successifs évitent le test de toutes les paires :
+ *  - coquilles périgée/apogée : un objet dont l'intervalle de rayons
+ *    [a(1 - e), a(1 + e)] ne recoupe celui d'aucun objet surveillé n'est
+ *    pas propagé, et les paires de coquilles disjointes sont écartées ;
+ *  - grille uniforme (hachée) reconstruite à chaque pas de temps sur les
+ *    positions BatchPropagator : seules les paires de cellules voisines
+ *    sont comparées, en O(N) par pas au lieu de O(N²) ;
+ *  - mouvement relatif linéaire sur le demi-pas autour de l'échantillon,
+ *    borné par l'accélération relative maximale.
+ *
+ * Les paires restantes sont affinées (instant et distance de plus courte
+ * approche) par interpolation d'Hermite cubique des états encadrants, sans
+ * nouvelle propagation : au pas de 60 s l'erreur est de l'ordre du mètre
+ * en LEO.
+ *
+ * Les pas de temps sont répartis entre threads par tranches contiguës,
+ * chaque tranche propageant sa propre copie du catalogue (les objets
+ * libsgp4 d'espace lointain ont un état mutable). screen() est bloquant :
+ * l'appeler hors du thread GUI ; cancel() et progress() sont utilisables
+ * depuis n'importe quel thread pendant la recherche.
+ */
+class ConjunctionScreener
+{
+public:
+    ConjunctionScreener();
+
+    // Getters
+    double thresholdKm() const { return m_thresholdKm; }
+    double stepSeconds() const { return m_stepSeconds; }
+    int threadCount() const { return m_threadCount; }
+
+    // Setters (à ne pas appeler pendant screen())
+    void setThresholdKm(double km);
+
+    /**
+     * @brief Pas d'échantillonnage (1 à 300 s) : un pas plus long réduit
+     * le nombre de propagations mais élargit le voisinage de la grille
+     * @param seconds 0 = automatique (60 s pour des objets surveillés,
+     * 30 s pour toutes les paires)
+     */
+    void setStepSeconds(double seconds);
+
+    /**
+     * @param threads Nombre de threads de travail (0 = nombre de cœurs)
+     */
+    void setThreadCount(int threads);
+
+    /**
+     * @brief Recherche les rapprochements sous thresholdKm()
+     * @param elements Catalogue complet
+     * @param primaries Indices des objets surveillés ; vide : toutes les paires
+     * @param startJulian Début de la fenêtre (date julienne UTC)
+     * @param durationDays Durée de la fenêtre (jours)
+     * @return Conjonctions triées par instant de plus courte distance
+     */
+    QVector<Conjunction> screen(const QVector<ElementSet>& elements, const QVector<int>& primaries,
+                                double startJulian, double durationDays);
+
+    /**
+     * @brief Interrompt la recherche en cours (résultats partiels), ou la
+     * prochaine si aucune n'a encore commencé
+     */
+    void cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+
+    /**
+     * @brief Avancement de la recherche en cours, de 0 à 1
+     */
+    double progress() const;
+
+    const ConjunctionScreeningStats& lastStats() const { return m_stats; }
+
+    /**
+     * @brief Indices des objets dont le nom commence par l'un des préfixes (casse ignorée)
+     */
+    static QVector<int> selectByName(const QVector<ElementSet>& elements, const QStringList& prefixes);
+
+private:
+    Q_DISABLE_COPY(ConjunctionScreener)
+
+    double m_thresholdKm;
+    double m_stepSeconds;
+    int m_threadCount;
+
+    std::atomic<bool> m_cancelled;
+    std::atomic<int> m_completedSteps;
+    std::atomic<int> m_totalSteps;
+
+    ConjunctionScreeningStats m_stats;
+};
+
+#endif // CONJUNCTIONSCREENER_H
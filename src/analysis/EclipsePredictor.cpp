@@ -0,0 +1,209 @@
+#include "EclipsePredictor.h"
+#include "CoarseScan.h"
+#include "RootFinding.h"
+#include "../simulation/Sunlight.h"
+#include <QElapsedTimer>
+#include <QDebug>
+#include <algorithm>
+
+// Affinage : section dorée (milieu de l'éclipse) puis fausse position (entrées, sorties)
+const double MINIMUM_TOLERANCE_MINUTES = 0.1 / 60.0;
+const double CROSSING_TOLERANCE_MINUTES = 0.01 / 60.0;
+
+// Marge retenue quand SGP4 échoue (objet décroché) : jamais dans l'ombre
+const double FAILED_MARGIN_KM = 1.0e6;
+
+namespace {
+
+/**
+ * @brief Marges d'ombre d'un satellite à la demande (minutes depuis le début de la fenêtre)
+ */
+class ShadowTrack : public CoarseScan::Track
+{
+public:
+    using CoarseScan::Track::Track;
+
+    /**
+     * @brief Marge de pénombre (km, négative dans la pénombre ou l'ombre)
+     * @param umbra [out] Marge d'ombre, ou nullptr
+     */
+    double penumbra(double minutes, double* umbra = nullptr)
+    {
+        double position[3];
+        if (!temeAt(minutes, position)) {
+            if (umbra) {
+                *umbra = FAILED_MARGIN_KM;
+            }
+            return FAILED_MARGIN_KM;
+        }
+
+        double sun[3];
+        Sunlight::sunPositionKm(julian(minutes), sun);
+        return Sunlight::penumbraMarginKm(position, sun, umbra);
+    }
+
+    double umbra(double minutes)
+    {
+        double margin;
+        penumbra(minutes, &margin);
+        return margin;
+    }
+};
+
+/**
+ * @brief Éclipses d'un satellite, à partir de la grille grossière
+ * @param times Instants de la grille (minutes depuis le début, croissants)
+ * @param margins Marges de pénombre aux mêmes instants
+ */
+void findEclipses(ShadowTrack& track, const QVector<double>& times, const QVector<double>& margins,
+                  int satellite, int noradId, QVector<EclipseInterval>& eclipses)
+{
+    const int n = times.size();
+    auto penumbra = [&track](double minutes) { return track.penumbra(minutes); };
+    auto umbra = [&track](double minutes) { return track.umbra(minutes); };
+
+    double lastExit = -1.0;
+
+    for (int k = 0; k < n; ++k) {
+        const bool falling = (k == 0) || margins[k] <= margins[k - 1];
+        const bool rising = (k == n - 1) || margins[k] < margins[k + 1];
+        if (!falling || !rising) {
+            continue;
+        }
+
+        // Le minimum vrai est encadré par les deux échantillons voisins
+        double deepest;
+        double middle = RootFinding::goldenMinimum(penumbra, times[qMax(0, k - 1)], times[qMin(n - 1, k + 1)],
+                                                   MINIMUM_TOLERANCE_MINUTES, deepest);
+        if (margins[k] < deepest) {
+            middle = times[k];
+            deepest = margins[k];
+        }
+        if (deepest >= 0.0 || middle <= lastExit) {
+            continue;
+        }
+
+        // Entrée : dernier échantillon éclairé avant le milieu
+        int lit = k;
+        while (lit >= 0 && (times[lit] > middle || margins[lit] < 0.0)) {
+            --lit;
+        }
+        double entry = times[0];
+        if (lit >= 0) {
+            const double upper = (lit + 1 < n && times[lit + 1] <= middle) ? times[lit + 1] : middle;
+            const double upperMargin = (upper == middle) ? deepest : margins[lit + 1];
+            entry = RootFinding::findCrossing(penumbra, times[lit], margins[lit], upper, upperMargin,
+                                              CROSSING_TOLERANCE_MINUTES);
+        }
+
+        // Sortie : premier échantillon éclairé après le milieu
+        int after = qMax(0, k - 1);
+        while (after < n && (times[after] < middle || margins[after] < 0.0)) {
+            ++after;
+        }
+        double exit = times[n - 1];
+        if (after < n) {
+            const double lower = (after - 1 >= 0 && times[after - 1] >= middle) ? times[after - 1] : middle;
+            const double lowerMargin = (lower == middle) ? deepest : margins[after - 1];
+            exit = RootFinding::findCrossing(penumbra, lower, lowerMargin, times[after], margins[after],
+                                             CROSSING_TOLERANCE_MINUTES);
+        }
+
+        EclipseInterval eclipse;
+        eclipse.satellite = satellite;
+        eclipse.noradId = noradId;
+        eclipse.penumbraEntryJulian = track.julian(entry);
+        eclipse.penumbraExitJulian = track.julian(exit);
+        eclipse.umbraEntryJulian = eclipse.penumbraEntryJulian;
+        eclipse.umbraExitJulian = eclipse.penumbraExitJulian;
+
+        // Ombre : les deux cônes ont le même axe, la marge d'ombre est
+        // minimale au même instant et positive sur les bords de la pénombre
+        const double middleUmbra = umbra(middle);
+        eclipse.hasUmbra = middleUmbra < 0.0;
+        if (eclipse.hasUmbra) {
+            const double entryUmbra = umbra(entry);
+            if (entryUmbra >= 0.0) {
+                eclipse.umbraEntryJulian = track.julian(RootFinding::findCrossing(
+                    umbra, entry, entryUmbra, middle, middleUmbra, CROSSING_TOLERANCE_MINUTES));
+            }
+            const double exitUmbra = umbra(exit);
+            if (exitUmbra >= 0.0) {
+                eclipse.umbraExitJulian = track.julian(RootFinding::findCrossing(
+                    umbra, middle, middleUmbra, exit, exitUmbra, CROSSING_TOLERANCE_MINUTES));
+            }
+        }
+
+        eclipses.append(eclipse);
+        lastExit = exit;
+    }
+}
+
+} // namespace
+
+QDateTime EclipseInterval::entry() const
+{
+    return SGP4Propagator::fromJulian(penumbraEntryJulian);
+}
+
+QDateTime EclipseInterval::exit() const
+{
+    return SGP4Propagator::fromJulian(penumbraExitJulian);
+}
+
+EclipsePredictor::EclipsePredictor()
+    : m_threadCount(0)
+{
+}
+
+void EclipsePredictor::setThreadCount(int threads)
+{
+    m_threadCount = qMax(0, threads);
+}
+
+QVector<EclipseInterval> EclipsePredictor::predict(const QVector<TLEData>& satellites,
+                                                   double startJulian, double durationDays)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    m_stats = EclipsePredictionStats();
+    m_stats.satellites = satellites.size();
+
+    QVector<EclipseInterval> eclipses;
+    if (satellites.isEmpty() || durationDays <= 0.0) {
+        return eclipses;
+    }
+
+    // === UNE TÂCHE PAR SATELLITE ===
+    CoarseScan::Totals totals;
+    eclipses = CoarseScan::scanSatellites<ShadowTrack, EclipseInterval>(
+        satellites, startJulian, durationDays * CoarseScan::MINUTES_PER_DAY, m_threadCount,
+        [](ShadowTrack& track, int satellite, const TLEData& tle, const QVector<double>& times,
+           QVector<EclipseInterval>& satelliteEclipses) {
+            QVector<double> margins(times.size());
+            for (int k = 0; k < times.size(); ++k) {
+                margins[k] = track.penumbra(times[k]);
+            }
+            findEclipses(track, times, margins, satellite, tle.noradId, satelliteEclipses);
+        },
+        totals);
+    m_stats.propagations = totals.propagations;
+    m_stats.failedSatellites = totals.failedSatellites;
+
+    std::sort(eclipses.begin(), eclipses.end(), [](const EclipseInterval& a, const EclipseInterval& b) {
+        return a.penumbraEntryJulian < b.penumbraEntryJulian;
+    });
+
+    m_stats.eclipses = eclipses.size();
+    m_stats.elapsedMs = timer.elapsed();
+
+    qDebug() << "🌑 Éclipses:" << m_stats.eclipses << "pour" << m_stats.satellites << "satellites sur"
+             << durationDays << "jours," << m_stats.propagations << "propagations, en"
+             << m_stats.elapsedMs << "ms";
+    if (m_stats.failedSatellites > 0) {
+        qWarning() << "⚠️" << m_stats.failedSatellites << "TLE rejetés par SGP4";
+    }
+
+    return eclipses;
+}
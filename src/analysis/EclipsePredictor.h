@@ -0,0 +1,81 @@
+#ifndef ECLIPSEPREDICTOR_H
+#define ECLIPSEPREDICTOR_H
+
+#include <QVector>
+#include <QDateTime>
+#include "../data/TLEParser.h"
+
+/**
+ * @brief Traversée de l'ombre de la Terre par un satellite
+ *
+ * Les instants sont bornés à la fenêtre de prédiction, comme les passages
+ * (SatellitePass). Une éclipse rasante peut ne traverser que la pénombre.
+ */
+struct EclipseInterval {
+    int satellite;                  // Indice dans la liste de TLE
+    int noradId;
+    double penumbraEntryJulian;     // Entrée dans la pénombre (date julienne UTC)
+    double penumbraExitJulian;      // Sortie de la pénombre
+    double umbraEntryJulian;        // Entrée dans l'ombre (si hasUmbra)
+    double umbraExitJulian;         // Sortie de l'ombre (si hasUmbra)
+    bool hasUmbra;
+
+    QDateTime entry() const;
+    QDateTime exit() const;
+    double durationSeconds() const { return (penumbraExitJulian - penumbraEntryJulian) * 86400.0; }
+    double umbraSeconds() const { return hasUmbra ? (umbraExitJulian - umbraEntryJulian) * 86400.0 : 0.0; }
+};
+
+/**
+ * @brief Bilan de la dernière prédiction
+ */
+struct EclipsePredictionStats {
+    int satellites = 0;
+    int failedSatellites = 0;       // TLE rejetés par SGP4
+    qint64 propagations = 0;        // Appels SGP4 (grossiers + affinage)
+    int eclipses = 0;
+    qint64 elapsedMs = 0;
+};
+
+/**
+ * @brief Prédiction des entrées et sorties d'éclipse, orbite par orbite
+ *
+ * Même schéma que PassPredictor : grille grossière de pas période / 20
+ * (10 min au plus), puis affinage. La marge au cône de pénombre
+ * (Sunlight::penumbraMarginKm, continue) est minimisée par section dorée
+ * autour de chaque minimum échantillonné : une éclipse rasante, plus
+ * courte que le pas, n'est pas manquée. Les zéros de la marge de pénombre
+ * puis de celle d'ombre, encadrés par la grille et par ce minimum, donnent
+ * les quatre instants par fausse position (Illinois) à 10 ms près.
+ *
+ * Les satellites sont répartis entre threads ; predict() est bloquant.
+ */
+class EclipsePredictor
+{
+public:
+    EclipsePredictor();
+
+    int threadCount() const { return m_threadCount; }
+
+    /**
+     * @param threads Nombre de threads de travail (0 = nombre de cœurs)
+     */
+    void setThreadCount(int threads);
+
+    /**
+     * @brief Prédit les éclipses de tous les satellites sur la fenêtre
+     * @param satellites TLE des satellites
+     * @param startJulian Début de la fenêtre (date julienne UTC)
+     * @param durationDays Durée de la fenêtre (jours)
+     * @return Éclipses triées par entrée
+     */
+    QVector<EclipseInterval> predict(const QVector<TLEData>& satellites, double startJulian, double durationDays);
+
+    const EclipsePredictionStats& lastStats() const { return m_stats; }
+
+private:
+    int m_threadCount;
+    EclipsePredictionStats m_stats;
+};
+
+#endif // ECLIPSEPREDICTOR_H
@@ -0,0 +1,307 @@
+#include "PassPredictor.h"
+#include "CoarseScan.h"
+#include "RootFinding.h"
+#include "../simulation/Frames.h"
+#include <QElapsedTimer>
+#include <QtMath>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+
+// Affinage : section dorée (TCA) puis fausse position (AOS, LOS)
+const double TCA_TOLERANCE_MINUTES = 0.1 / 60.0;
+const double CROSSING_TOLERANCE_MINUTES = 0.01 / 60.0;
+
+// Élévation retenue quand SGP4 échoue (objet décroché) : sous tout masque
+const double FAILED_ELEVATION = -M_PI_2;
+
+namespace {
+
+/**
+ * @brief Repère topocentrique d'une station (ECEF, km)
+ */
+struct StationFrame {
+    double position[3];
+    double east[3];
+    double north[3];
+    double up[3];
+    double mask;                // Masque d'élévation (radians)
+
+    explicit StationFrame(const GroundStation& station)
+    {
+        const double lat = qDegreesToRadians(station.latitudeDeg);
+        const double lon = qDegreesToRadians(station.longitudeDeg);
+        const double sinLat = std::sin(lat), cosLat = std::cos(lat);
+        const double sinLon = std::sin(lon), cosLon = std::cos(lon);
+
+        Frames::geodeticToEcef(station.latitudeDeg, station.longitudeDeg, station.altitudeKm, position);
+
+        east[0] = -sinLon;          east[1] = cosLon;           east[2] = 0.0;
+        north[0] = -sinLat * cosLon; north[1] = -sinLat * sinLon; north[2] = cosLat;
+        up[0] = cosLat * cosLon;    up[1] = cosLat * sinLon;    up[2] = sinLat;
+
+        mask = qDegreesToRadians(station.minElevationDeg);
+    }
+
+    /**
+     * @brief Élévation et azimut (radians) d'une position ECEF
+     */
+    void look(const double* ecef, double& elevation, double* azimuth = nullptr) const
+    {
+        const double dx = ecef[0] - position[0];
+        const double dy = ecef[1] - position[1];
+        const double dz = ecef[2] - position[2];
+        const double range = std::sqrt(dx * dx + dy * dy + dz * dz);
+        const double u = dx * up[0] + dy * up[1] + dz * up[2];
+        elevation = std::asin(qBound(-1.0, u / range, 1.0));
+
+        if (azimuth) {
+            const double e = dx * east[0] + dy * east[1];
+            const double n = dx * north[0] + dy * north[1] + dz * north[2];
+            double az = std::atan2(e, n);
+            if (az < 0.0) {
+                az += 2.0 * M_PI;
+            }
+            *azimuth = az;
+        }
+    }
+};
+
+/**
+ * @brief Positions ECEF d'un satellite à la demande (minutes depuis le début de la fenêtre)
+ */
+class SatelliteTrack : public CoarseScan::Track
+{
+public:
+    using CoarseScan::Track::Track;
+
+    /**
+     * @brief Position TEME tournée du temps sidéral (repère terrestre)
+     * @return false si SGP4 échoue
+     */
+    bool ecefAt(double minutes, double* ecef)
+    {
+        if (!temeAt(minutes, ecef)) {
+            return false;
+        }
+        Frames::temeToEcef(ecef, 1, julian(minutes));
+        return true;
+    }
+
+    /**
+     * @brief Élévation au-dessus du masque (radians, négative dessous)
+     */
+    double elevationAt(const StationFrame& station, double minutes, double* azimuth = nullptr)
+    {
+        double ecef[3];
+        if (!ecefAt(minutes, ecef)) {
+            if (azimuth) {
+                *azimuth = 0.0;
+            }
+            return FAILED_ELEVATION - station.mask;
+        }
+        double elevation;
+        station.look(ecef, elevation, azimuth);
+        return elevation - station.mask;
+    }
+};
+
+/**
+ * @brief Passages d'un satellite sur une station, à partir de la grille grossière
+ * @param times Instants de la grille (minutes depuis le début, croissants)
+ * @param elevations Élévations au-dessus du masque aux mêmes instants
+ */
+void findPasses(SatelliteTrack& track, const StationFrame& station,
+                const QVector<double>& times, const QVector<double>& elevations,
+                int satellite, int stationIndex, int noradId, QVector<SatellitePass>& passes)
+{
+    const int n = times.size();
+    auto elevation = [&track, &station](double minutes) {
+        return track.elevationAt(station, minutes);
+    };
+
+    double lastLos = -1.0;
+    SatellitePass* current = nullptr;
+
+    for (int k = 0; k < n; ++k) {
+        const bool rising = (k == 0) || elevations[k] >= elevations[k - 1];
+        const bool falling = (k == n - 1) || elevations[k] > elevations[k + 1];
+        if (!rising || !falling || elevations[k] <= FAILED_ELEVATION - station.mask) {
+            continue;
+        }
+
+        // Le maximum vrai est encadré par les deux échantillons voisins
+        double tcaElevation;
+        double tca = RootFinding::goldenMaximum(elevation, times[qMax(0, k - 1)], times[qMin(n - 1, k + 1)],
+                                                TCA_TOLERANCE_MINUTES, tcaElevation);
+        if (elevations[k] > tcaElevation) {
+            tca = times[k];
+            tcaElevation = elevations[k];
+        }
+        if (tcaElevation < 0.0) {
+            continue;
+        }
+
+        // Deuxième maximum d'un même passage (orbite haute, passage au bord)
+        if (current && tca <= lastLos) {
+            if (tcaElevation + station.mask > qDegreesToRadians(current->maxElevationDeg)) {
+                current->tcaJulian = track.julian(tca);
+                current->maxElevationDeg = qRadiansToDegrees(tcaElevation + station.mask);
+            }
+            continue;
+        }
+
+        SatellitePass pass;
+        pass.satellite = satellite;
+        pass.station = stationIndex;
+        pass.noradId = noradId;
+        pass.tcaJulian = track.julian(tca);
+        pass.maxElevationDeg = qRadiansToDegrees(tcaElevation + station.mask);
+
+        // Lever : dernier échantillon sous le masque avant le TCA
+        int below = k;
+        while (below >= 0 && (times[below] > tca || elevations[below] >= 0.0)) {
+            --below;
+        }
+        double aos = times[0];
+        if (below >= 0) {
+            const double upper = (below + 1 < n && times[below + 1] <= tca) ? times[below + 1] : tca;
+            const double upperElevation = (upper == tca) ? tcaElevation : elevations[below + 1];
+            aos = RootFinding::findCrossing(elevation, times[below], elevations[below], upper, upperElevation,
+                                           CROSSING_TOLERANCE_MINUTES);
+        }
+
+        // Coucher : premier échantillon sous le masque après le TCA
+        int after = qMax(0, k - 1);
+        while (after < n && (times[after] < tca || elevations[after] >= 0.0)) {
+            ++after;
+        }
+        double los = times[n - 1];
+        if (after < n) {
+            const double lower = (after - 1 >= 0 && times[after - 1] >= tca) ? times[after - 1] : tca;
+            const double lowerElevation = (lower == tca) ? tcaElevation : elevations[after - 1];
+            los = RootFinding::findCrossing(elevation, lower, lowerElevation, times[after], elevations[after],
+                                           CROSSING_TOLERANCE_MINUTES);
+        }
+
+        double azimuth;
+        track.elevationAt(station, aos, &azimuth);
+        pass.aosAzimuthDeg = qRadiansToDegrees(azimuth);
+        track.elevationAt(station, los, &azimuth);
+        pass.losAzimuthDeg = qRadiansToDegrees(azimuth);
+        pass.aosJulian = track.julian(aos);
+        pass.losJulian = track.julian(los);
+
+        passes.append(pass);
+        current = &passes.last();
+        lastLos = los;
+    }
+}
+
+/**
+ * @brief Passages d'un satellite sur toutes les stations, grille grossière commune
+ */
+void predictSatellite(SatelliteTrack& track, int satellite, const TLEData& tle,
+                      const QVector<double>& times, const QVector<StationFrame>& stations,
+                      QVector<SatellitePass>& passes)
+{
+    // === GRILLE GROSSIÈRE, commune à toutes les stations ===
+    const int n = times.size();
+    QVector<double> ecef(3 * n);
+    QVector<bool> valid(n);
+    for (int k = 0; k < n; ++k) {
+        valid[k] = track.ecefAt(times[k], &ecef[3 * k]);
+    }
+
+    // === AFFINAGE PAR STATION ===
+    QVector<double> elevations(n);
+    for (int s = 0; s < stations.size(); ++s) {
+        const StationFrame& station = stations[s];
+        for (int k = 0; k < n; ++k) {
+            double elevation = FAILED_ELEVATION;
+            if (valid[k]) {
+                station.look(&ecef[3 * k], elevation);
+            }
+            elevations[k] = elevation - station.mask;
+        }
+        findPasses(track, station, times, elevations, satellite, s, tle.noradId, passes);
+    }
+}
+
+} // namespace
+
+QDateTime SatellitePass::aos() const
+{
+    return SGP4Propagator::fromJulian(aosJulian);
+}
+
+QDateTime SatellitePass::tca() const
+{
+    return SGP4Propagator::fromJulian(tcaJulian);
+}
+
+QDateTime SatellitePass::los() const
+{
+    return SGP4Propagator::fromJulian(losJulian);
+}
+
+PassPredictor::PassPredictor()
+    : m_threadCount(0)
+{
+}
+
+void PassPredictor::setThreadCount(int threads)
+{
+    m_threadCount = qMax(0, threads);
+}
+
+QVector<SatellitePass> PassPredictor::predict(const QVector<TLEData>& satellites,
+                                              const QVector<GroundStation>& stations,
+                                              double startJulian, double durationDays)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    m_stats = PassPredictionStats();
+    m_stats.satellites = satellites.size();
+    m_stats.stations = stations.size();
+
+    QVector<SatellitePass> passes;
+    if (satellites.isEmpty() || stations.isEmpty() || durationDays <= 0.0) {
+        return passes;
+    }
+
+    QVector<StationFrame> frames;
+    frames.reserve(stations.size());
+    for (const GroundStation& station : stations) {
+        frames.append(StationFrame(station));
+    }
+
+    // === UNE TÂCHE PAR SATELLITE ===
+    CoarseScan::Totals totals;
+    passes = CoarseScan::scanSatellites<SatelliteTrack, SatellitePass>(
+        satellites, startJulian, durationDays * CoarseScan::MINUTES_PER_DAY, m_threadCount,
+        [&frames](SatelliteTrack& track, int satellite, const TLEData& tle, const QVector<double>& times,
+                  QVector<SatellitePass>& satellitePasses) {
+            predictSatellite(track, satellite, tle, times, frames, satellitePasses);
+        },
+        totals);
+    m_stats.propagations = totals.propagations;
+    m_stats.failedSatellites = totals.failedSatellites;
+
+    std::sort(passes.begin(), passes.end(), [](const SatellitePass& a, const SatellitePass& b) {
+        return a.aosJulian < b.aosJulian;
+    });
+
+    m_stats.passes = passes.size();
+    m_stats.elapsedMs = timer.elapsed();
+
+    qDebug() << "📡 Passages:" << m_stats.passes << "pour" << m_stats.satellites << "satellites et"
+             << m_stats.stations << "stations sur" << durationDays << "jours,"
+             << m_stats.propagations << "propagations, en" << m_stats.elapsedMs << "ms";
+    if (m_stats.failedSatellites > 0) {
+        qWarning() << "⚠️" << m_stats.failedSatellites << "TLE rejetés par SGP4";
+    }
+
+    return passes;
+}
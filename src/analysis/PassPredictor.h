@@ -0,0 +1,101 @@
+#ifndef PASSPREDICTOR_H
+#define PASSPREDICTOR_H
+
+#include <QVector>
+#include <QString>
+#include <QDateTime>
+#include "../data/TLEParser.h"
+
+/**
+ * @brief Station sol (coordonnées géodésiques WGS84)
+ */
+struct GroundStation {
+    QString name;
+    double latitudeDeg = 0.0;       // Latitude géodésique (degrés, nord positif)
+    double longitudeDeg = 0.0;      // Longitude (degrés, est positif)
+    double altitudeKm = 0.0;        // Hauteur au-dessus de l'ellipsoïde (km)
+    double minElevationDeg = 0.0;   // Masque d'élévation (degrés)
+};
+
+/**
+ * @brief Passage d'un satellite au-dessus d'une station
+ *
+ * Les instants sont bornés à la fenêtre de prédiction : un passage déjà
+ * en cours au début (ou pas terminé à la fin) commence (ou finit) au bord.
+ */
+struct SatellitePass {
+    int satellite;              // Indice dans la liste de TLE
+    int station;                // Indice dans la liste de stations
+    int noradId;
+    double aosJulian;           // Lever au-dessus du masque (date julienne UTC)
+    double tcaJulian;           // Élévation maximale
+    double losJulian;           // Coucher sous le masque
+    double maxElevationDeg;
+    double aosAzimuthDeg;       // Azimut au lever (degrés, depuis le nord vers l'est)
+    double losAzimuthDeg;       // Azimut au coucher
+
+    QDateTime aos() const;
+    QDateTime tca() const;
+    QDateTime los() const;
+    double durationSeconds() const { return (losJulian - aosJulian) * 86400.0; }
+};
+
+/**
+ * @brief Bilan de la dernière prédiction
+ */
+struct PassPredictionStats {
+    int satellites = 0;
+    int stations = 0;
+    int failedSatellites = 0;       // TLE rejetés par SGP4
+    qint64 propagations = 0;        // Appels SGP4 (grossiers + affinage)
+    int passes = 0;
+    qint64 elapsedMs = 0;
+};
+
+/**
+ * @brief Prédiction des passages (AOS, TCA, LOS, élévation maximale)
+ *
+ * Recherche grossière puis fine, sans échantillonnage à la seconde :
+ *  - chaque satellite est propagé sur une grille de pas période / 20
+ *    (10 min au plus), partagée par toutes les stations ;
+ *  - chaque maximum local de l'élévation échantillonnée est affiné par
+ *    section dorée (TCA, élévation maximale) ;
+ *  - si le maximum dépasse le masque, le lever et le coucher sont
+ *    encadrés par les échantillons voisins sous le masque, puis trouvés
+ *    par fausse position (Illinois) à 10 ms près.
+ *
+ * Les positions TEME sont ramenées au repère terrestre par le temps
+ * sidéral moyen (Frames::gmstRadians), comme le fait SGP4.
+ * Les satellites sont répartis entre threads ; predict() est bloquant.
+ */
+class PassPredictor
+{
+public:
+    PassPredictor();
+
+    int threadCount() const { return m_threadCount; }
+
+    /**
+     * @param threads Nombre de threads de travail (0 = nombre de cœurs)
+     */
+    void setThreadCount(int threads);
+
+    /**
+     * @brief Prédit les passages de tous les satellites sur toutes les stations
+     * @param satellites TLE des satellites
+     * @param stations Stations sol
+     * @param startJulian Début de la fenêtre (date julienne UTC)
+     * @param durationDays Durée de la fenêtre (jours)
+     * @return Passages triés par lever
+     */
+    QVector<SatellitePass> predict(const QVector<TLEData>& satellites, const QVector<GroundStation>& stations,
+                                   double startJulian, double durationDays);
+
+    const PassPredictionStats& lastStats() const { return m_stats; }
+
+private:
+    int m_threadCount;
+    PassPredictionStats m_stats;
+};
+
+#endif // PASSPREDICTOR_H
@@ -0,0 +1,101 @@
+#ifndef ROOTFINDING_H
+#define ROOTFINDING_H
+
+/**
+ * @brief Recherches 1D sur un intervalle encadrant (affinage après une grille grossière)
+ *
+ * Fonctions évaluées à la demande (une propagation par appel) : le nombre
+ * d'appels est borné par la tolérance, pas par la longueur de la fenêtre.
+ */
+namespace RootFinding {
+
+const double GOLDEN_RATIO = 0.6180339887498949;
+const int MAX_CROSSING_ITERATIONS = 50;
+
+/**
+ * @brief Maximum d'une fonction unimodale sur [a, b] (section dorée)
+ * @param fMax [out] Valeur au maximum
+ * @return Abscisse du maximum, à tolerance près
+ */
+template <typename F>
+double goldenMaximum(F f, double a, double b, double tolerance, double& fMax)
+{
+    double x1 = b - GOLDEN_RATIO * (b - a);
+    double x2 = a + GOLDEN_RATIO * (b - a);
+    double f1 = f(x1);
+    double f2 = f(x2);
+
+    while (b - a > tolerance) {
+        if (f1 < f2) {
+            a = x1;
+            x1 = x2;
+            f1 = f2;
+            x2 = a + GOLDEN_RATIO * (b - a);
+            f2 = f(x2);
+        } else {
+            b = x2;
+            x2 = x1;
+            f2 = f1;
+            x1 = b - GOLDEN_RATIO * (b - a);
+            f1 = f(x1);
+        }
+    }
+
+    if (f1 > f2) {
+        fMax = f1;
+        return x1;
+    }
+    fMax = f2;
+    return x2;
+}
+
+/**
+ * @brief Minimum d'une fonction unimodale sur [a, b] (section dorée)
+ */
+template <typename F>
+double goldenMinimum(F f, double a, double b, double tolerance, double& fMin)
+{
+    const double x = goldenMaximum([&f](double t) { return -f(t); }, a, b, tolerance, fMin);
+    fMin = -fMin;
+    return x;
+}
+
+/**
+ * @brief Zéro de f encadré par [a, b] (fausse position, variante Illinois)
+ *
+ * f(a) et f(b) de signes opposés. La variante Illinois divise par deux la
+ * valeur de l'extrémité qui ne bouge pas : convergence superlinéaire, là où
+ * la fausse position simple stagne sur une courbe convexe.
+ */
+template <typename F>
+double findCrossing(F f, double a, double fa, double b, double fb, double tolerance)
+{
+    int side = 0;
+    double c = a;
+    for (int i = 0; i < MAX_CROSSING_ITERATIONS && b - a > tolerance; ++i) {
+        c = (a * fb - b * fa) / (fb - fa);
+        const double fc = f(c);
+        if (fc == 0.0) {
+            return c;
+        }
+        if ((fc < 0.0) == (fb < 0.0)) {
+            b = c;
+            fb = fc;
+            if (side == -1) {
+                fa *= 0.5;
+            }
+            side = -1;
+        } else {
+            a = c;
+            fa = fc;
+            if (side == 1) {
+                fb *= 0.5;
+            }
+            side = 1;
+        }
+    }
+    return c;
+}
+}
+
+#endif // ROOTFINDING_H
@@ -0,0 +1,274 @@
+#include "ElementSetCache.h"
+#include <QFileInfo>
+#include <QDateTime>
+#include <QSaveFile>
+#include <QElapsedTimer>
+#include <QDebug>
+#include <cstring>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<ElementSet>::value,
+              "ElementSet doit rester un POD pour être projeté depuis le cache");
+
+namespace {
+
+const char CACHE_MAGIC[8] = {'O', 'F', 'E', 'L', 'S', 'E', 'T', '\0'};
+const quint32 BYTE_ORDER_MARK = 0x01020304;
+
+/**
+ * @brief En-tête du fichier cache (64 octets, suivi des ElementSet)
+ */
+struct CacheHeader {
+    char magic[8];
+    quint32 version;
+    quint32 byteOrderMark;     // Détecte un cache écrit sur une autre architecture
+    quint32 recordSize;        // sizeof(ElementSet) à l'écriture
+    quint32 count;             // Nombre de jeux d'éléments
+    qint64 sourceSize;         // Taille du fichier TLE source
+    qint64 sourceMTime;        // Date de modification du source (ms depuis 1970)
+    quint64 sourceHash;        // Empreinte du contenu du source
+    quint64 payloadChecksum;   // Checksum des ElementSet
+    quint64 reserved;
+};
+
+static_assert(sizeof(CacheHeader) == 64, "En-tête de cache : 64 octets attendus");
+
+/**
+ * @brief Empreinte FNV-1a 64 bits, lue par mots de 8 octets
+ */
+quint64 hashBytes(const uchar* data, qint64 size)
+{
+    const quint64 prime = 0x100000001b3ULL;
+    quint64 hash = 0xcbf29ce484222325ULL;
+
+    qint64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        quint64 word;
+        std::memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ data[i]) * prime;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Empreinte du contenu d'un fichier (projeté en mémoire)
+ */
+bool hashFile(const QString& path, quint64& hash)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const qint64 size = file.size();
+    if (size == 0) {
+        hash = hashBytes(nullptr, 0);
+        return true;
+    }
+
+    uchar* mapped = file.map(0, size);
+    if (!mapped) {
+        return false;
+    }
+    hash = hashBytes(mapped, size);
+    file.unmap(mapped);
+    return true;
+}
+
+/**
+ * @brief Réécrit l'en-tête en place (les données ne bougent pas)
+ * @return false si l'en-tête n'a pas pu être écrit entièrement
+ */
+bool writeHeader(const QString& path, const CacheHeader& header)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadWrite)) {
+        return false;
+    }
+
+    const bool written = file.seek(0)
+        && file.write(reinterpret_cast<const char*>(&header), sizeof(header))
+               == static_cast<qint64>(sizeof(header))
+        && file.flush();
+    file.close();
+    return written;
+}
+
+} // namespace
+
+ElementSetCache::~ElementSetCache()
+{
+    close();
+}
+
+void ElementSetCache::close()
+{
+    if (m_mapped) {
+        m_file.unmap(m_mapped);
+        m_mapped = nullptr;
+    }
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+    m_fallback.clear();
+    m_data = nullptr;
+    m_count = 0;
+}
+
+bool ElementSetCache::open(const QString& tlePath, const QString& cachePath)
+{
+    close();
+    m_rebuilt = false;
+
+    const QString path = cachePath.isEmpty() ? tlePath + ".elset" : cachePath;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // Checksum des données : vérifié après écriture, ou sur demande (ORBIFRANCE_VERIFY_CACHE),
+    // pour ne pas charger toutes les pages à chaque démarrage
+    if (mapCache(path, tlePath, qEnvironmentVariableIsSet("ORBIFRANCE_VERIFY_CACHE"))) {
+        qDebug() << "💾 Cache d'éléments chargé:" << m_count << "satellites en"
+                 << QString::number(timer.nsecsElapsed() / 1.0e6, 'f', 2) << "ms";
+        return true;
+    }
+
+    // === RECONSTRUCTION DEPUIS LE FICHIER TLE ===
+    m_rebuilt = true;
+
+    TLECatalog catalog;
+    if (!catalog.load(tlePath)) {
+        return false;
+    }
+
+    if (write(path, tlePath, catalog.elements()) && mapCache(path, tlePath, true)) {
+        qDebug() << "💾 Cache d'éléments reconstruit:" << path;
+        return true;
+    }
+
+    // Cache non inscriptible : on garde les éléments en mémoire
+    qWarning() << "⚠️ Cache d'éléments non écrit, utilisation directe du catalogue:" << path;
+    m_fallback = catalog.elements();
+    m_data = m_fallback.constData();
+    m_count = m_fallback.size();
+    return true;
+}
+
+bool ElementSetCache::mapCache(const QString& cachePath, const QString& tlePath, bool verifyPayload)
+{
+    QFileInfo sourceInfo(tlePath);
+    if (!sourceInfo.exists()) {
+        return false;
+    }
+
+    m_file.setFileName(cachePath);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const qint64 fileSize = m_file.size();
+    if (fileSize < static_cast<qint64>(sizeof(CacheHeader))) {
+        m_file.close();
+        return false;
+    }
+
+    m_mapped = m_file.map(0, fileSize);
+    if (!m_mapped) {
+        m_file.close();
+        return false;
+    }
+
+    auto reject = [this](const char* reason) {
+        qDebug() << "💾 Cache d'éléments invalide:" << reason;
+        m_file.unmap(m_mapped);
+        m_mapped = nullptr;
+        m_file.close();
+        return false;
+    };
+
+    CacheHeader header;
+    std::memcpy(&header, m_mapped, sizeof(header));
+
+    // === VALIDATION DU FORMAT ===
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0
+        || header.byteOrderMark != BYTE_ORDER_MARK) {
+        return reject("format inconnu");
+    }
+    if (header.version != FORMAT_VERSION || header.recordSize != sizeof(ElementSet)) {
+        return reject("version différente");
+    }
+
+    const qint64 payloadSize = static_cast<qint64>(header.count) * sizeof(ElementSet);
+    if (fileSize != static_cast<qint64>(sizeof(CacheHeader)) + payloadSize) {
+        return reject("taille incohérente");
+    }
+
+    // === VALIDATION FACE AU FICHIER SOURCE ===
+    // Même taille et même date : pas besoin de relire le source
+    const qint64 sourceMTime = sourceInfo.lastModified().toMSecsSinceEpoch();
+    if (header.sourceSize != sourceInfo.size() || header.sourceMTime != sourceMTime) {
+        quint64 sourceHash;
+        if (!hashFile(tlePath, sourceHash) || sourceHash != header.sourceHash) {
+            return reject("fichier TLE modifié");
+        }
+
+        // Contenu identique (fichier retouché, retéléchargé à l'identique) :
+        // le cache reste valable, mais sa signature doit suivre le source,
+        // sinon chaque démarrage suivant relirait tout le fichier TLE
+        header.sourceSize = sourceInfo.size();
+        header.sourceMTime = sourceMTime;
+        if (!writeHeader(cachePath, header)) {
+            return reject("signature non mise à jour, reconstruction");
+        }
+        qDebug() << "💾 Signature du cache d'éléments mise à jour (contenu TLE inchangé)";
+    }
+
+    // === VALIDATION DES DONNÉES ===
+    const uchar* payload = m_mapped + sizeof(CacheHeader);
+    if (verifyPayload && hashBytes(payload, payloadSize) != header.payloadChecksum) {
+        return reject("checksum invalide");
+    }
+
+    m_data = reinterpret_cast<const ElementSet*>(payload);
+    m_count = static_cast<int>(header.count);
+    return true;
+}
+
+bool ElementSetCache::write(const QString& cachePath, const QString& tlePath,
+                            const QVector<ElementSet>& elements)
+{
+    QFileInfo sourceInfo(tlePath);
+
+    CacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = FORMAT_VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.recordSize = sizeof(ElementSet);
+    header.count = static_cast<quint32>(elements.size());
+    header.sourceSize = sourceInfo.size();
+    header.sourceMTime = sourceInfo.lastModified().toMSecsSinceEpoch();
+
+    if (!hashFile(tlePath, header.sourceHash)) {
+        return false;
+    }
+
+    const qint64 payloadSize = static_cast<qint64>(elements.size()) * sizeof(ElementSet);
+    header.payloadChecksum = hashBytes(reinterpret_cast<const uchar*>(elements.constData()),
+                                       payloadSize);
+
+    // Écriture atomique : un cache à moitié écrit n'est jamais visible
+    QSaveFile file(cachePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(elements.constData()), payloadSize);
+
+    return file.commit();
+}
@@ -0,0 +1,86 @@
+#ifndef ELEMENTSETCACHE_H
+#define ELEMENTSETCACHE_H
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+#include "TLECatalog.h"
+
+/**
+ * @brief Cache binaire des jeux d'éléments d'un fichier TLE
+ *
+ * Le cache contient un en-tête versionné (taille, date de modification
+ * et empreinte du fichier source, checksum des données) suivi des
+ * ElementSet bruts. Il est projeté en mémoire et utilisé tel quel :
+ * un démarrage à froid se résume à charger des pages, sans parsing.
+ *
+ * Le cache n'est reconstruit que si le fichier source a changé
+ * (date de modification puis empreinte de contenu). Un source retouché
+ * mais identique met à jour la signature de l'en-tête.
+ *
+ * Le checksum des données n'est vérifié qu'après reconstruction, ou à
+ * chaque ouverture si ORBIFRANCE_VERIFY_CACHE est défini : le vérifier
+ * systématiquement chargerait toutes les pages au démarrage.
+ */
+class ElementSetCache
+{
+public:
+    static const quint32 FORMAT_VERSION = 1;
+
+    ElementSetCache() = default;
+    ~ElementSetCache();
+
+    /**
+     * @brief Ouvre le cache associé à un fichier TLE, le reconstruit si besoin
+     * @param tlePath Fichier TLE source
+     * @param cachePath Fichier cache (défaut : tlePath + ".elset")
+     * @return true si des éléments sont disponibles
+     */
+    bool open(const QString& tlePath, const QString& cachePath = QString());
+
+    /**
+     * @brief Libère la projection mémoire
+     */
+    void close();
+
+    /**
+     * @brief Écrit un cache pour des éléments déjà parsés
+     * @param cachePath Fichier cache à écrire
+     * @param tlePath Fichier TLE source (pour la signature)
+     * @param elements Jeux d'éléments
+     * @return true si l'écriture réussit
+     */
+    static bool write(const QString& cachePath, const QString& tlePath,
+                      const QVector<ElementSet>& elements);
+
+    // Getters
+    const ElementSet* data() const { return m_data; }
+    const ElementSet& at(int index) const { return m_data[index]; }
+    int size() const { return m_count; }
+    bool isEmpty() const { return m_count == 0; }
+
+    /**
+     * @brief Indique si le dernier open() a dû reparser le fichier TLE
+     */
+    bool wasRebuilt() const { return m_rebuilt; }
+
+private:
+    Q_DISABLE_COPY(ElementSetCache)
+
+    QFile m_file;                      // Fichier cache projeté
+    uchar* m_mapped = nullptr;
+    const ElementSet* m_data = nullptr;
+    int m_count = 0;
+    bool m_rebuilt = false;
+
+    // Éléments en mémoire si le cache ne peut pas être écrit
+    QVector<ElementSet> m_fallback;
+
+    /**
+     * @brief Projette un cache et valide son en-tête face au fichier source
+     * @param verifyPayload Vérifie aussi le checksum des ElementSet (lit toutes les pages)
+     */
+    bool mapCache(const QString& cachePath, const QString& tlePath, bool verifyPayload);
+};
+
+#endif // ELEMENTSETCACHE_H
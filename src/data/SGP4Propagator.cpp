@@ -1,15 +1,27 @@
 #include "SGP4Propagator.h"
+#include "TLECatalog.h"
+#include "../simulation/Frames.h"
 #include <QtMath>
 #include <QDebug>
+#include <cmath>
+
+#include "DecayedException.h"
 
 // Constantes physiques
 const double EARTH_RADIUS_KM = 6371.0;
 
+// Date julienne de l'époque Unix (1970-01-01 00:00 UTC)
+const double JD_UNIX_EPOCH = 2440587.5;
+const double MINUTES_PER_DAY = 1440.0;
+
 SGP4Propagator::SGP4Propagator(QObject *parent)
     : QObject(parent)
     , m_initialized(false)
     , m_sgp4(nullptr)
     , m_tleObj(nullptr)
+    , m_epochJulian(0.0)
+    , m_epochUnixMicroseconds(0)
+    , m_lastStatus(SGP4Status::Ok)
 {
 }
 
@@ -44,8 +56,30 @@ bool SGP4Propagator::initialize(const TLEData& tle)
         m_tleObj = new libsgp4::Tle(name, line1, line2);
         m_sgp4 = new libsgp4::SGP4(*m_tleObj);
 
+        // Époque exacte (microseconde) de libsgp4, pour les conversions numériques
+        libsgp4::DateTime epoch = m_tleObj->Epoch();
+        m_epochJulian = epoch.ToJulian();
+        m_epochUnixMicroseconds = epoch.Ticks() - libsgp4::DateTime(1970, 1, 1, 0, 0, 0, 0).Ticks();
+
+        // Proche Terre : constantes du noyau SGP4Kernel (chemin sans exception)
+        m_kernel.clear();
+        QByteArray text = (tle.line1 + '\n' + tle.line2 + '\n').toLatin1();
+        QVector<ElementSet> sets;
+        QVector<TLECatalogError> errors;
+        TLECatalog::parseRange(text.constData(), text.constData() + text.size(), 1, sets, errors);
+        if (sets.size() == 1 && !SGP4Kernel::isDeepSpace(sets[0])) {
+            m_kernel.resize(1);
+            if (SGP4Kernel::initialize(sets[0], m_kernel, 0) != SGP4Status::Ok) {
+                m_kernel.clear();
+            }
+        }
+        m_lastStatus.store(SGP4Status::Ok, std::memory_order_relaxed);
+
         m_initialized = true;
 
+        // État initial à l'époque (altitude et vitesse réelles, pas d'estimation circulaire)
+        updateState(0.0);
+
         qDebug() << "✅ SGP4 (libsgp4) initialisé pour:" << m_satelliteName;
         qDebug() << "   Altitude:" << tle.altitude << "km";
         qDebug() << "   Inclinaison:" << tle.inclination << "°";
@@ -73,131 +107,229 @@ void SGP4Propagator::setSatelliteName(const QString& name)
 double SGP4Propagator::altitude() const
 {
     if (!m_initialized) return 0.0;
-    return m_tle.altitude;
+    return m_state.position.length() - EARTH_RADIUS_KM;
 }
 
 double SGP4Propagator::velocity() const
 {
     if (!m_initialized) return 0.0;
-
-    // Vitesse orbitale circulaire : v = sqrt(μ/r)
-    const double MU = 398600.4418;  // km³/s²
-    double r = m_tle.semiMajorAxis;
-    return qSqrt(MU / r);
+    return m_state.velocity.length();
 }
 
-libsgp4::DateTime SGP4Propagator::qDateTimeToSGP4(const QDateTime& dt) const
+bool SGP4Propagator::updateState(double minutesSinceEpoch)
 {
-    QDateTime utc = dt.toUTC();
+    SatelliteState state;
+    if (!propagateState(minutesSinceEpoch, state)) {
+        return false;
+    }
 
-    int year = utc.date().year();
-    int month = utc.date().month();
-    int day = utc.date().day();
-    int hour = utc.time().hour();
-    int minute = utc.time().minute();
-    int second = utc.time().second();
-    int microsecond = utc.time().msec() * 1000;
+    m_state = state;
+    emit positionChanged();
+    return true;
+}
 
-    return libsgp4::DateTime(year, month, day, hour, minute, second, microsecond);
+double SGP4Propagator::toJulian(const QDateTime& dateTime)
+{
+    return dateTime.toMSecsSinceEpoch() / 86400000.0 + JD_UNIX_EPOCH;
+}
+
+QDateTime SGP4Propagator::fromJulian(double julianDate)
+{
+    return QDateTime::fromMSecsSinceEpoch(qint64(std::llround((julianDate - JD_UNIX_EPOCH) * 86400000.0)), Qt::UTC);
 }
 
 double SGP4Propagator::minutesSinceEpoch(const QDateTime& dateTime) const
 {
-    qint64 msecsSinceEpoch = m_tle.epoch.msecsTo(dateTime);
-    return msecsSinceEpoch / 60000.0;
+    // Écart entier en microsecondes : pas de perte de précision
+    qint64 microseconds = dateTime.toMSecsSinceEpoch() * 1000 - m_epochUnixMicroseconds;
+    return microseconds / 60000000.0;
 }
 
-QVector3D SGP4Propagator::getPositionECI(const QDateTime& dateTime) const
+SGP4Status::Code SGP4Propagator::computeState(double minutesSinceEpoch, QVector3D& position,
+                                              QVector3D* velocity, QVector3D* acceleration) const
 {
-    if (!m_initialized || !m_tleObj || !m_sgp4) {
-        qWarning() << "❌ SGP4 non initialisé correctement";
+    double p[3], v[3], a[3];
+    const SGP4Status::Code status = computeState(minutesSinceEpoch, p,
+                                                 velocity ? v : nullptr,
+                                                 acceleration ? a : nullptr);
+    if (status != SGP4Status::Ok) {
+        return status;
+    }
 
-        // Fallback sur calcul simplifié
-        double secondsSince = minutesSinceEpoch(dateTime) * 60.0;
-        return getPositionAtTime(secondsSince);
+    position = QVector3D(p[0], p[1], p[2]);
+    if (velocity) {
+        *velocity = QVector3D(v[0], v[1], v[2]);
     }
+    if (acceleration) {
+        *acceleration = QVector3D(a[0], a[1], a[2]);
+    }
+    return SGP4Status::Ok;
+}
 
-    try {
-        // Convertir QDateTime vers DateTime de libsgp4
-        libsgp4::DateTime sgp4Time = qDateTimeToSGP4(dateTime);
+SGP4Status::Code SGP4Propagator::computeState(double minutesSinceEpoch, double* position,
+                                              double* velocity, double* acceleration) const
+{
+    if (!m_initialized || !m_sgp4) {
+        return SGP4Status::NotInitialized;
+    }
 
-        // Propager avec SGP4
-        libsgp4::Eci eci = m_sgp4->FindPosition(sgp4Time);
+    // === PROCHE TERRE : noyau à codes d'erreur ===
+    if (m_kernel.size() == 1) {
+        double x, y, z, vx, vy, vz;
+        quint8 status;
+        SGP4StateArrays state{ &x, &y, &z, &vx, &vy, &vz, &status };
+        SGP4Kernel::propagateScalar(m_kernel, 0, 1, m_kernel.epoch[0] + minutesSinceEpoch / MINUTES_PER_DAY, state);
 
-        // Extraire la position
-        libsgp4::Vector pos = eci.Position();
+        if (status != SGP4Status::Ok) {
+            return static_cast<SGP4Status::Code>(status);
+        }
+
+        position[0] = x;
+        position[1] = y;
+        position[2] = z;
+        if (velocity) {
+            velocity[0] = vx;
+            velocity[1] = vy;
+            velocity[2] = vz;
+        }
+        if (acceleration) {
+            SGP4Kernel::gravityAcceleration(x, y, z, acceleration[0], acceleration[1], acceleration[2]);
+        }
+        return SGP4Status::Ok;
+    }
 
-        return QVector3D(pos.x, pos.y, pos.z);
+    // === ESPACE LOINTAIN : libsgp4, exceptions converties en code ===
+    try {
+        libsgp4::Eci eci = m_sgp4->FindPosition(minutesSinceEpoch);
 
-    } catch (const std::exception& e) {
-        qWarning() << "❌ Erreur propagation SGP4:" << e.what();
-        emit const_cast<SGP4Propagator*>(this)->propagationError(QString(e.what()));
-        return QVector3D(0, 0, 0);
+        libsgp4::Vector pos = eci.Position();
+        position[0] = pos.x;
+        position[1] = pos.y;
+        position[2] = pos.z;
+
+        if (velocity) {
+            libsgp4::Vector vel = eci.Velocity();
+            velocity[0] = vel.x;
+            velocity[1] = vel.y;
+            velocity[2] = vel.z;
+        }
+        if (acceleration) {
+            SGP4Kernel::gravityAcceleration(pos.x, pos.y, pos.z,
+                                            acceleration[0], acceleration[1], acceleration[2]);
+        }
+        return SGP4Status::Ok;
+
+    } catch (const libsgp4::DecayedException&) {
+        return SGP4Status::Decayed;
+    } catch (const std::exception&) {
+        return SGP4Status::InvalidElements;
     }
 }
 
-QVector3D SGP4Propagator::getPositionAtTime(double secondsSinceEpoch) const
+bool SGP4Propagator::findPosition(double minutesSinceEpoch, QVector3D& position, QVector3D* velocity,
+                                  QVector3D* acceleration) const
 {
-    if (!m_initialized) {
-        return QVector3D(0, 0, 0);
+    const SGP4Status::Code status = computeState(minutesSinceEpoch, position, velocity, acceleration);
+
+    // Signalement au changement d'état uniquement (pas de tempête de logs/signaux) ;
+    // exchange() : un seul thread signale une transition donnée
+    if (m_lastStatus.load(std::memory_order_relaxed) != status
+        && m_lastStatus.exchange(status, std::memory_order_relaxed) != status) {
+        if (status != SGP4Status::Ok) {
+            QString message = QString("%1 : %2").arg(m_satelliteName, SGP4Status::name(status));
+            qWarning() << "❌ Erreur propagation SGP4:" << message;
+            emit const_cast<SGP4Propagator*>(this)->propagationError(message);
+        }
     }
 
-    // Calculer la date/heure correspondante
-    QDateTime targetTime = m_tle.epoch.addSecs(static_cast<qint64>(secondsSinceEpoch));
+    return status == SGP4Status::Ok;
+}
+
+QVector3D SGP4Propagator::getPositionECI(const QDateTime& dateTime) const
+{
+    return getPositionAtMinutes(minutesSinceEpoch(dateTime));
+}
 
-    return getPositionECI(targetTime);
+QVector3D SGP4Propagator::getPositionAtTime(double secondsSinceEpoch) const
+{
+    return getPositionAtMinutes(secondsSinceEpoch / 60.0);
 }
 
-bool SGP4Propagator::propagate(const QDateTime& dateTime, QVector3D& position, QVector3D& velocity) const
+QVector3D SGP4Propagator::getPositionAtMinutes(double minutesSinceEpoch) const
 {
-    if (!m_initialized) {
-        emit const_cast<SGP4Propagator*>(this)->propagationError("SGP4 non initialisé");
-        return false;
+    QVector3D position;
+    if (!findPosition(minutesSinceEpoch, position, nullptr)) {
+        return QVector3D(0, 0, 0);
     }
+    return position;
+}
 
-    if (!m_tleObj || !m_sgp4) {
-        // Fallback : calcul position uniquement
-        position = getPositionECI(dateTime);
+QVector3D SGP4Propagator::getPositionAtJulian(double julianDate) const
+{
+    return getPositionAtMinutes((julianDate - m_epochJulian) * MINUTES_PER_DAY);
+}
 
-        // Vitesse par différence finie
-        QDateTime dt1 = dateTime.addSecs(1);
-        QVector3D pos1 = getPositionECI(dt1);
-        velocity = pos1 - position;
+bool SGP4Propagator::propagate(const QDateTime& dateTime, QVector3D& position, QVector3D& velocity) const
+{
+    return propagateMinutes(minutesSinceEpoch(dateTime), position, velocity);
+}
 
-        return true;
-    }
+bool SGP4Propagator::propagateMinutes(double minutesSinceEpoch, QVector3D& position, QVector3D& velocity) const
+{
+    return findPosition(minutesSinceEpoch, position, &velocity);
+}
 
-    try {
-        libsgp4::DateTime sgp4Time = qDateTimeToSGP4(dateTime);
-        libsgp4::Eci eci = m_sgp4->FindPosition(sgp4Time);
+bool SGP4Propagator::propagateState(double minutesSinceEpoch, SatelliteState& state) const
+{
+    return findPosition(minutesSinceEpoch, state.position, &state.velocity, &state.acceleration);
+}
 
-        libsgp4::Vector pos = eci.Position();
-        libsgp4::Vector vel = eci.Velocity();
+bool SGP4Propagator::propagateJulian(double julianDate, QVector3D& position, QVector3D& velocity) const
+{
+    return propagateMinutes((julianDate - m_epochJulian) * MINUTES_PER_DAY, position, velocity);
+}
 
-        position = QVector3D(pos.x, pos.y, pos.z);
-        velocity = QVector3D(vel.x, vel.y, vel.z);
+int SGP4Propagator::propagateSeries(double startJulian, double stepSeconds, int count,
+                                    QVector3D* positions, QVector3D* velocities) const
+{
+    // Une seule conversion pour toute la série, puis simple incrément
+    const double startMinutes = (startJulian - m_epochJulian) * MINUTES_PER_DAY;
+    const double stepMinutes = stepSeconds / 60.0;
+
+    for (int i = 0; i < count; ++i) {
+        if (!findPosition(startMinutes + i * stepMinutes, positions[i],
+                          velocities ? &velocities[i] : nullptr)) {
+            return i;
+        }
+    }
+    return count;
+}
 
-        return true;
+int SGP4Propagator::propagateSeries(double startJulian, double stepSeconds, int count,
+                                    SatelliteState* states) const
+{
+    const double startMinutes = (startJulian - m_epochJulian) * MINUTES_PER_DAY;
+    const double stepMinutes = stepSeconds / 60.0;
 
-    } catch (const std::exception& e) {
-        qWarning() << "❌ Erreur propagation:" << e.what();
-        emit const_cast<SGP4Propagator*>(this)->propagationError(QString(e.what()));
-        return false;
+    for (int i = 0; i < count; ++i) {
+        if (!propagateState(startMinutes + i * stepMinutes, states[i])) {
+            return i;
+        }
     }
+    return count;
 }
 
-QVector3D SGP4Propagator::eciToDisplay(const QVector3D& eci, double scale)
+QVector<QVector3D> SGP4Propagator::getPositionSeries(double startJulian, double stepSeconds, int count) const
 {
-    // ECI est en kilomètres, centré sur la Terre
-    // Conversion pour Qt Quick 3D où la Terre a scale=3
-
-    // Si Terre scale=3 et rayon réel=6371 km
-    // alors 1 unité Qt = 6371/3 = 2123.67 km
-    double qtUnitToKm = EARTH_RADIUS_KM / 3.0;
+    QVector<QVector3D> positions(qMax(count, 0));
+    int computed = propagateSeries(startJulian, stepSeconds, positions.size(), positions.data());
+    positions.resize(computed);
+    return positions;
+}
 
-    return QVector3D(
-        eci.x() / qtUnitToKm * scale,
-        eci.y() / qtUnitToKm * scale,
-        eci.z() / qtUnitToKm * scale
-        );
+QVector3D SGP4Propagator::eciToDisplay(const QVector3D& eci, double scale)
+{
+    // Même repère que la Terre de la scène, qui tourne du temps sidéral :
+    // pôle nord vers y, 150 unités pour 6371 km
+    return Frames::temeToScene(eci, float(Frames::SCENE_UNITS_PER_KM * scale));
 }
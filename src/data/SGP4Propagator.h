@@ -3,8 +3,11 @@
 
 #include <QObject>
 #include <QVector3D>
+#include <QVector>
 #include <QDateTime>
+#include <atomic>
 #include "TLEParser.h"
+#include "../propagation/SGP4Kernel.h"
 
 // Includes complets de libsgp4
 #include "SGP4.h"
@@ -12,11 +15,27 @@
 #include "DateTime.h"
 #include "Eci.h"
 
+/**
+ * @brief État complet d'un satellite, issu d'une seule propagation (repère TEME)
+ */
+struct SatelliteState {
+    QVector3D position;         // km
+    QVector3D velocity;         // km/s (analytique SGP4)
+    QVector3D acceleration;     // km/s² (gravité centrale + J2 à la position)
+};
+
 /**
  * @brief Wrapper Qt-friendly pour libsgp4
  *
  * Propage les orbites satellites à partir des éléments TLE
  * en utilisant la vraie bibliothèque SGP4 (précision sub-kilométrique)
+ *
+ * Threads : les variantes const (computeState(), getPosition*(),
+ * propagate*()) peuvent être appelées depuis plusieurs threads pour un
+ * satellite proche Terre ; le dernier code signalé est atomique et
+ * propagationError() est alors émis depuis le thread appelant. En espace
+ * lointain, l'objet libsgp4 garde un état d'intégration mutable : un
+ * thread de calcul utilise son propre propagateur (ou BatchPropagator).
  */
 class SGP4Propagator : public QObject
 {
@@ -60,6 +79,112 @@ public:
      */
     bool propagate(const QDateTime& dateTime, QVector3D& position, QVector3D& velocity) const;
 
+    /**
+     * @brief Propagation sans exception, sans log ni signal
+     *
+     * Satellites proche Terre : noyau SGP4Kernel (codes d'erreur natifs).
+     * Espace lointain : libsgp4, exceptions converties en code.
+     * @param minutesSinceEpoch Minutes depuis l'époque TLE
+     * @param position [out] Position ECI (km), inchangée en cas d'échec
+     * @param velocity [out] Vitesse ECI (km/s), ou nullptr
+     * @return SGP4Status::Ok ou la cause de l'échec
+     */
+    SGP4Status::Code computeState(double minutesSinceEpoch, QVector3D& position,
+                                  QVector3D* velocity = nullptr,
+                                  QVector3D* acceleration = nullptr) const;
+
+    /**
+     * @brief Variante double précision de computeState()
+     *
+     * QVector3D (float) arrondit à ~4 m au rayon géostationnaire : les
+     * consommateurs qui interpolent (EphemerisCache) gardent les doubles.
+     * @param position [out] x, y, z ECI (km), inchangés en cas d'échec
+     * @param velocity [out] vx, vy, vz (km/s), ou nullptr
+     * @param acceleration [out] ax, ay, az (km/s²), ou nullptr
+     */
+    SGP4Status::Code computeState(double minutesSinceEpoch, double* position,
+                                  double* velocity = nullptr,
+                                  double* acceleration = nullptr) const;
+
+    /**
+     * @brief État complet (position, vitesse, accélération) en une propagation
+     */
+    bool propagateState(double minutesSinceEpoch, SatelliteState& state) const;
+
+    /**
+     * @brief Met à jour l'état courant (propriétés altitude/velocity)
+     * @param minutesSinceEpoch Minutes depuis l'époque TLE
+     * @return true si la propagation réussit (positionChanged émis)
+     */
+    Q_INVOKABLE bool updateState(double minutesSinceEpoch);
+
+    /**
+     * @brief Dernier état calculé par updateState() (à l'époque après initialize())
+     */
+    const SatelliteState& currentState() const { return m_state; }
+
+    // === Temps numérique : aucune conversion calendaire par échantillon ===
+
+    /**
+     * @brief Calcule la position à un instant exprimé en minutes depuis l'époque TLE
+     * @param minutesSinceEpoch Minutes depuis l'époque (fractions conservées)
+     * @return Position ECI en km
+     */
+    Q_INVOKABLE QVector3D getPositionAtMinutes(double minutesSinceEpoch) const;
+
+    /**
+     * @brief Calcule la position à une date julienne (UTC)
+     */
+    Q_INVOKABLE QVector3D getPositionAtJulian(double julianDate) const;
+
+    /**
+     * @brief Calcule position ET vitesse en minutes depuis l'époque TLE
+     */
+    bool propagateMinutes(double minutesSinceEpoch, QVector3D& position, QVector3D& velocity) const;
+
+    /**
+     * @brief Calcule position ET vitesse à une date julienne (UTC)
+     */
+    bool propagateJulian(double julianDate, QVector3D& position, QVector3D& velocity) const;
+
+    /**
+     * @brief Propage une série temporelle régulière
+     * @param startJulian Premier instant (date julienne UTC)
+     * @param stepSeconds Pas entre deux échantillons (secondes)
+     * @param count Nombre d'échantillons
+     * @param positions [out] count positions ECI (km)
+     * @param velocities [out] count vitesses ECI (km/s), ou nullptr
+     * @return Nombre d'échantillons calculés (arrêt au premier échec)
+     */
+    int propagateSeries(double startJulian, double stepSeconds, int count,
+                        QVector3D* positions, QVector3D* velocities = nullptr) const;
+
+    /**
+     * @brief Variante de propagateSeries() produisant l'état complet
+     */
+    int propagateSeries(double startJulian, double stepSeconds, int count,
+                        SatelliteState* states) const;
+
+    /**
+     * @brief Variante de propagateSeries() renvoyant les positions
+     */
+    QVector<QVector3D> getPositionSeries(double startJulian, double stepSeconds, int count) const;
+
+    /**
+     * @brief Époque du TLE en date julienne (UTC)
+     */
+    double epochJulian() const { return m_epochJulian; }
+
+    /**
+     * @brief Convertit une date Qt en date julienne (UTC), à la milliseconde
+     */
+    static double toJulian(const QDateTime& dateTime);
+
+    /**
+     * @brief Convertit une date julienne (UTC) en date Qt, à la milliseconde
+     */
+    static QDateTime fromJulian(double julianDate);
+
     /**
      * @brief Vérifie si le propagateur est initialisé
      */
@@ -67,16 +192,17 @@ public:
 
     /**
      * @brief Convertit ECI vers coordonnées pour affichage Qt Quick 3D
-     * @param eci Position en coordonnées ECI (km)
+     * @param eci Position en coordonnées ECI (km, repère TEME)
      * @param scale Facteur d'échelle pour l'affichage (défaut: 1.0)
-     * @return Position adaptée pour Qt Quick 3D
+     * @return Position dans la racine de la scène (Frames::temeToScene) ;
+     *         pour un lot de positions, utiliser Frames directement
      */
     static QVector3D eciToDisplay(const QVector3D& eci, double scale = 1.0);
 
     // Getters
     QString satelliteName() const { return m_satelliteName; }
-    double altitude() const;
-    double velocity() const;
+    double altitude() const;    // Altitude géocentrique courante (km)
+    double velocity() const;    // Norme de la vitesse courante (km/s)
     const TLEData& tleData() const { return m_tle; }
 
     // Setters
@@ -96,15 +222,30 @@ private:
     libsgp4::SGP4* m_sgp4;
     libsgp4::Tle* m_tleObj;
 
-    /**
-     * @brief Convertit QDateTime vers DateTime de libsgp4
-     */
-    libsgp4::DateTime qDateTimeToSGP4(const QDateTime& dt) const;
+    // Époque TLE, calculée une fois à l'initialisation
+    double m_epochJulian;
+    qint64 m_epochUnixMicroseconds;
+
+    // Constantes SGP4 proche Terre (vide en espace lointain)
+    SGP4Batch m_kernel;
+
+    // Dernier code signalé : un log/signal par changement d'état, pas par appel
+    mutable std::atomic<quint8> m_lastStatus;
+
+    // État courant (propriétés QML)
+    SatelliteState m_state;
 
     /**
      * @brief Calcule le temps en minutes depuis l'époque TLE
      */
     double minutesSinceEpoch(const QDateTime& dateTime) const;
+
+    /**
+     * @brief computeState() + signalement des erreurs, commun aux variantes bool/QVector3D
+     * @param velocity [out] Vitesse, ou nullptr
+     */
+    bool findPosition(double minutesSinceEpoch, QVector3D& position, QVector3D* velocity,
+                      QVector3D* acceleration = nullptr) const;
 };
 
 #endif // SGP4PROPAGATOR_H
@@ -0,0 +1,687 @@
+#include "TLECatalog.h"
+#include "TLEParser.h"
+#include <QFile>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QThreadPool>
+#include <QtMath>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Constantes physiques (identiques à TLEParser)
+const double MU = 398600.4418;               // Constante gravitationnelle (km³/s²)
+const double MINUTES_PER_DAY = 1440.0;       // Minutes dans une journée
+
+// En dessous de cette taille, le découpage ne vaut pas le coût des threads
+const qint64 PARALLEL_MIN_BYTES = 256 * 1024;
+
+// Morceaux par thread : équilibre la charge quand les lignes varient
+const int CHUNKS_PER_THREAD = 4;
+
+namespace {
+
+// Puissances de 10 exactes en double (jusqu'à 10^22)
+const double POW10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * @brief Vue sur une ligne du tampon (sans copie)
+ */
+struct LineView {
+    const char* data;
+    int length;
+    qint64 number;
+};
+
+/**
+ * @brief Avance jusqu'à la fin de ligne suivante
+ * @return false si la fin du tampon est atteinte
+ */
+bool nextLine(const char*& cursor, const char* end, qint64& lineNumber, LineView& line)
+{
+    if (cursor >= end) {
+        return false;
+    }
+
+    const char* start = cursor;
+    const char* eol = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+    if (!eol) {
+        eol = end;
+    }
+    cursor = (eol < end) ? eol + 1 : end;
+
+    // Retire '\r' et les espaces de fin
+    const char* last = eol;
+    while (last > start && (last[-1] == '\r' || last[-1] == ' ' || last[-1] == '\t')) {
+        --last;
+    }
+
+    line.data = start;
+    line.length = static_cast<int>(last - start);
+    line.number = lineNumber++;
+    return true;
+}
+
+bool isDataLine(const LineView& line, char number)
+{
+    return line.length >= 2 && line.data[0] == number && line.data[1] == ' ';
+}
+
+/**
+ * @brief Lit un entier à colonnes fixes (espaces de tête tolérés)
+ */
+bool parseInt(const char* p, int length, int& out)
+{
+    int i = 0;
+    while (i < length && p[i] == ' ') {
+        ++i;
+    }
+
+    bool negative = false;
+    if (i < length && (p[i] == '-' || p[i] == '+')) {
+        negative = (p[i] == '-');
+        ++i;
+    }
+
+    if (i == length) {
+        // Champ vide : 0 (ex. numéro de jeu d'éléments absent)
+        out = 0;
+        return true;
+    }
+
+    int value = 0;
+    for (; i < length; ++i) {
+        char c = p[i];
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        value = value * 10 + (c - '0');
+    }
+
+    out = negative ? -value : value;
+    return true;
+}
+
+/**
+ * @brief Lit un numéro NORAD, y compris au format Alpha-5 (ex. "A0000" = 100000)
+ */
+bool parseCatalogNumber(const char* p, int& out)
+{
+    char first = p[0];
+    if (first >= 'A' && first <= 'Z' && first != 'I' && first != 'O') {
+        // Alpha-5 : I et O sont exclus de l'alphabet
+        int letter = first - 'A';
+        if (first > 'I') --letter;
+        if (first > 'O') --letter;
+
+        int rest;
+        if (!parseInt(p + 1, 4, rest)) {
+            return false;
+        }
+        out = (10 + letter) * 10000 + rest;
+        return true;
+    }
+    return parseInt(p, 5, out);
+}
+
+/**
+ * @brief Lit un réel à virgule fixe (ex. " 51.6336", "-.00010237")
+ *
+ * La mantisse est accumulée en entier puis divisée par une puissance de 10
+ * exacte : le résultat est correctement arrondi, comme QString::toDouble().
+ */
+bool parseFixed(const char* p, int length, double& out)
+{
+    int i = 0;
+    while (i < length && p[i] == ' ') {
+        ++i;
+    }
+
+    bool negative = false;
+    if (i < length && (p[i] == '-' || p[i] == '+')) {
+        negative = (p[i] == '-');
+        ++i;
+    }
+
+    quint64 mantissa = 0;
+    int digits = 0;
+    int decimals = -1;  // -1 tant que le point n'a pas été rencontré
+
+    for (; i < length; ++i) {
+        char c = p[i];
+        if (c >= '0' && c <= '9') {
+            mantissa = mantissa * 10 + static_cast<quint64>(c - '0');
+            ++digits;
+            if (decimals >= 0) ++decimals;
+        } else if (c == '.' && decimals < 0) {
+            decimals = 0;
+        } else if (c == ' ') {
+            break;
+        } else {
+            return false;
+        }
+    }
+
+    // Seuls des espaces peuvent suivre le nombre
+    for (; i < length; ++i) {
+        if (p[i] != ' ') {
+            return false;
+        }
+    }
+
+    if (digits == 0 || digits > 18) {
+        return false;
+    }
+
+    double value = static_cast<double>(mantissa);
+    if (decimals > 0) {
+        value /= POW10[decimals];
+    }
+
+    out = negative ? -value : value;
+    return true;
+}
+
+/**
+ * @brief Lit la notation scientifique compacte du TLE
+ * Exemple : " 12345-3" = 0.12345 × 10^-3
+ */
+bool parseCompactExponent(const char* p, int length, double& out)
+{
+    int i = 0;
+    while (i < length && p[i] == ' ') {
+        ++i;
+    }
+    if (i == length) {
+        out = 0.0;
+        return true;
+    }
+
+    bool negative = false;
+    if (p[i] == '-' || p[i] == '+') {
+        negative = (p[i] == '-');
+        ++i;
+    }
+    if (i < length && p[i] == '.') {
+        ++i;  // Point décimal explicite toléré
+    }
+
+    quint64 mantissa = 0;
+    int digits = 0;
+    while (i < length && p[i] >= '0' && p[i] <= '9') {
+        mantissa = mantissa * 10 + static_cast<quint64>(p[i] - '0');
+        ++digits;
+        ++i;
+    }
+
+    if (digits == 0 || digits > 18) {
+        return false;
+    }
+
+    int exponent = 0;
+    if (i < length && (p[i] == '-' || p[i] == '+')) {
+        bool expNegative = (p[i] == '-');
+        ++i;
+        if (i >= length || p[i] < '0' || p[i] > '9') {
+            return false;
+        }
+        exponent = p[i] - '0';
+        if (expNegative) exponent = -exponent;
+        ++i;
+    }
+
+    for (; i < length; ++i) {
+        if (p[i] != ' ') {
+            return false;
+        }
+    }
+
+    // Valeur = 0.mantisse × 10^exp = mantisse × 10^(exp - digits)
+    int shift = exponent - digits;
+    double value = static_cast<double>(mantissa);
+    if (shift < 0) {
+        value /= POW10[-shift];
+    } else {
+        value *= POW10[shift];
+    }
+
+    out = negative ? -value : value;
+    return true;
+}
+
+/**
+ * @brief Copie un champ texte en retirant les espaces de bord
+ */
+void copyTrimmed(char* dest, int capacity, const char* src, int length)
+{
+    while (length > 0 && src[0] == ' ') {
+        ++src;
+        --length;
+    }
+    while (length > 0 && src[length - 1] == ' ') {
+        --length;
+    }
+    if (length > capacity - 1) {
+        length = capacity - 1;
+    }
+    std::memcpy(dest, src, static_cast<size_t>(length));
+    dest[length] = '\0';
+}
+
+/**
+ * @brief Parse une paire de lignes 1/2 (et le nom éventuel)
+ * @return true si le jeu d'éléments est valide
+ */
+bool parseRecord(const LineView* name, const LineView& line1, const LineView& line2,
+                 ElementSet& set, QVector<TLECatalogError>& errors)
+{
+    auto fail = [&errors](qint64 lineNumber, TLECatalogError::Code code, int column) {
+        errors.append(TLECatalogError{lineNumber, code, column});
+        return false;
+    };
+
+    if (line1.length < 69) {
+        return fail(line1.number, TLECatalogError::LineTooShort, 0);
+    }
+    if (line2.length < 69) {
+        return fail(line2.number, TLECatalogError::LineTooShort, 0);
+    }
+
+    // Vérification des checksums
+    if (!TLEParser::verifyChecksum(line1.data, line1.length)) {
+        return fail(line1.number, TLECatalogError::ChecksumLine1, 69);
+    }
+    if (!TLEParser::verifyChecksum(line2.data, line2.length)) {
+        return fail(line2.number, TLECatalogError::ChecksumLine2, 69);
+    }
+
+    const char* l1 = line1.data;
+    const char* l2 = line2.data;
+
+    // === PARSING LIGNE 1 ===
+
+    int norad1;
+    int norad2;
+    if (!parseCatalogNumber(l1 + 2, norad1)) {
+        return fail(line1.number, TLECatalogError::InvalidField, 3);
+    }
+    if (!parseCatalogNumber(l2 + 2, norad2)) {
+        return fail(line2.number, TLECatalogError::InvalidField, 3);
+    }
+    if (norad1 != norad2) {
+        return fail(line2.number, TLECatalogError::NoradMismatch, 3);
+    }
+    set.noradId = norad1;
+
+    copyTrimmed(set.internationalDesignator, sizeof(set.internationalDesignator), l1 + 9, 8);
+
+    // Époque (colonnes 19-32) : 00-56 = 2000-2056, 57-99 = 1957-1999
+    int epochYearShort;
+    if (!parseInt(l1 + 18, 2, epochYearShort)) {
+        return fail(line1.number, TLECatalogError::InvalidField, 19);
+    }
+    set.epochYear = (epochYearShort < 57) ? 2000 + epochYearShort : 1900 + epochYearShort;
+
+    if (!parseFixed(l1 + 20, 12, set.epochDay)) {
+        return fail(line1.number, TLECatalogError::InvalidField, 21);
+    }
+    if (!parseFixed(l1 + 33, 10, set.meanMotionDot)) {
+        return fail(line1.number, TLECatalogError::InvalidField, 34);
+    }
+    if (!parseCompactExponent(l1 + 44, 8, set.meanMotionDotDot)) {
+        return fail(line1.number, TLECatalogError::InvalidField, 45);
+    }
+    if (!parseCompactExponent(l1 + 53, 8, set.bstar)) {
+        return fail(line1.number, TLECatalogError::InvalidField, 54);
+    }
+    if (!parseInt(l1 + 64, 4, set.elementSetNumber)) {
+        return fail(line1.number, TLECatalogError::InvalidField, 65);
+    }
+
+    // === PARSING LIGNE 2 ===
+
+    if (!parseFixed(l2 + 8, 8, set.inclination)) {
+        return fail(line2.number, TLECatalogError::InvalidField, 9);
+    }
+    if (!parseFixed(l2 + 17, 8, set.raan)) {
+        return fail(line2.number, TLECatalogError::InvalidField, 18);
+    }
+
+    // Excentricité : point décimal implicite (0.xxxxxxx)
+    int eccRaw;
+    if (!parseInt(l2 + 26, 7, eccRaw) || eccRaw < 0) {
+        return fail(line2.number, TLECatalogError::InvalidField, 27);
+    }
+    set.eccentricity = eccRaw / 10000000.0;
+
+    if (!parseFixed(l2 + 34, 8, set.argOfPerigee)) {
+        return fail(line2.number, TLECatalogError::InvalidField, 35);
+    }
+    if (!parseFixed(l2 + 43, 8, set.meanAnomaly)) {
+        return fail(line2.number, TLECatalogError::InvalidField, 44);
+    }
+    if (!parseFixed(l2 + 52, 11, set.meanMotion) || set.meanMotion <= 0.0) {
+        return fail(line2.number, TLECatalogError::InvalidField, 53);
+    }
+    if (!parseInt(l2 + 63, 5, set.revolutionNumber)) {
+        return fail(line2.number, TLECatalogError::InvalidField, 64);
+    }
+
+    // === NOM (ligne 0, préfixe "0 " des fichiers 3LE Space-Track retiré) ===
+    if (name) {
+        const char* text = name->data;
+        int length = name->length;
+        if (length >= 2 && text[0] == '0' && text[1] == ' ') {
+            text += 2;
+            length -= 2;
+        }
+        copyTrimmed(set.name, sizeof(set.name), text, length);
+    } else {
+        set.name[0] = '\0';
+    }
+
+    // === PARAMÈTRES DÉRIVÉS (même calcul que TLEData, sans log) ===
+    set.period = MINUTES_PER_DAY / set.meanMotion;
+    double periodSeconds = set.period * 60.0;
+    set.semiMajorAxis = std::cbrt((MU * periodSeconds * periodSeconds) / (4.0 * M_PI * M_PI));
+
+    return true;
+}
+
+/**
+ * @brief Début de la ligne qui précède celle commençant en lineBegin
+ */
+const char* previousLineStart(const char* lineBegin, const char* begin)
+{
+    const char* p = lineBegin - 1;  // '\n' de la ligne précédente
+    while (p > begin && p[-1] != '\n') {
+        --p;
+    }
+    return p;
+}
+
+/**
+ * @brief Trouve le début d'enregistrement (ligne 0 ou ligne 1) suivant hint
+ *
+ * Un enregistrement commence par une ligne "1 " immédiatement suivie d'une
+ * ligne "2 ". Si la ligne non vide qui précède n'est pas une ligne de
+ * données, c'est le nom du satellite : le découpage se fait avant elle,
+ * comme le ferait le parsing séquentiel.
+ */
+const char* findRecordStart(const char* begin, const char* end, const char* hint)
+{
+    // Se placer au début de la ligne suivante
+    const char* cursor = hint;
+    if (cursor > begin && cursor[-1] != '\n') {
+        const char* eol = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+        cursor = eol ? eol + 1 : end;
+    }
+
+    qint64 unusedLineNumber = 0;
+    while (cursor < end) {
+        const char* lineBegin = cursor;
+        LineView line;
+        nextLine(cursor, end, unusedLineNumber, line);
+
+        if (!isDataLine(line, '1') || cursor >= end) {
+            continue;
+        }
+
+        const char* afterLine2 = cursor;
+        LineView line2;
+        nextLine(afterLine2, end, unusedLineNumber, line2);
+        if (!isDataLine(line2, '2')) {
+            continue;
+        }
+
+        // Remonter au nom éventuel en sautant les lignes vides
+        const char* recordStart = lineBegin;
+        const char* scan = lineBegin;
+        while (scan > begin) {
+            const char* prevBegin = previousLineStart(scan, begin);
+            const char* prevCursor = prevBegin;
+            LineView previous;
+            nextLine(prevCursor, end, unusedLineNumber, previous);
+
+            if (previous.length == 0) {
+                scan = prevBegin;
+                continue;
+            }
+            if (!isDataLine(previous, '1') && !isDataLine(previous, '2')) {
+                recordStart = prevBegin;
+            }
+            break;
+        }
+        return recordStart;
+    }
+
+    return end;
+}
+
+} // namespace
+
+double ElementSet::epochJulianDate() const
+{
+    // Date julienne du 1er janvier à 0h (formule valable 1901-2099),
+    // le jour TLE 1.0 correspondant au 1er janvier à 0h
+    double jan1 = 367.0 * epochYear - std::floor(7.0 * epochYear / 4.0) + 1721044.5;
+    return jan1 + epochDay - 1.0;
+}
+
+QString TLECatalogError::toString() const
+{
+    QString reason;
+    switch (code) {
+    case LineTooShort:  reason = "ligne trop courte (< 69 colonnes)"; break;
+    case ChecksumLine1: reason = "checksum invalide ligne 1"; break;
+    case ChecksumLine2: reason = "checksum invalide ligne 2"; break;
+    case NoradMismatch: reason = "numéros NORAD différents entre lignes 1 et 2"; break;
+    case InvalidField:  reason = QString("champ invalide colonne %1").arg(column); break;
+    case MissingLine2:  reason = "ligne 1 sans ligne 2"; break;
+    case OrphanLine2:   reason = "ligne 2 sans ligne 1"; break;
+    }
+    return QString("Ligne %1: %2").arg(lineNumber).arg(reason);
+}
+
+bool TLECatalog::load(const QString& path)
+{
+    clear();
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "❌ Impossible d'ouvrir le catalogue TLE:" << path;
+        return false;
+    }
+
+    const qint64 fileSize = file.size();
+    if (fileSize == 0) {
+        return true;
+    }
+
+    uchar* mapped = file.map(0, fileSize);
+    if (!mapped) {
+        qWarning() << "❌ Projection mémoire impossible:" << path << file.errorString();
+        return false;
+    }
+
+    parse(reinterpret_cast<const char*>(mapped), fileSize);
+    file.unmap(mapped);
+
+    qDebug() << "📡 Catalogue TLE chargé:" << m_elements.size() << "satellites en"
+             << QString::number(m_parseTimeMs, 'f', 2) << "ms"
+             << "(" << (m_threadCount > 0 ? m_threadCount : QThread::idealThreadCount()) << "threads max )";
+    if (!m_errors.isEmpty()) {
+        qWarning() << "⚠️" << m_errors.size() << "erreurs de parsing dans" << path
+                   << "(première:" << m_errors.first().toString() << ")";
+    }
+
+    return true;
+}
+
+void TLECatalog::parse(const char* data, qint64 size)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    m_elements.clear();
+    m_errors.clear();
+
+    int threads = (m_threadCount > 0) ? m_threadCount : QThread::idealThreadCount();
+
+    if (threads > 1 && size >= PARALLEL_MIN_BYTES) {
+        parseParallel(data, size, threads);
+    } else {
+        // Un enregistrement 3LE fait environ 165 octets
+        m_elements.reserve(static_cast<int>(size / 140) + 1);
+        parseRange(data, data + size, 1, m_elements, m_errors);
+    }
+
+    m_parseTimeMs = timer.nsecsElapsed() / 1.0e6;
+}
+
+void TLECatalog::parseParallel(const char* data, qint64 size, int threads)
+{
+    const char* end = data + size;
+
+    // === DÉCOUPAGE AUX FRONTIÈRES D'ENREGISTREMENTS ===
+    const int chunkTarget = threads * CHUNKS_PER_THREAD;
+    QVector<const char*> bounds;
+    bounds.reserve(chunkTarget + 1);
+    bounds.append(data);
+
+    for (int k = 1; k < chunkTarget; ++k) {
+        const char* hint = data + size * k / chunkTarget;
+        const char* start = findRecordStart(data, end, qMax(hint, bounds.last()));
+        if (start > bounds.last() && start < end) {
+            bounds.append(start);
+        }
+    }
+    bounds.append(end);
+
+    const int chunkCount = bounds.size() - 1;
+
+    struct Chunk {
+        QVector<ElementSet> elements;
+        QVector<TLECatalogError> errors;
+        qint64 lineCount = 0;
+        int firstElement = 0;
+    };
+    QVector<Chunk> chunks(chunkCount);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    // === PARSING DES MORCEAUX (numérotation des lignes relative) ===
+    for (int c = 0; c < chunkCount; ++c) {
+        pool.start([&chunks, &bounds, c]() {
+            Chunk& chunk = chunks[c];
+            qint64 bytes = bounds[c + 1] - bounds[c];
+            chunk.elements.reserve(static_cast<int>(bytes / 140) + 1);
+            chunk.lineCount = parseRange(bounds[c], bounds[c + 1], 1,
+                                         chunk.elements, chunk.errors);
+        });
+    }
+    pool.waitForDone();
+
+    // === FUSION DANS L'ORDRE DU FICHIER ===
+    int totalElements = 0;
+    qint64 lineOffset = 0;
+    for (Chunk& chunk : chunks) {
+        chunk.firstElement = totalElements;
+        totalElements += chunk.elements.size();
+
+        // Erreurs : numéros de ligne absolus, ordre du fichier
+        for (TLECatalogError error : chunk.errors) {
+            error.lineNumber += lineOffset;
+            m_errors.append(error);
+        }
+        lineOffset += chunk.lineCount;
+    }
+
+    m_elements.resize(totalElements);
+    ElementSet* output = m_elements.data();
+
+    for (int c = 0; c < chunkCount; ++c) {
+        pool.start([&chunks, output, c]() {
+            const Chunk& chunk = chunks[c];
+            std::copy(chunk.elements.constBegin(), chunk.elements.constEnd(),
+                      output + chunk.firstElement);
+        });
+    }
+    pool.waitForDone();
+}
+
+qint64 TLECatalog::parseRange(const char* begin, const char* end, qint64 firstLineNumber,
+                              QVector<ElementSet>& elements,
+                              QVector<TLECatalogError>& errors)
+{
+    const char* cursor = begin;
+    qint64 lineNumber = firstLineNumber;
+
+    LineView line;
+    LineView pendingName{nullptr, 0, 0};
+    bool hasName = false;
+
+    // Ligne lue en avance et à retraiter (ligne 1 non suivie d'une ligne 2)
+    LineView lookahead{nullptr, 0, 0};
+    bool hasLookahead = false;
+
+    for (;;) {
+        if (hasLookahead) {
+            line = lookahead;
+            hasLookahead = false;
+        } else if (!nextLine(cursor, end, lineNumber, line)) {
+            break;
+        }
+
+        if (line.length == 0) {
+            continue;
+        }
+
+        if (isDataLine(line, '1')) {
+            LineView line2;
+            if (!nextLine(cursor, end, lineNumber, line2)) {
+                errors.append(TLECatalogError{line.number, TLECatalogError::MissingLine2, 0});
+                break;
+            }
+
+            if (!isDataLine(line2, '2')) {
+                errors.append(TLECatalogError{line.number, TLECatalogError::MissingLine2, 0});
+                lookahead = line2;
+                hasLookahead = true;
+                hasName = false;
+                continue;
+            }
+
+            // Mise à zéro complète (octets de bourrage inclus) pour un contenu déterministe
+            ElementSet set;
+            std::memset(&set, 0, sizeof(set));
+            if (parseRecord(hasName ? &pendingName : nullptr, line, line2, set, errors)) {
+                elements.append(set);
+            }
+            hasName = false;
+
+        } else if (isDataLine(line, '2')) {
+            errors.append(TLECatalogError{line.number, TLECatalogError::OrphanLine2, 0});
+            hasName = false;
+
+        } else {
+            // Ligne 0 : nom du satellite (format 3LE)
+            pendingName = line;
+            hasName = true;
+        }
+    }
+
+    return lineNumber - firstLineNumber;
+}
+
+void TLECatalog::clear()
+{
+    m_elements.clear();
+    m_errors.clear();
+    m_parseTimeMs = 0.0;
+}
@@ -0,0 +1,155 @@
+#ifndef TLECATALOG_H
+#define TLECATALOG_H
+
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief Jeu d'éléments orbitaux compact (taille fixe, sans allocation)
+ *
+ * Équivalent POD de TLEData pour les catalogues complets : pas de QString
+ * ni de QDateTime, les éléments sont stockés dans un tableau contigu.
+ */
+struct ElementSet {
+    // === Époque ===
+    double epochDay;           // Jour de l'année (avec fraction)
+
+    // === Éléments orbitaux (Ligne 2) ===
+    double inclination;        // Inclinaison (degrés)
+    double raan;               // Ascension droite du nœud ascendant (degrés)
+    double eccentricity;       // Excentricité [0-1[
+    double argOfPerigee;       // Argument du périgée (degrés)
+    double meanAnomaly;        // Anomalie moyenne (degrés)
+    double meanMotion;         // Mouvement moyen (révolutions/jour)
+
+    // === Paramètres de perturbation (Ligne 1) ===
+    double bstar;              // Coefficient de traînée atmosphérique
+    double meanMotionDot;      // 1ère dérivée du mouvement moyen
+    double meanMotionDotDot;   // 2ème dérivée du mouvement moyen
+
+    // === Paramètres calculés ===
+    double period;             // Période orbitale (minutes)
+    double semiMajorAxis;      // Demi-grand axe (km)
+
+    // === Identification ===
+    qint32 noradId;            // Numéro NORAD
+    qint32 epochYear;          // Année complète de l'époque (ex. 2025)
+    qint32 revolutionNumber;   // Numéro de révolution à l'époque
+    qint32 elementSetNumber;   // Numéro du jeu d'éléments
+
+    char name[25];                     // Nom (24 caractères max, terminé par '\0')
+    char internationalDesignator[9];   // Désignation internationale (terminée par '\0')
+
+    /**
+     * @brief Époque des éléments en date julienne (UTC)
+     */
+    double epochJulianDate() const;
+};
+
+/**
+ * @brief Erreur de parsing rattachée à une ligne du fichier source
+ */
+struct TLECatalogError {
+    enum Code {
+        LineTooShort,       // Ligne 1 ou 2 de moins de 69 colonnes
+        ChecksumLine1,      // Checksum invalide sur la ligne 1
+        ChecksumLine2,      // Checksum invalide sur la ligne 2
+        NoradMismatch,      // Numéros NORAD différents entre lignes 1 et 2
+        InvalidField,       // Champ numérique illisible
+        MissingLine2,       // Ligne 1 non suivie d'une ligne 2
+        OrphanLine2         // Ligne 2 sans ligne 1
+    };
+
+    qint64 lineNumber;         // Numéro de ligne (à partir de 1)
+    Code code;
+    int column;                // Colonne du champ fautif (à partir de 1), 0 sinon
+
+    /**
+     * @brief Message lisible, construit uniquement à la demande
+     */
+    QString toString() const;
+};
+
+/**
+ * @brief Chargeur de catalogue TLE complet (2LE ou 3LE)
+ *
+ * Le fichier est projeté en mémoire (QFile::map) et les colonnes fixes
+ * sont lues directement depuis le tampon d'octets, sans QString
+ * intermédiaire. Les jeux d'éléments valides sont rangés dans un tableau
+ * contigu, les erreurs sont collectées ligne par ligne sans interrompre
+ * le chargement.
+ *
+ * Pour les gros catalogues, le tampon est découpé aux frontières
+ * d'enregistrements et les morceaux sont parsés en parallèle sur un pool
+ * de threads. Les résultats sont fusionnés dans l'ordre du fichier : les
+ * éléments et le rapport d'erreurs sont identiques au parsing séquentiel,
+ * quel que soit le nombre de threads.
+ */
+class TLECatalog
+{
+public:
+    TLECatalog() = default;
+
+    /**
+     * @brief Charge un fichier TLE par projection mémoire
+     * @param path Chemin du fichier (format CelesTrak 2LE ou 3LE)
+     * @return true si le fichier a pu être lu (même avec des erreurs de lignes)
+     */
+    bool load(const QString& path);
+
+    /**
+     * @brief Parse un tampon déjà en mémoire
+     * @param data Début du texte TLE
+     * @param size Taille en octets
+     */
+    void parse(const char* data, qint64 size);
+
+    /**
+     * @brief Parse une plage de texte et ajoute les résultats
+     * @param begin Début de la plage (doit commencer en début de ligne)
+     * @param end Fin de la plage
+     * @param firstLineNumber Numéro de la première ligne de la plage
+     * @param elements [out] Jeux d'éléments valides
+     * @param errors [out] Erreurs rencontrées
+     * @return Nombre de lignes lues dans la plage
+     */
+    static qint64 parseRange(const char* begin, const char* end, qint64 firstLineNumber,
+                             QVector<ElementSet>& elements,
+                             QVector<TLECatalogError>& errors);
+
+    /**
+     * @brief Vide le catalogue
+     */
+    void clear();
+
+    /**
+     * @brief Nombre de threads utilisés pour le parsing
+     * @param count 0 = automatique (QThread::idealThreadCount), 1 = séquentiel
+     */
+    void setThreadCount(int count) { m_threadCount = qMax(0, count); }
+    int threadCount() const { return m_threadCount; }
+
+    // Getters
+    const QVector<ElementSet>& elements() const { return m_elements; }
+    const ElementSet* data() const { return m_elements.constData(); }
+    const ElementSet& at(int index) const { return m_elements.at(index); }
+    int size() const { return m_elements.size(); }
+    bool isEmpty() const { return m_elements.isEmpty(); }
+
+    const QVector<TLECatalogError>& errors() const { return m_errors; }
+    double parseTimeMs() const { return m_parseTimeMs; }
+
+private:
+    QVector<ElementSet> m_elements;
+    QVector<TLECatalogError> m_errors;
+    double m_parseTimeMs = 0.0;
+    int m_threadCount = 0;           // 0 = automatique
+
+    /**
+     * @brief Parsing parallèle par morceaux (appelé par parse())
+     */
+    void parseParallel(const char* data, qint64 size, int threads);
+};
+
+#endif // TLECATALOG_H
@@ -1,6 +1,9 @@
 #include "TLEParser.h"
+#include "TLECatalog.h"
 #include <QtMath>
 #include <QDebug>
+#include <cmath>
+#include <cstdio>
 
 // Constantes physiques
 const double EARTH_RADIUS_KM = 6371.0;       // Rayon moyen de la Terre
@@ -91,6 +94,115 @@ TLEData TLEParser::parseTLE(const QString& line1, const QString& line2)
     return tle;
 }
 
+namespace {
+
+/**
+ * @brief Formate la notation scientifique compacte du TLE sur 8 colonnes
+ * Exemple : 0.00018874 -> " 18874-3"
+ */
+void formatCompactExponent(double value, char* out)
+{
+    char sign = (value < 0.0) ? '-' : ' ';
+    double magnitude = qAbs(value);
+
+    long long mantissa = 0;
+    int exponent = 0;
+    if (magnitude > 0.0) {
+        // 0.mmmmm × 10^exp avec mantisse dans [0.1, 1[
+        exponent = static_cast<int>(std::floor(std::log10(magnitude))) + 1;
+        mantissa = std::llround(magnitude / qPow(10.0, exponent) * 100000.0);
+        if (mantissa >= 100000) {
+            mantissa /= 10;
+            ++exponent;
+        }
+    }
+    exponent = qBound(-9, exponent, 9);
+
+    std::snprintf(out, 9, "%c%05lld%c%d", sign, mantissa,
+                  exponent < 0 ? '-' : '+', qAbs(exponent));
+}
+
+/**
+ * @brief Ajoute le checksum en colonne 69
+ */
+QString withChecksum(const char* line)
+{
+    int checksum = 0;
+    for (int i = 0; i < 68; i++) {
+        char c = line[i];
+        if (c >= '0' && c <= '9') {
+            checksum += c - '0';
+        } else if (c == '-') {
+            checksum += 1;
+        }
+    }
+    return QString::fromLatin1(line, 68) + QLatin1Char(static_cast<char>('0' + checksum % 10));
+}
+
+} // namespace
+
+TLEData TLEParser::fromElementSet(const ElementSet& set)
+{
+    TLEData tle;
+
+    tle.name = QString::fromUtf8(set.name);
+    tle.noradId = set.noradId;
+    tle.internationalDesignator = QString::fromLatin1(set.internationalDesignator);
+
+    tle.epochYear = set.epochYear;
+    tle.epochDay = set.epochDay;
+    tle.epoch = epochToDateTime(set.epochYear % 100, set.epochDay);
+
+    tle.inclination = set.inclination;
+    tle.raan = set.raan;
+    tle.eccentricity = set.eccentricity;
+    tle.argOfPerigee = set.argOfPerigee;
+    tle.meanAnomaly = set.meanAnomaly;
+    tle.meanMotion = set.meanMotion;
+
+    tle.bstar = set.bstar;
+    tle.meanMotionDot = set.meanMotionDot;
+    tle.meanMotionDotDot = set.meanMotionDotDot;
+
+    tle.revolutionNumber = set.revolutionNumber;
+    tle.elementSetNumber = set.elementSetNumber;
+
+    // Paramètres dérivés déjà calculés par le catalogue (pas de log)
+    tle.period = set.period;
+    tle.semiMajorAxis = set.semiMajorAxis;
+    tle.altitude = set.semiMajorAxis - EARTH_RADIUS_KM;
+
+    // === LIGNE 1 ===
+    char meanMotionDotStr[11];
+    long long dotDigits = qMin(std::llround(qAbs(set.meanMotionDot) * 1.0e8), 99999999LL);
+    std::snprintf(meanMotionDotStr, sizeof(meanMotionDotStr), "%c.%08lld",
+                  set.meanMotionDot < 0.0 ? '-' : ' ', dotDigits);
+
+    char dotDotStr[9];
+    char bstarStr[9];
+    formatCompactExponent(set.meanMotionDotDot, dotDotStr);
+    formatCompactExponent(set.bstar, bstarStr);
+
+    char line1[70];
+    std::snprintf(line1, sizeof(line1), "1 %05dU %-8.8s %02d%012.8f %s %s %s 0 %4d",
+                  set.noradId % 100000, set.internationalDesignator, set.epochYear % 100,
+                  set.epochDay, meanMotionDotStr, dotDotStr, bstarStr,
+                  set.elementSetNumber % 10000);
+
+    // === LIGNE 2 ===
+    char line2[70];
+    std::snprintf(line2, sizeof(line2), "2 %05d %8.4f %8.4f %07lld %8.4f %8.4f %11.8f%5d",
+                  set.noradId % 100000, set.inclination, set.raan,
+                  std::llround(set.eccentricity * 10000000.0), set.argOfPerigee,
+                  set.meanAnomaly, set.meanMotion, set.revolutionNumber % 100000);
+
+    tle.line0 = tle.name;
+    tle.line1 = withChecksum(line1);
+    tle.line2 = withChecksum(line2);
+
+    return tle;
+}
+
 void TLEData::calculateDerivedParameters()
 {
     // Période orbitale (minutes)
@@ -142,6 +254,30 @@ bool TLEParser::verifyChecksum(const QString& line)
     return checksum == declaredChecksum;
 }
 
+bool TLEParser::verifyChecksum(const char* line, qsizetype length)
+{
+    if (length < 69) {
+        return false;
+    }
+
+    int checksum = 0;
+
+    // Même règle que la version QString : chiffres + 1 par signe moins
+    for (int i = 0; i < 68; i++) {
+        char c = line[i];
+
+        if (c >= '0' && c <= '9') {
+            checksum += c - '0';
+        } else if (c == '-') {
+            checksum += 1;
+        }
+    }
+
+    checksum %= 10;
+
+    return line[68] >= '0' && line[68] <= '9' && checksum == line[68] - '0';
+}
+
 double TLEParser::extractDouble(const QString& line, int start, int length)
 {
     QString substr = line.mid(start, length).trimmed();
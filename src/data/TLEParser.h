@@ -4,6 +4,8 @@
 #include <QString>
 #include <QDateTime>
 
+struct ElementSet;
+
 /**
  * @brief Structure contenant les éléments orbitaux TLE
  *
@@ -83,6 +85,16 @@ public:
      */
     static TLEData parseTLE(const QString& line1, const QString& line2);
 
+    /**
+     * @brief Reconstruit un TLEData (lignes brutes comprises) depuis un ElementSet
+     *
+     * Les lignes 1 et 2 sont reformatées au format NORAD (checksum inclus),
+     * pour les consommateurs qui ont besoin du texte (ex. libsgp4::Tle).
+     * @param set Jeu d'éléments compact
+     * @return Structure TLEData complète
+     */
+    static TLEData fromElementSet(const ElementSet& set);
+
     /**
      * @brief Vérifie la validité du checksum TLE
      * @param line Ligne à vérifier
@@ -90,6 +102,14 @@ public:
      */
     static bool verifyChecksum(const QString& line);
 
+    /**
+     * @brief Vérifie le checksum directement sur un tampon d'octets
+     * @param line Début de la ligne
+     * @param length Longueur de la ligne
+     * @return true si le checksum est valide
+     */
+    static bool verifyChecksum(const char* line, qsizetype length);
+
     /**
      * @brief Extrait une valeur double d'une ligne TLE
      * @param line Ligne TLE
@@ -1,12 +1,34 @@
 #include <QGuiApplication>
+#include <QQuickWindow>
 #include <QQmlApplicationEngine>
 #include <QQmlContext>
+#include <QtQml>
+#include <QThread>
+#include <QThreadPool>
 #include <QDebug>
 
 #include "orbit/OrbitCalculator.h"
 #include "orbit/OrbitPath.h"
+#include "orbit/OrbitTrack.h"
+#include "orbit/GroundTrack.h"
 #include "data/TLEParser.h"
 #include "data/SGP4Propagator.h"
+#include "data/TLECatalog.h"
+#include "data/ElementSetCache.h"
+#include "propagation/BatchPropagator.h"
+#include "propagation/PropagationScheduler.h"
+#include "propagation/EphemerisCache.h"
+#include "rendering/OrbitGeometry.h"
+#include "rendering/GroundTrackGeometry.h"
+#include "rendering/SatelliteInstancing.h"
+#include "rendering/SatelliteCuller.h"
+#include "rendering/TextureLoader.h"
+#include "simulation/SimulationClock.h"
+#include "simulation/Frames.h"
+#include "profiling/Profiler.h"
+#include "analysis/ConjunctionScreener.h"
+#include "analysis/PassPredictor.h"
+#include "analysis/EclipsePredictor.h"
 
 int main(int argc, char *argv[])
 {
@@ -65,7 +87,7 @@ int main(int argc, char *argv[])
         double t = (periodSeconds * i) / 8.0;
         QDateTime currentTime = startTime.addSecs(static_cast<qint64>(t));
 
-        QVector3D pos = propagator.getPositionECI(currentTime);
+        QVector3D pos = propagator.getPositionAtMinutes(t / 60.0);
         double distance = pos.length();
 
         qDebug() << QString("t+%1min  %2  %3  %4  %5  %6")
@@ -100,6 +122,15 @@ int main(int argc, char *argv[])
         qDebug() << "   Vitesse totale =" << QString::number(speed, 'f', 3) << "km/s";
         qDebug() << "";
 
+        // Point sous-satellite (TEME → ECEF → WGS84)
+        double geodetic[3] = { position.x(), position.y(), position.z() };
+        Frames::temeToGeodetic(geodetic, 1, SGP4Propagator::toJulian(startTime));
+        qDebug() << "🌍 Position géodésique:";
+        qDebug() << "   Latitude =" << QString::number(geodetic[0], 'f', 4) << "°";
+        qDebug() << "   Longitude =" << QString::number(geodetic[1], 'f', 4) << "°";
+        qDebug() << "   Altitude WGS84 =" << QString::number(geodetic[2], 'f', 2) << "km";
+        qDebug() << "";
+
         // Conversion pour affichage 3D
         QVector3D displayPos = SGP4Propagator::eciToDisplay(position);
         qDebug() << "🎨 Position pour Qt Quick 3D:";
@@ -122,6 +153,23 @@ int main(int argc, char *argv[])
 
     QQmlApplicationEngine engine;
 
+    // === Types instanciables depuis QML ===
+    qmlRegisterType<OrbitGeometry>("OrbiFrance", 1, 0, "OrbitGeometry");
+    qmlRegisterType<GroundTrackGeometry>("OrbiFrance", 1, 0, "GroundTrackGeometry");
+    qmlRegisterType<SatelliteInstancing>("OrbiFrance", 1, 0, "SatelliteInstancing");
+    qmlRegisterUncreatableType<SatelliteCuller>("OrbiFrance", 1, 0, "SatelliteCuller",
+                                                "SatelliteCuller est créé par main.cpp");
+    qmlRegisterUncreatableType<Profiler>("OrbiFrance", 1, 0, "Profiler",
+                                         "Profiler est créé par main.cpp");
+    qmlRegisterUncreatableType<TextureLoader>("OrbiFrance", 1, 0, "TextureLoader",
+                                              "TextureLoader est créé par main.cpp");
+
+    // === Instrumentation : désactivée par défaut (F3 dans l'application) ===
+    Profiler profiler;
+    if (app.arguments().contains("--profile") || qEnvironmentVariableIsSet("ORBIFRANCE_PROFILE")) {
+        profiler.setEnabled(true);
+    }
+
     // === Création des objets C++ pour QML ===
     OrbitCalculator orbitCalculator;
     OrbitPath orbitPath;
@@ -135,7 +183,8 @@ int main(int argc, char *argv[])
     orbitPath.setSemiMajorAxis(semiMajorAxis);
     orbitPath.setEccentricity(eccentricity);
     orbitPath.setInclination(inclination);
-    orbitPath.setResolution(256);  // Plus de points = ligne plus continue
+    orbitPath.setResolution(256);  // Plus de points = ligne plus continue (mode uniforme)
+    orbitPath.setSamplingMode(OrbitPath::AdaptiveSampling);  // Points selon l'erreur écran
 
     qDebug() << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━";
     qDebug() << "🎬 Démarrage de l'application 3D";
@@ -145,12 +194,115 @@ int main(int argc, char *argv[])
     qDebug() << "  - Demi-grand axe:" << semiMajorAxis << "km";
     qDebug() << "  - Excentricité:" << eccentricity;
     qDebug() << "  - Inclinaison:" << inclination << "°";
-    qDebug() << "  - Résolution:" << 256 << "points";
+    qDebug() << "  - Échantillonnage: adaptatif," << orbitPath.pixelError() << "pixel d'erreur max";
     qDebug() << "";
 
+    // === Catalogue complet (rendu instancié, un seul appel de dessin) ===
+    // data/ est copié à côté de bin/ par CMake
+    // Cache binaire projeté (catalog.tle.elset) : le texte n'est reparsé que s'il a changé
+    ElementSetCache elementCache;
+    QVector<ElementSet> catalogElements;
+    // Partagé : l'ordonnanceur le garde en vie pendant ses tâches
+    QSharedPointer<BatchPropagator> satelliteCatalog(new BatchPropagator);
+    const QString catalogPath = QCoreApplication::applicationDirPath() + "/../data/catalog.tle";
+    if (elementCache.open(catalogPath)) {
+        satelliteCatalog->initialize(elementCache.data(), elementCache.size());
+        // Copie pour les analyses qui prennent un QVector (conjonctions, passages)
+        catalogElements = QVector<ElementSet>(elementCache.data(), elementCache.data() + elementCache.size());
+    } else {
+        qWarning() << "⚠️ Catalogue absent, seul le satellite de démonstration est affiché";
+    }
+    const double catalogStartJulian = SGP4Propagator::toJulian(QDateTime::currentDateTimeUtc());
+
+    // === Horloge de simulation : une publication par image ===
+    SimulationClock simulationClock;
+    simulationClock.setStartJulian(catalogStartJulian);
+
+    // === Ordonnanceur : image clé suivante du catalogue propagée en arrière-plan ===
+    PropagationScheduler propagationScheduler(qMax(1, QThread::idealThreadCount() / 2));
+
+    // === Culling : propagation du catalogue puis frustum, occultation et LOD ===
+    SatelliteCuller satelliteCuller;
+    satelliteCuller.setCatalog(satelliteCatalog.data());
+    satelliteCuller.setScheduler(&propagationScheduler);
+    satelliteCuller.setClock(&simulationClock);
+
+    // === Éphémérides interpolées : le curseur temporel relit les cellules déjà calculées ===
+    EphemerisCache ephemerisCache;
+
+    // === Trace SGP4 glissante de l'ISS (passé + futur) ===
+    OrbitTrack issTrack;
+    issTrack.setPropagator(&propagator);
+    issTrack.setEphemerisCache(&ephemerisCache);
+    issTrack.setCuller(&satelliteCuller);
+    issTrack.setJulianDate(catalogStartJulian);
+
+    // Tous les calculs de position d'une image sont faits ici, en C++,
+    // puis poussés vers QML (le catalogue passe par satelliteCuller)
+    QObject::connect(&simulationClock, &SimulationClock::frameAdvanced,
+                     &issTrack, &OrbitTrack::setJulianDate);
+
+    // === Traces au sol : ISS (cercle de visibilité) et fauchées des imageurs français ===
+    GroundTrack issGroundTrack;
+    issGroundTrack.setPropagator(&propagator);
+    issGroundTrack.setEphemerisCache(&ephemerisCache);
+    issGroundTrack.setJulianDate(catalogStartJulian);
+    QObject::connect(&simulationClock, &SimulationClock::frameAdvanced,
+                     &issGroundTrack, &GroundTrack::setJulianDate);
+
+    // Demi-angles au nadir depuis 694 km : SPOT 6/7 60 km de fauchée, Pléiades 20 km
+    const double spotHalfAngleDeg = 2.47;
+    const double pleiadesHalfAngleDeg = 0.83;
+
+    QList<QObject*> imagerTracks;
+    for (int index : ConjunctionScreener::selectByName(catalogElements, { "SPOT 6", "SPOT 7", "PLEIADES" })) {
+        const ElementSet& set = catalogElements[index];
+        SGP4Propagator* imager = new SGP4Propagator(&app);
+        if (!imager->initialize(TLEParser::fromElementSet(set))) {
+            delete imager;
+            continue;
+        }
+
+        GroundTrack* track = new GroundTrack(&app);
+        const bool pleiades = QString::fromLatin1(set.name).startsWith("PLEIADES", Qt::CaseInsensitive);
+        track->setSensorHalfAngleDeg(pleiades ? pleiadesHalfAngleDeg : spotHalfAngleDeg);
+        track->setPropagator(imager);
+        track->setEphemerisCache(&ephemerisCache);
+        track->setJulianDate(catalogStartJulian);
+        QObject::connect(&simulationClock, &SimulationClock::frameAdvanced,
+                         track, &GroundTrack::setJulianDate);
+        imagerTracks.append(track);
+    }
+    qDebug() << "🗺️ Traces au sol:" << imagerTracks.size() << "imageurs (SPOT, Pléiades) + ISS";
+
+    QObject::connect(&simulationClock, &SimulationClock::frameAdvanced,
+                     &orbitCalculator, [&orbitCalculator, &simulationClock]() {
+                         orbitCalculator.setSimulationTime(simulationClock.simulationSeconds());
+                     });
+
+    // === Textures KTX prémipmappées (textures/ est produit par le build, à côté de bin/) ===
+    // Lecture en arrière-plan : QML affiche les textures de remplacement en attendant
+    TextureLoader textureLoader;
+    textureLoader.setDirectory(QCoreApplication::applicationDirPath() + "/../textures");
+    const qint64 availableMemory = TextureLoader::availableMemory();
+    qDebug() << "🖼️ Mémoire disponible:"
+             << (availableMemory < 0 ? QStringLiteral("inconnue")
+                                     : QString::number(availableMemory / (1024.0 * 1024.0 * 1024.0), 'f', 1) + " Go")
+             << "-> palier de textures" << TextureLoader::tierName(textureLoader.tier());
+    textureLoader.load("earth-day");
+    textureLoader.load("stars");
+
     // === Exposition à QML - IMPORTANT: faire AVANT de charger le QML ===
     engine.rootContext()->setContextProperty("orbitCalculator", &orbitCalculator);
     engine.rootContext()->setContextProperty("orbitPath", &orbitPath);
+    engine.rootContext()->setContextProperty("satelliteCatalog", satelliteCatalog.data());
+    engine.rootContext()->setContextProperty("satelliteCuller", &satelliteCuller);
+    engine.rootContext()->setContextProperty("simulationClock", &simulationClock);
+    engine.rootContext()->setContextProperty("issTrack", &issTrack);
+    engine.rootContext()->setContextProperty("issGroundTrack", &issGroundTrack);
+    engine.rootContext()->setContextProperty("imagerTracks", QVariant::fromValue(imagerTracks));
+    engine.rootContext()->setContextProperty("textureLoader", &textureLoader);
+    engine.rootContext()->setContextProperty("profiler", &profiler);
 
     // === Chargement du QML ===
     const QUrl url(QStringLiteral("qrc:/res/qml/main.qml"));
@@ -174,8 +326,113 @@ int main(int argc, char *argv[])
         return -1;
     }
 
+    // Cadence de l'horloge : images de la fenêtre principale
+    simulationClock.attachToWindow(qobject_cast<QQuickWindow*>(engine.rootObjects().first()));
+    profiler.attachToWindow(qobject_cast<QQuickWindow*>(engine.rootObjects().first()));
+
     qDebug() << "✅ Application Qt démarrée avec succès";
     qDebug() << "";
 
-    return app.exec();
+    // === Conjonctions : actifs français contre tout le catalogue, sur 7 jours ===
+    // En arrière-plan, sur la moitié des cœurs (le rendu garde les autres)
+    const QStringList frenchAssetPrefixes = { "SPOT", "PLEIADES", "CSO", "HELIOS", "SWOT",
+                                              "JASON", "SYRACUSE", "KINEIS", "ANGELS" };
+    const double conjunctionWindowDays = 7.0;
+
+    ConjunctionScreener conjunctionScreener;
+    conjunctionScreener.setThreadCount(qMax(1, QThread::idealThreadCount() / 2));
+    const QVector<int> frenchAssets = ConjunctionScreener::selectByName(catalogElements, frenchAssetPrefixes);
+    if (!frenchAssets.isEmpty()) {
+        qDebug() << "🎯 Recherche de conjonctions:" << frenchAssets.size() << "actifs français,"
+                 << conjunctionScreener.thresholdKm() << "km," << conjunctionWindowDays << "jours";
+        QThreadPool::globalInstance()->start([&conjunctionScreener, &catalogElements, frenchAssets,
+                                              catalogStartJulian, conjunctionWindowDays]() {
+            const QVector<ElementSet>& elements = catalogElements;
+            const QVector<Conjunction> conjunctions = conjunctionScreener.screen(
+                elements, frenchAssets, catalogStartJulian, conjunctionWindowDays);
+
+            for (const Conjunction& conjunction : conjunctions) {
+                qWarning().noquote() << "⚠️ Conjonction:"
+                                     << QString::fromLatin1(elements[conjunction.primary].name).trimmed()
+                                     << "/" << QString::fromLatin1(elements[conjunction.secondary].name).trimmed()
+                                     << QString::number(conjunction.missDistanceKm, 'f', 3) << "km à"
+                                     << QString::number(conjunction.relativeSpeedKmS, 'f', 2) << "km/s le"
+                                     << conjunction.tcaDateTime().toString("yyyy-MM-dd HH:mm:ss UTC");
+            }
+        });
+    }
+
+    // === Passages des actifs français au-dessus de Toulouse et Kourou, sur 24 h ===
+    // Prochain passage de chaque satellite sur chaque station
+    const QVector<GroundStation> groundStations = {
+        { "Toulouse", 43.6045, 1.4440, 0.15, 5.0 },
+        { "Kourou", 5.2360, -52.7690, 0.01, 5.0 }
+    };
+    const double predictionWindowDays = 1.0;
+
+    QVector<TLEData> frenchAssetTles;
+    frenchAssetTles.reserve(frenchAssets.size());
+    for (int index : frenchAssets) {
+        frenchAssetTles.append(TLEParser::fromElementSet(catalogElements[index]));
+    }
+
+    PassPredictor passPredictor;
+    passPredictor.setThreadCount(qMax(1, QThread::idealThreadCount() / 2));
+    if (!frenchAssetTles.isEmpty()) {
+        QThreadPool::globalInstance()->start([&passPredictor, &frenchAssetTles, &groundStations,
+                                              catalogStartJulian, predictionWindowDays]() {
+            const QVector<SatellitePass> passes = passPredictor.predict(
+                frenchAssetTles, groundStations, catalogStartJulian, predictionWindowDays);
+
+            QVector<bool> logged(frenchAssetTles.size() * groundStations.size(), false);
+            for (const SatellitePass& pass : passes) {
+                bool& done = logged[pass.satellite * groundStations.size() + pass.station];
+                if (done) {
+                    continue;
+                }
+                done = true;
+                qDebug().noquote() << "📡 Passage:" << frenchAssetTles[pass.satellite].name.trimmed()
+                                   << "au-dessus de" << groundStations[pass.station].name
+                                   << pass.aos().toString("yyyy-MM-dd HH:mm:ss") << "->"
+                                   << pass.los().toString("HH:mm:ss UTC") << ", élévation max"
+                                   << QString::number(pass.maxElevationDeg, 'f', 1) << "° à"
+                                   << pass.tca().toString("HH:mm:ss");
+            }
+        });
+    }
+
+    // === Éclipses des actifs français sur 24 h : nombre et durée d'ombre maximale ===
+    EclipsePredictor eclipsePredictor;
+    eclipsePredictor.setThreadCount(qMax(1, QThread::idealThreadCount() / 2));
+    if (!frenchAssetTles.isEmpty()) {
+        QThreadPool::globalInstance()->start([&eclipsePredictor, &frenchAssetTles,
+                                              catalogStartJulian, predictionWindowDays]() {
+            const QVector<EclipseInterval> eclipses = eclipsePredictor.predict(
+                frenchAssetTles, catalogStartJulian, predictionWindowDays);
+
+            QVector<int> counts(frenchAssetTles.size(), 0);
+            QVector<double> longestUmbra(frenchAssetTles.size(), 0.0);
+            for (const EclipseInterval& eclipse : eclipses) {
+                ++counts[eclipse.satellite];
+                longestUmbra[eclipse.satellite] = qMax(longestUmbra[eclipse.satellite], eclipse.umbraSeconds());
+            }
+            for (int i = 0; i < frenchAssetTles.size(); ++i) {
+                if (counts[i] > 0) {
+                    qDebug().noquote() << "🌑 Éclipses:" << frenchAssetTles[i].name.trimmed() << counts[i]
+                                       << "sur 24 h, ombre max"
+                                       << QString::number(longestUmbra[i] / 60.0, 'f', 1) << "min";
+                }
+            }
+        });
+    }
+
+    const int result = app.exec();
+
+    // La recherche de conjonctions et les prédictions lisent catalogElements et
+    // frenchAssetTles : les arrêter avant leur destruction
+    QThreadPool::globalInstance()->clear();
+    conjunctionScreener.cancel();
+    QThreadPool::globalInstance()->waitForDone();
+
+    return result;
 }
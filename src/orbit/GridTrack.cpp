@@ -0,0 +1,195 @@
+#include "GridTrack.h"
+#include "../profiling/Profiler.h"
+#include "../propagation/EphemerisCache.h"
+#include <QtMath>
+#include <cmath>
+
+const double MINUTES_PER_DAY = 1440.0;
+
+// Fenêtre par défaut : une demi-orbite LEO derrière, une orbite devant
+const double DEFAULT_PAST_MINUTES = 45.0;
+const double DEFAULT_FUTURE_MINUTES = 90.0;
+const double DEFAULT_STEP_SECONDS = 30.0;
+
+GridTrack::GridTrack(const char* profileName, QObject *parent)
+    : QObject(parent)
+    , m_profileName(profileName)
+    , m_ephemeris(nullptr)
+    , m_ephemerisIndex(-1)
+    , m_pastMinutes(DEFAULT_PAST_MINUTES)
+    , m_futureMinutes(DEFAULT_FUTURE_MINUTES)
+    , m_stepSeconds(DEFAULT_STEP_SECONDS)
+    , m_first(0)
+    , m_count(0)
+    , m_generation(0)
+    , m_minutes(0.0)
+    , m_hasTime(false)
+    , m_propagatedSamples(0)
+{
+}
+
+void GridTrack::setPropagator(const SGP4Propagator* propagator)
+{
+    if (m_propagator == propagator)
+        return;
+
+    m_propagator = propagator;
+    registerEphemeris();
+    resetWindow();
+    emit windowChanged();
+    refresh();
+}
+
+void GridTrack::setEphemerisCache(EphemerisCache* cache)
+{
+    if (m_ephemeris == cache)
+        return;
+
+    m_ephemeris = cache;
+    registerEphemeris();
+    resetWindow();
+    emit windowChanged();
+    refresh();
+}
+
+void GridTrack::registerEphemeris()
+{
+    m_ephemerisIndex = (m_ephemeris && m_propagator) ? m_ephemeris->addSatellite(m_propagator) : -1;
+}
+
+bool GridTrack::stateAt(double minutesSinceEpoch, double* position, double* velocity) const
+{
+    if (m_ephemerisIndex >= 0) {
+        return m_ephemeris->stateAtMinutes(m_ephemerisIndex, minutesSinceEpoch, position, velocity);
+    }
+    return m_propagator->computeState(minutesSinceEpoch, position, velocity) == SGP4Status::Ok;
+}
+
+void GridTrack::setPastMinutes(double minutes)
+{
+    if (qFuzzyCompare(m_pastMinutes, minutes))
+        return;
+
+    m_pastMinutes = qMax(0.0, minutes);
+    resetWindow();
+    emit windowChanged();
+    refresh();
+}
+
+void GridTrack::setFutureMinutes(double minutes)
+{
+    if (qFuzzyCompare(m_futureMinutes, minutes))
+        return;
+
+    m_futureMinutes = qMax(0.0, minutes);
+    resetWindow();
+    emit windowChanged();
+    refresh();
+}
+
+void GridTrack::setStepSeconds(double seconds)
+{
+    if (qFuzzyCompare(m_stepSeconds, seconds))
+        return;
+
+    // Sous la seconde, la trace n'est pas plus lisible et coûte cher
+    m_stepSeconds = qMax(1.0, seconds);
+    resetWindow();
+    emit windowChanged();
+    refresh();
+}
+
+void GridTrack::refresh()
+{
+    if (m_hasTime) {
+        setMinutesSinceEpoch(m_minutes);
+    }
+}
+
+void GridTrack::resetWindow()
+{
+    // Capacité : tous les instants de grille de la fenêtre, plus une marge d'arrondi
+    const int capacity = int(std::ceil((m_pastMinutes + m_futureMinutes) / stepMinutes())) + 2;
+    m_ringValid.fill(0, capacity);
+    resizeRing(capacity);
+    m_first = 0;
+    m_count = 0;
+    ++m_generation;
+    m_propagatedSamples = 0;
+}
+
+int GridTrack::slotOf(qint64 gridIndex) const
+{
+    const qint64 capacity = m_ringValid.size();
+    return int(((gridIndex % capacity) + capacity) % capacity);
+}
+
+qint64 GridTrack::currentGridIndex() const
+{
+    return qint64(std::floor(m_minutes / stepMinutes()));
+}
+
+bool GridTrack::contains(qint64 gridIndex) const
+{
+    return gridIndex >= m_first && gridIndex < m_first + m_count && m_ringValid[slotOf(gridIndex)];
+}
+
+void GridTrack::sampleGrid(qint64 gridIndex)
+{
+    const int slot = slotOf(gridIndex);
+    m_ringValid[slot] = sample(slot, gridIndex * stepMinutes()) ? 1 : 0;
+    ++m_propagatedSamples;
+    ORBI_PROFILE_COUNT(Profiler::PropagatedObjects);
+}
+
+void GridTrack::setJulianDate(double julianDate)
+{
+    if (!m_propagator) {
+        return;
+    }
+    setMinutesSinceEpoch((julianDate - m_propagator->epochJulian()) * MINUTES_PER_DAY);
+}
+
+void GridTrack::setMinutesSinceEpoch(double minutesSinceEpoch)
+{
+    ORBI_PROFILE_SCOPE(m_profileName, Profiler::Propagation);
+    m_minutes = minutesSinceEpoch;
+    m_hasTime = true;
+
+    if (!m_propagator || !m_propagator->isInitialized()) {
+        return;
+    }
+
+    if (!updateCurrent(minutesSinceEpoch)) {
+        return;
+    }
+
+    // Instants de grille couverts par la nouvelle fenêtre
+    const double step = stepMinutes();
+    const qint64 wantFirst = qint64(std::ceil((minutesSinceEpoch - m_pastMinutes) / step));
+    const qint64 wantLast = qint64(std::floor((minutesSinceEpoch + m_futureMinutes) / step));
+
+    const qint64 haveFirst = m_first;
+    const qint64 haveLast = m_first + m_count - 1;
+
+    if (m_count == 0 || wantFirst > haveLast || wantLast < haveFirst) {
+        // Saut hors de la fenêtre : rien à réutiliser
+        for (qint64 k = wantFirst; k <= wantLast; ++k) {
+            sampleGrid(k);
+        }
+    } else {
+        // Glissement : seuls les instants nouveaux sont propagés (tête ou
+        // queue selon le sens du temps), les sortants sont abandonnés
+        for (qint64 k = haveLast + 1; k <= wantLast; ++k) {
+            sampleGrid(k);
+        }
+        for (qint64 k = qMin(haveFirst - 1, wantLast); k >= wantFirst; --k) {
+            sampleGrid(k);
+        }
+    }
+
+    m_first = wantFirst;
+    m_count = int(qMax<qint64>(0, wantLast - wantFirst + 1));
+
+    emit trackChanged();
+}
@@ -0,0 +1,179 @@
+#ifndef GRIDTRACK_H
+#define GRIDTRACK_H
+
+#include <QObject>
+#include <QVector>
+#include <QPointer>
+#include "../data/SGP4Propagator.h"
+
+class EphemerisCache;
+
+/**
+ * @brief Fenêtre glissante (passé + futur) d'échantillons sur une grille de temps fixe
+ *
+ * Base commune des traces (OrbitTrack, GroundTrack). Les échantillons
+ * sont pris sur une grille de temps fixe (multiples de stepSeconds depuis
+ * l'époque TLE) et rangés dans un tampon circulaire indexé par numéro de
+ * grille. Quand le temps de simulation avance, seuls les instants de
+ * grille entrés dans la fenêtre sont calculés (en tête) ; ceux qui en
+ * sortent (en queue) sont simplement abandonnés. Le coût par image est
+ * donc proportionnel au nombre de nouveaux échantillons ; la fenêtre
+ * n'est recalculée entièrement qu'après un saut. Un instant resté dans la
+ * fenêtre garde son échantillon : les géométries ne recopient que les
+ * instants entrés ou sortis.
+ *
+ * Les classes dérivées rangent leurs propres échantillons (un par case)
+ * et ne fournissent que leur calcul : resizeRing(), sample() et
+ * updateCurrent().
+ */
+class GridTrack : public QObject
+{
+    Q_OBJECT
+
+    // Propriétés exposées à QML
+    Q_PROPERTY(double pastMinutes READ pastMinutes WRITE setPastMinutes NOTIFY windowChanged)
+    Q_PROPERTY(double futureMinutes READ futureMinutes WRITE setFutureMinutes NOTIFY windowChanged)
+    Q_PROPERTY(double stepSeconds READ stepSeconds WRITE setStepSeconds NOTIFY windowChanged)
+    Q_PROPERTY(int sampleCount READ sampleCount NOTIFY trackChanged)
+
+public:
+    /**
+     * @brief Propagateur source (non possédé, doit survivre à la trace)
+     */
+    void setPropagator(const SGP4Propagator* propagator);
+    const SGP4Propagator* propagator() const { return m_propagator; }
+
+    /**
+     * @brief Cache d'éphémérides partagé (optionnel, non possédé)
+     *
+     * Les échantillons sont interpolés dans le cache au lieu d'être
+     * propagés : un aller-retour du curseur temporel retombe sur des
+     * cellules déjà calculées.
+     */
+    void setEphemerisCache(EphemerisCache* cache);
+    EphemerisCache* ephemerisCache() const { return m_ephemeris; }
+
+    // Getters
+    double pastMinutes() const { return m_pastMinutes; }
+    double futureMinutes() const { return m_futureMinutes; }
+    double stepSeconds() const { return m_stepSeconds; }
+    int sampleCount() const { return m_count; }
+
+    /**
+     * @brief Nombre total d'échantillons propagés depuis le dernier reset
+     */
+    qint64 propagatedSamples() const { return m_propagatedSamples; }
+
+    // Setters (la fenêtre est reconstruite à la prochaine mise à jour)
+    void setPastMinutes(double minutes);
+    void setFutureMinutes(double minutes);
+    void setStepSeconds(double seconds);
+
+    /**
+     * @brief Fait glisser la fenêtre jusqu'à l'instant donné
+     * @param minutesSinceEpoch Temps de simulation (minutes depuis l'époque TLE)
+     */
+    Q_INVOKABLE void setMinutesSinceEpoch(double minutesSinceEpoch);
+
+    /**
+     * @brief Variante en date julienne (UTC)
+     */
+    Q_INVOKABLE void setJulianDate(double julianDate);
+
+    // === Tampon circulaire (lecture par les géométries) ===
+    int capacity() const { return m_ringValid.size(); }
+    qint64 firstGridIndex() const { return m_first; }
+    int slotOf(qint64 gridIndex) const;
+
+    /**
+     * @brief Instant de grille au plus proche avant le temps courant
+     */
+    qint64 currentGridIndex() const;
+
+    /**
+     * @brief Vrai si l'instant de grille est dans la fenêtre et valide
+     */
+    bool contains(qint64 gridIndex) const;
+
+    /**
+     * @brief Incrémenté à chaque vidage du tampon (fenêtre, source, réglage)
+     *
+     * Tant qu'il ne change pas, les échantillons restés dans la fenêtre
+     * sont inchangés depuis la dernière lecture.
+     */
+    quint64 generation() const { return m_generation; }
+
+signals:
+    void windowChanged();
+    void trackChanged();
+
+protected:
+    /**
+     * @param profileName Nom de la mesure de mise à jour (Profiler)
+     *
+     * Le constructeur dérivé appelle resetWindow() une fois ses propres
+     * réglages initialisés.
+     */
+    GridTrack(const char* profileName, QObject *parent);
+
+    /**
+     * @brief Redimensionne le stockage dérivé (cases vides)
+     */
+    virtual void resizeRing(int capacity) = 0;
+
+    /**
+     * @brief Calcule l'échantillon d'un instant de grille et le range dans sa case
+     * @return false si l'état n'a pas pu être obtenu
+     */
+    virtual bool sample(int slot, double minutesSinceEpoch) = 0;
+
+    /**
+     * @brief Met à jour l'état à l'instant courant
+     * @return false pour ne pas faire glisser la fenêtre (rattrapée plus tard)
+     */
+    virtual bool updateCurrent(double minutesSinceEpoch) = 0;
+
+    /**
+     * @brief Position et vitesse TEME (km, km/s), depuis le cache si présent
+     */
+    bool stateAt(double minutesSinceEpoch, double* position, double* velocity) const;
+
+    /**
+     * @brief Vide le tampon (réglage modifié)
+     */
+    void resetWindow();
+
+    /**
+     * @brief Réapplique le dernier temps de simulation, s'il y en a un
+     */
+    void refresh();
+
+    double minutes() const { return m_minutes; }
+    bool hasTime() const { return m_hasTime; }
+
+private:
+    const char* m_profileName;
+    QPointer<const SGP4Propagator> m_propagator;
+    EphemerisCache* m_ephemeris;
+    int m_ephemerisIndex;           // Indice dans le cache, -1 sans cache
+
+    double m_pastMinutes;
+    double m_futureMinutes;
+    double m_stepSeconds;
+
+    // Tampon circulaire : l'instant de grille k est rangé en k mod capacité
+    QVector<quint8> m_ringValid;    // 0 si l'état a échoué sur l'échantillon
+    qint64 m_first;                 // Premier instant de grille présent
+    int m_count;                    // Nombre d'instants présents (consécutifs)
+    quint64 m_generation;
+
+    double m_minutes;               // Dernier temps de simulation
+    bool m_hasTime;
+    qint64 m_propagatedSamples;
+
+    double stepMinutes() const { return m_stepSeconds / 60.0; }
+    void registerEphemeris();
+    void sampleGrid(qint64 gridIndex);
+};
+
+#endif // GRIDTRACK_H
@@ -0,0 +1,138 @@
+#include "GroundTrack.h"
+#include "../simulation/Frames.h"
+#include <QtMath>
+#include <cmath>
+
+const double MINUTES_PER_DAY = 1440.0;
+
+// Sphère de la scène (rayon moyen) et rotation terrestre (rad/s, WGS84)
+const double EARTH_RADIUS_KM = 6371.0;
+const double EARTH_ROTATION_RAD_S = 7.292115e-5;
+
+// Cône limité à l'horizon : cercle de visibilité
+const double DEFAULT_SENSOR_HALF_ANGLE_DEG = 90.0;
+
+GroundTrack::GroundTrack(QObject *parent)
+    : GridTrack("Trace au sol", parent)
+    , m_sensorHalfAngleDeg(DEFAULT_SENSOR_HALF_ANGLE_DEG)
+    , m_current()
+{
+    resetWindow();
+}
+
+QString GroundTrack::name() const
+{
+    return propagator() ? propagator()->satelliteName() : QString();
+}
+
+double GroundTrack::footprintRadiusKm() const
+{
+    return m_current.valid ? m_current.swathAngle * EARTH_RADIUS_KM : 0.0;
+}
+
+void GroundTrack::setSensorHalfAngleDeg(double degrees)
+{
+    if (qFuzzyCompare(m_sensorHalfAngleDeg, degrees))
+        return;
+
+    // La fauchée est stockée par échantillon : tout est recalculé
+    m_sensorHalfAngleDeg = qBound(0.0, degrees, 90.0);
+    resetWindow();
+    emit windowChanged();
+    refresh();
+}
+
+void GroundTrack::resizeRing(int capacity)
+{
+    GroundSample empty = GroundSample();
+    empty.valid = false;
+    m_ring.fill(empty, capacity);
+}
+
+double GroundTrack::swathAngle(double altitudeKm, double halfAngle)
+{
+    // Demi-angle apparent de la Terre vu du satellite
+    const double rho = std::asin(EARTH_RADIUS_KM / (EARTH_RADIUS_KM + qMax(altitudeKm, 1.0)));
+    if (halfAngle >= rho) {
+        return M_PI_2 - rho;
+    }
+
+    // Élévation du bord du cône vue du sol, puis angle au centre
+    const double elevation = std::acos(std::sin(halfAngle) / std::sin(rho));
+    return M_PI_2 - halfAngle - elevation;
+}
+
+GroundSample GroundTrack::compute(double minutesSinceEpoch) const
+{
+    GroundSample result = GroundSample();
+    result.valid = false;
+
+    double position[3], velocity[3];
+    if (!stateAt(minutesSinceEpoch, position, velocity)) {
+        return result;
+    }
+
+    // Chaque échantillon à son propre instant (rotation terrestre comprise)
+    const double julian = propagator()->epochJulian() + minutesSinceEpoch / MINUTES_PER_DAY;
+    double geodetic[3] = { position[0], position[1], position[2] };
+    double ecef[3] = { position[0], position[1], position[2] };
+    double ground[3] = { velocity[0], velocity[1], velocity[2] };
+    Frames::temeToGeodetic(geodetic, 1, julian);
+    Frames::temeToEcef(ecef, 1, julian);
+    Frames::temeToEcef(ground, 1, julian);
+
+    // Vitesse par rapport au sol : v - ω × r
+    ground[0] += EARTH_ROTATION_RAD_S * ecef[1];
+    ground[1] -= EARTH_ROTATION_RAD_S * ecef[0];
+
+    const double lat = qDegreesToRadians(geodetic[0]);
+    const double lon = qDegreesToRadians(geodetic[1]);
+    result.latitudeDeg = float(geodetic[0]);
+    result.longitudeDeg = float(geodetic[1]);
+    result.altitudeKm = float(geodetic[2]);
+    result.up = QVector3D(float(std::cos(lat) * std::cos(lon)), float(std::cos(lat) * std::sin(lon)),
+                          float(std::sin(lat)));
+    result.crossTrack = QVector3D::crossProduct(result.up, QVector3D(float(ground[0]), float(ground[1]),
+                                                                     float(ground[2]))).normalized();
+    result.swathAngle = float(swathAngle(geodetic[2], qDegreesToRadians(m_sensorHalfAngleDeg)));
+    result.valid = true;
+    return result;
+}
+
+bool GroundTrack::sample(int slot, double minutesSinceEpoch)
+{
+    m_ring[slot] = compute(minutesSinceEpoch);
+    return m_ring[slot].valid;
+}
+
+bool GroundTrack::updateCurrent(double minutesSinceEpoch)
+{
+    // Point sous-satellite exact à l'instant courant (empreinte)
+    m_current = compute(minutesSinceEpoch);
+    return true;
+}
+
+void GroundTrack::footprint(QVector<QVector3D>& directions, int segments) const
+{
+    directions.clear();
+    if (!m_current.valid || segments < 3) {
+        return;
+    }
+
+    // Base orthonormée du plan tangent au point sous-satellite
+    const QVector3D& up = m_current.up;
+    QVector3D side = m_current.crossTrack;
+    if (side.isNull()) {
+        side = QVector3D::crossProduct(QVector3D(0.0f, 0.0f, 1.0f), up).normalized();
+    }
+    const QVector3D forward = QVector3D::crossProduct(side, up);
+
+    const float c = std::cos(m_current.swathAngle);
+    const float s = std::sin(m_current.swathAngle);
+
+    directions.reserve(segments + 1);
+    for (int i = 0; i <= segments; ++i) {
+        const float theta = 2.0f * float(M_PI) * float(i % segments) / float(segments);
+        directions.append(up * c + (side * std::cos(theta) + forward * std::sin(theta)) * s);
+    }
+}
@@ -0,0 +1,99 @@
+#ifndef GROUNDTRACK_H
+#define GROUNDTRACK_H
+
+#include <QVector>
+#include <QVector3D>
+#include "GridTrack.h"
+
+/**
+ * @brief Échantillon de trace au sol (repère terrestre)
+ */
+struct GroundSample {
+    float latitudeDeg;          // Latitude géodésique WGS84
+    float longitudeDeg;         // ]-180, 180]
+    float altitudeKm;           // Au-dessus de l'ellipsoïde
+    QVector3D up;               // Point sous-satellite sur la sphère (ECEF, unitaire)
+    QVector3D crossTrack;       // Unitaire, à gauche du sens de marche
+    float swathAngle;           // Demi-fauchée (angle au centre de la Terre, radians)
+    bool valid;                 // false si SGP4 a échoué
+};
+
+/**
+ * @brief Trace au sol glissante et empreinte d'un capteur au nadir
+ *
+ * Même fenêtre que OrbitTrack (GridTrack) : seuls les instants entrés
+ * dans la fenêtre sont propagés. Chaque échantillon est converti en
+ * coordonnées géodésiques à son propre instant
+ * (Frames::temeToGeodetic) ; dans le repère terrestre, un échantillon
+ * déjà calculé ne change plus, ce qui permet aux géométries de ne
+ * renvoyer au GPU que les instants entrés ou sortis de la fenêtre
+ * (GroundTrackGeometry).
+ *
+ * Fauchée et empreinte : cône au nadir de demi-angle sensorHalfAngleDeg,
+ * limité à l'horizon (90° = cercle de visibilité à 0° d'élévation). La
+ * demi-fauchée est l'angle au centre de la Terre (sphère de rayon moyen)
+ * entre le nadir et le bord du cône, fonction de l'altitude.
+ *
+ * Les directions sont exprimées en ECEF ; la latitude géodésique est
+ * reportée telle quelle sur la sphère, comme la texture de la Terre
+ * (équirectangulaire).
+ */
+class GroundTrack : public GridTrack
+{
+    Q_OBJECT
+
+    // Propriétés exposées à QML
+    Q_PROPERTY(double sensorHalfAngleDeg READ sensorHalfAngleDeg WRITE setSensorHalfAngleDeg NOTIFY windowChanged)
+    Q_PROPERTY(QString name READ name NOTIFY windowChanged)
+    Q_PROPERTY(double latitude READ latitude NOTIFY trackChanged)
+    Q_PROPERTY(double longitude READ longitude NOTIFY trackChanged)
+    Q_PROPERTY(double altitude READ altitude NOTIFY trackChanged)
+    Q_PROPERTY(double footprintRadiusKm READ footprintRadiusKm NOTIFY trackChanged)
+
+public:
+    explicit GroundTrack(QObject *parent = nullptr);
+
+    // Getters
+    double sensorHalfAngleDeg() const { return m_sensorHalfAngleDeg; }
+    QString name() const;
+    double latitude() const { return m_current.latitudeDeg; }
+    double longitude() const { return m_current.longitudeDeg; }
+    double altitude() const { return m_current.altitudeKm; }
+    double footprintRadiusKm() const;
+    const GroundSample& current() const { return m_current; }
+
+    // Setters (la fenêtre est reconstruite à la prochaine mise à jour)
+    void setSensorHalfAngleDeg(double degrees);
+
+    // === Tampon circulaire (lecture par les géométries) ===
+    const GroundSample& sampleAt(int slot) const { return m_ring[slot]; }
+
+    /**
+     * @brief Contour de l'empreinte autour de la position courante
+     * @param directions [out] segments + 1 directions ECEF unitaires (contour fermé)
+     */
+    void footprint(QVector<QVector3D>& directions, int segments) const;
+
+    /**
+     * @brief Demi-fauchée d'un cône au nadir
+     * @param altitudeKm Altitude du satellite
+     * @param halfAngle Demi-angle du cône (radians)
+     * @return Angle au centre de la Terre (radians), limité à l'horizon
+     */
+    static double swathAngle(double altitudeKm, double halfAngle);
+
+protected:
+    void resizeRing(int capacity) override;
+    bool sample(int slot, double minutesSinceEpoch) override;
+    bool updateCurrent(double minutesSinceEpoch) override;
+
+private:
+    double m_sensorHalfAngleDeg;
+
+    QVector<GroundSample> m_ring;   // Un échantillon par case
+    GroundSample m_current;
+
+    GroundSample compute(double minutesSinceEpoch) const;
+};
+
+#endif // GROUNDTRACK_H
@@ -32,3 +32,13 @@ QVector3D OrbitCalculator::getSatellitePosition(double timeSeconds)
     // === Retourne la position 3D du satellite ===
     return QVector3D(x_orb, y_rot, z_rot);
 }
+
+void OrbitCalculator::setSimulationTime(double timeSeconds)
+{
+    const QVector3D position = getSatellitePosition(timeSeconds);
+    if (position == m_satellitePosition)
+        return;
+
+    m_satellitePosition = position;
+    emit satellitePositionChanged(m_satellitePosition);
+}
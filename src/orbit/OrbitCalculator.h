@@ -7,13 +7,29 @@
 class OrbitCalculator : public QObject
 {
     Q_OBJECT
+
+    // Position poussée par SimulationClock (une notification par image)
+    Q_PROPERTY(QVector3D satellitePosition READ satellitePosition NOTIFY satellitePositionChanged)
+
 public:
     explicit OrbitCalculator(QObject *parent = nullptr);
 
     Q_INVOKABLE QVector3D getSatellitePosition(double timeSeconds);
 
+    QVector3D satellitePosition() const { return m_satellitePosition; }
+
+public slots:
+    /**
+     * @brief Calcule la position au temps de simulation et la publie
+     * @param timeSeconds Temps de simulation (secondes)
+     */
+    void setSimulationTime(double timeSeconds);
+
 signals:
     void satellitePositionChanged(QVector3D newPos);
+
+private:
+    QVector3D m_satellitePosition;
 };
 
 #endif // ORBITCALCULATOR_H
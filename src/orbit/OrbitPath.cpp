@@ -1,6 +1,19 @@
 #include "OrbitPath.h"
 #include <QtMath>
 
+// Subdivision adaptative : 8 arcs de départ, 2^10 sous-arcs au plus chacun
+const int ADAPTIVE_INITIAL_SEGMENTS = 8;
+const int ADAPTIVE_MAX_DEPTH = 10;
+
+// Échantillonnage à la moitié du budget : petite marge avant régénération
+const double ADAPTIVE_TOLERANCE_MARGIN = 0.5;
+
+// Au-delà de ce rapport budget/erreur réelle, les points sont trop denses
+const double ADAPTIVE_COARSEN_RATIO = 8.0;
+
+// Distance minimale prise en compte, en fraction de la distance caméra
+const double MIN_DISTANCE_FRACTION = 0.05;
+
 OrbitPath::OrbitPath(QObject *parent)
     : QObject(parent)
 {
@@ -13,7 +26,7 @@ void OrbitPath::setSemiMajorAxis(double value)
 
     m_semiMajorAxis = value;
     emit semiMajorAxisChanged();
-    emit orbitChanged();
+    invalidatePoints();
 }
 
 void OrbitPath::setEccentricity(double value)
@@ -24,7 +37,7 @@ void OrbitPath::setEccentricity(double value)
     // Limite l'excentricité à [0, 0.99] pour éviter les orbites hyperboliques
     m_eccentricity = qBound(0.0, value, 0.99);
     emit eccentricityChanged();
-    emit orbitChanged();
+    invalidatePoints();
 }
 
 void OrbitPath::setInclination(double value)
@@ -34,7 +47,7 @@ void OrbitPath::setInclination(double value)
 
     m_inclination = value;
     emit inclinationChanged();
-    emit orbitChanged();
+    invalidatePoints();
 }
 
 void OrbitPath::setResolution(int value)
@@ -45,9 +58,89 @@ void OrbitPath::setResolution(int value)
     // Limite la résolution entre 32 et 512 points
     m_resolution = qBound(32, value, 512);
     emit resolutionChanged();
+    invalidatePoints();
+}
+
+void OrbitPath::setSamplingMode(SamplingMode mode)
+{
+    if (m_samplingMode == mode)
+        return;
+
+    m_samplingMode = mode;
+    emit samplingModeChanged();
+    invalidatePoints();
+}
+
+void OrbitPath::setCameraDistance(double value)
+{
+    if (qFuzzyCompare(m_cameraDistance, value))
+        return;
+
+    m_cameraDistance = value;
+    emit cameraDistanceChanged();
+    updateViewError();
+}
+
+void OrbitPath::setFieldOfView(double degrees)
+{
+    if (qFuzzyCompare(m_fieldOfView, degrees))
+        return;
+
+    m_fieldOfView = qBound(1.0, degrees, 179.0);
+    emit fieldOfViewChanged();
+    updateViewError();
+}
+
+void OrbitPath::setViewportHeight(double pixels)
+{
+    if (qFuzzyCompare(m_viewportHeight, pixels))
+        return;
+
+    m_viewportHeight = qMax(1.0, pixels);
+    emit viewportHeightChanged();
+    updateViewError();
+}
+
+void OrbitPath::setPixelError(double pixels)
+{
+    if (qFuzzyCompare(m_pixelError, pixels))
+        return;
+
+    // Sous 0.1 pixel, le nombre de points explose sans gain visible
+    m_pixelError = qMax(0.1, pixels);
+    emit pixelErrorChanged();
+    updateViewError();
+}
+
+void OrbitPath::invalidatePoints()
+{
+    m_pointsValid = false;
     emit orbitChanged();
 }
 
+void OrbitPath::updateViewError()
+{
+    if (m_samplingMode != AdaptiveSampling || !m_pointsValid)
+        return;
+
+    // Régénération seulement si le budget est dépassé (zoom avant) ou
+    // si les points en cache sont nettement plus fins que nécessaire
+    const double budget = worldTolerance();
+    if (budget < m_sampledTolerance || budget > m_sampledTolerance * ADAPTIVE_COARSEN_RATIO)
+        invalidatePoints();
+}
+
+double OrbitPath::worldTolerance() const
+{
+    // Point de l'orbite le plus proche possible de la caméra
+    const double apoapsis = m_semiMajorAxis * (1.0 + m_eccentricity);
+    const double distance = qMax(m_cameraDistance - apoapsis, m_cameraDistance * MIN_DISTANCE_FRACTION);
+
+    // Taille d'un pixel à cette distance
+    const double viewHeight = 2.0 * distance * qTan(qDegreesToRadians(m_fieldOfView) / 2.0);
+    return m_pixelError * viewHeight / m_viewportHeight;
+}
+
 QVector3D OrbitPath::calculateOrbitPoint(double angle) const
 {
     // === Équation polaire de l'ellipse (formule de Kepler) ===
@@ -71,22 +164,72 @@ QVector3D OrbitPath::calculateOrbitPoint(double angle) const
     return QVector3D(x_orb, y_rot, z_rot);
 }
 
-QVariantList OrbitPath::generateOrbitPoints()
+void OrbitPath::subdivide(double angleA, double angleB, const QVector3D& pointA, const QVector3D& pointB,
+                          double tolerance, int depth, QVector<QVector3D>& points) const
 {
-    QVariantList points;
-    points.reserve(m_resolution + 1);
+    const double angleM = 0.5 * (angleA + angleB);
+    const QVector3D pointM = calculateOrbitPoint(angleM);
+
+    // Écart du point milieu à la corde (l'ellipse est convexe : bon estimateur)
+    const QVector3D chord = pointB - pointA;
+    const double chordLength = chord.length();
+    const double deviation = chordLength > 0.0
+        ? QVector3D::crossProduct(pointM - pointA, chord).length() / chordLength
+        : (pointM - pointA).length();
+
+    if (deviation > tolerance && depth < ADAPTIVE_MAX_DEPTH) {
+        subdivide(angleA, angleM, pointA, pointM, tolerance, depth + 1, points);
+        subdivide(angleM, angleB, pointM, pointB, tolerance, depth + 1, points);
+    } else {
+        points.append(pointB);
+    }
+}
+
+QVector<QVector3D> OrbitPath::orbitPoints() const
+{
+    if (m_pointsValid)
+        return m_points;
+
+    m_points.clear();
+
+    if (m_samplingMode == AdaptiveSampling) {
+        // === Subdivision jusqu'à l'erreur écran, avec marge ===
+        m_sampledTolerance = worldTolerance() * ADAPTIVE_TOLERANCE_MARGIN;
+
+        QVector3D previous = calculateOrbitPoint(0.0);
+        m_points.append(previous);
+        for (int i = 0; i < ADAPTIVE_INITIAL_SEGMENTS; ++i)
+        {
+            const double angleA = (2.0 * M_PI * i) / ADAPTIVE_INITIAL_SEGMENTS;
+            const double angleB = (2.0 * M_PI * (i + 1)) / ADAPTIVE_INITIAL_SEGMENTS;
+            const QVector3D next = calculateOrbitPoint(angleB);
+            subdivide(angleA, angleB, previous, next, m_sampledTolerance, 0, m_points);
+            previous = next;
+        }
+    } else {
+        m_points.reserve(m_resolution + 1);
+
+        // Génère les points sur 360° (une orbite complète)
+        for (int i = 0; i <= m_resolution; ++i)  // <= pour fermer la boucle
+        {
+            double angle = (2.0 * M_PI * i) / m_resolution;
+            m_points.append(calculateOrbitPoint(angle));
+        }
+    }
 
-    QVector3D firstPoint;
+    m_pointsValid = true;
+    return m_points;
+}
 
-    // Génère les points sur 360° (une orbite complète)
-    for (int i = 0; i <= m_resolution; ++i)  // <= pour fermer la boucle
-    {
-        double angle = (2.0 * M_PI * i) / m_resolution;
-        QVector3D point = calculateOrbitPoint(angle);
+QVariantList OrbitPath::generateOrbitPoints()
+{
+    const QVector<QVector3D> orbit = orbitPoints();
 
-        if (i == 0)
-            firstPoint = point;
+    QVariantList points;
+    points.reserve(orbit.size());
 
+    for (const QVector3D& point : orbit)
+    {
         // Convertir QVector3D en QVariantMap pour QML
         QVariantMap pointMap;
         pointMap["x"] = point.x();
@@ -4,6 +4,7 @@
 #include <QObject>
 #include <QVector3D>
 #include <QVariantList>
+#include <QVector>
 
 /**
  * @brief Génère les points de trajectoire orbitale pour visualisation 3D
@@ -11,6 +12,12 @@
  * Cette classe calcule une série de points représentant une orbite complète
  * basée sur les paramètres orbitaux (Kepler). Utilisée pour dessiner
  * des anneaux de trajectoire dans Qt Quick 3D.
+ *
+ * En mode adaptatif, les points sont placés par subdivision là où la corde
+ * s'écarte de l'ellipse de plus d'une tolérance déduite de l'erreur écran
+ * admise (pixels) et de la distance caméra : denses au périgée, espacés à
+ * l'apogée. Les points sont mis en cache et ne sont régénérés que si le
+ * budget d'erreur est dépassé (zoom avant) ou largement surdimensionné.
  */
 class OrbitPath : public QObject
 {
@@ -22,7 +29,24 @@ class OrbitPath : public QObject
     Q_PROPERTY(double inclination READ inclination WRITE setInclination NOTIFY inclinationChanged)
     Q_PROPERTY(int resolution READ resolution WRITE setResolution NOTIFY resolutionChanged)
 
+    // Échantillonnage adaptatif
+    Q_PROPERTY(SamplingMode samplingMode READ samplingMode WRITE setSamplingMode NOTIFY samplingModeChanged)
+    Q_PROPERTY(double cameraDistance READ cameraDistance WRITE setCameraDistance NOTIFY cameraDistanceChanged)
+    Q_PROPERTY(double fieldOfView READ fieldOfView WRITE setFieldOfView NOTIFY fieldOfViewChanged)
+    Q_PROPERTY(double viewportHeight READ viewportHeight WRITE setViewportHeight NOTIFY viewportHeightChanged)
+    Q_PROPERTY(double pixelError READ pixelError WRITE setPixelError NOTIFY pixelErrorChanged)
+    Q_PROPERTY(int sampleCount READ sampleCount NOTIFY orbitChanged)
+
 public:
+    /**
+     * @brief Répartition des points le long de l'orbite
+     */
+    enum SamplingMode {
+        UniformSampling = 0,    // resolution points, anomalie vraie uniforme
+        AdaptiveSampling        // Erreur de corde bornée par l'erreur écran
+    };
+    Q_ENUM(SamplingMode)
+
     explicit OrbitPath(QObject *parent = nullptr);
 
     // Getters
@@ -30,12 +54,23 @@ public:
     double eccentricity() const { return m_eccentricity; }
     double inclination() const { return m_inclination; }
     int resolution() const { return m_resolution; }
+    SamplingMode samplingMode() const { return m_samplingMode; }
+    double cameraDistance() const { return m_cameraDistance; }
+    double fieldOfView() const { return m_fieldOfView; }
+    double viewportHeight() const { return m_viewportHeight; }
+    double pixelError() const { return m_pixelError; }
+    int sampleCount() const { return orbitPoints().size(); }
 
     // Setters
     void setSemiMajorAxis(double value);
     void setEccentricity(double value);
     void setInclination(double value);
     void setResolution(int value);
+    void setSamplingMode(SamplingMode mode);
+    void setCameraDistance(double value);
+    void setFieldOfView(double degrees);
+    void setViewportHeight(double pixels);
+    void setPixelError(double pixels);
 
     /**
      * @brief Génère les points de l'orbite complète
@@ -43,11 +78,31 @@ public:
      */
     Q_INVOKABLE QVariantList generateOrbitPoints();
 
+    /**
+     * @brief Points de l'orbite complète (boucle fermée)
+     *
+     * resolution + 1 points en mode uniforme ; en mode adaptatif, juste
+     * assez pour respecter l'erreur écran. Calculés à la demande puis mis
+     * en cache jusqu'au prochain orbitChanged().
+     * @return Points bruts, pour OrbitGeometry
+     */
+    QVector<QVector3D> orbitPoints() const;
+
+    /**
+     * @brief Écart maximal corde/ellipse admis (unités de la scène)
+     */
+    double worldTolerance() const;
+
 signals:
     void semiMajorAxisChanged();
     void eccentricityChanged();
     void inclinationChanged();
     void resolutionChanged();
+    void samplingModeChanged();
+    void cameraDistanceChanged();
+    void fieldOfViewChanged();
+    void viewportHeightChanged();
+    void pixelErrorChanged();
     void orbitChanged(); // Signal global quand l'orbite change
 
 private:
@@ -56,12 +111,33 @@ private:
     double m_inclination = 45.0;     // Inclinaison en degrés
     int m_resolution = 128;          // Nombre de points pour tracer l'orbite
 
+    SamplingMode m_samplingMode = UniformSampling;
+    double m_cameraDistance = 1000.0;   // Distance caméra -> origine (unités de la scène)
+    double m_fieldOfView = 45.0;        // Champ vertical (degrés)
+    double m_viewportHeight = 800.0;    // Hauteur de la vue (pixels)
+    double m_pixelError = 0.5;          // Erreur écran admise (pixels)
+
+    // Cache des points (régénéré au besoin par orbitPoints())
+    mutable QVector<QVector3D> m_points;
+    mutable double m_sampledTolerance = 0.0;    // Erreur max des points en cache
+    mutable bool m_pointsValid = false;
+
     /**
      * @brief Calcule un point de l'orbite à un angle donné
      * @param angle Anomalie vraie en radians
      * @return Position 3D du point
      */
     QVector3D calculateOrbitPoint(double angle) const;
+
+    /**
+     * @brief Subdivise l'arc [angleA, angleB] jusqu'à l'écart de corde toléré
+     * @param points [out] Points ajoutés (pointB inclus, pointA exclu)
+     */
+    void subdivide(double angleA, double angleB, const QVector3D& pointA, const QVector3D& pointB,
+                   double tolerance, int depth, QVector<QVector3D>& points) const;
+
+    void invalidatePoints();
+    void updateViewError();
 };
 
 #endif // ORBITPATH_H
@@ -0,0 +1,85 @@
+#include "OrbitTrack.h"
+#include "../simulation/Frames.h"
+#include <QtMath>
+
+OrbitTrack::OrbitTrack(QObject *parent)
+    : GridTrack("Trace orbitale", parent)
+    , m_unitsPerKm(Frames::SCENE_UNITS_PER_KM)
+    , m_culled(false)
+{
+    resetWindow();
+}
+
+void OrbitTrack::setCuller(SatelliteCuller* culler)
+{
+    if (m_culler == culler)
+        return;
+
+    if (m_culler) {
+        disconnect(m_culler, nullptr, this, nullptr);
+    }
+
+    m_culler = culler;
+    if (m_culler) {
+        // Mouvement de caméra : la trace est rattrapée si l'objet redevient visible
+        connect(m_culler, &SatelliteCuller::culled, this, [this]() {
+            if (hasTime() && m_culled && !updateCulled()) {
+                refresh();
+            }
+        });
+    }
+
+    refresh();
+}
+
+bool OrbitTrack::updateCulled()
+{
+    bool culled = false;
+    if (m_culler) {
+        const SatelliteCuller::Lod lod = m_culler->classify(m_currentPosition, false);
+        culled = (lod == SatelliteCuller::OutsideFrustum || lod == SatelliteCuller::Skipped);
+    }
+
+    if (culled != m_culled) {
+        m_culled = culled;
+        emit culledChanged();
+    }
+    return m_culled;
+}
+
+void OrbitTrack::setUnitsPerKm(double unitsPerKm)
+{
+    if (qFuzzyCompare(m_unitsPerKm, unitsPerKm))
+        return;
+
+    m_unitsPerKm = unitsPerKm;
+    resetWindow();
+    emit windowChanged();
+    refresh();
+}
+
+void OrbitTrack::resizeRing(int capacity)
+{
+    m_ring.resize(capacity);
+}
+
+bool OrbitTrack::sample(int slot, double minutesSinceEpoch)
+{
+    double position[3] = { 0.0, 0.0, 0.0 };
+    const bool valid = stateAt(minutesSinceEpoch, position, nullptr);
+    m_ring[slot] = QVector3D(position[0] * m_unitsPerKm, position[1] * m_unitsPerKm, position[2] * m_unitsPerKm);
+    return valid;
+}
+
+bool OrbitTrack::updateCurrent(double minutesSinceEpoch)
+{
+    // Position exacte à l'instant courant, jonction entre passé et futur
+    double position[3];
+    if (stateAt(minutesSinceEpoch, position, nullptr)) {
+        m_currentPosition = QVector3D(position[0] * m_unitsPerKm, position[1] * m_unitsPerKm,
+                                      position[2] * m_unitsPerKm);
+    }
+
+    // Objet invisible : aucun échantillon, la fenêtre sera rattrapée plus tard
+    return !updateCulled();
+}
@@ -0,0 +1,72 @@
+#ifndef ORBITTRACK_H
+#define ORBITTRACK_H
+
+#include <QVector>
+#include <QVector3D>
+#include <QPointer>
+#include "GridTrack.h"
+#include "../rendering/SatelliteCuller.h"
+
+/**
+ * @brief Trace orbitale SGP4 glissante (passé + futur) d'un satellite
+ *
+ * Fenêtre et tampon circulaire de GridTrack ; chaque case contient la
+ * position TEME de son instant de grille. Les géométries (OrbitGeometry)
+ * ne recopient que les instants entrés ou sortis de la fenêtre.
+ *
+ * Avec un étage de culling, la trace n'est pas générée tant que l'objet
+ * est hors champ ou trop petit à l'écran (culled) : la fenêtre est
+ * rattrapée quand il redevient visible. L'occultation par la Terre seule
+ * ne suffit pas, la trace dépassant le limbe.
+ *
+ * Les positions sont exprimées en unités de la scène (repère TEME).
+ */
+class OrbitTrack : public GridTrack
+{
+    Q_OBJECT
+
+    // Propriétés exposées à QML
+    Q_PROPERTY(double unitsPerKm READ unitsPerKm WRITE setUnitsPerKm NOTIFY windowChanged)
+    Q_PROPERTY(QVector3D currentPosition READ currentPosition NOTIFY trackChanged)
+    Q_PROPERTY(bool culled READ isCulled NOTIFY culledChanged)
+
+public:
+    explicit OrbitTrack(QObject *parent = nullptr);
+
+    /**
+     * @brief Étage de culling consulté avant chaque mise à jour (optionnel)
+     */
+    void setCuller(SatelliteCuller* culler);
+    SatelliteCuller* culler() const { return m_culler; }
+
+    // Getters
+    double unitsPerKm() const { return m_unitsPerKm; }
+    QVector3D currentPosition() const { return m_currentPosition; }
+    bool isCulled() const { return m_culled; }
+
+    // Setters (la fenêtre est reconstruite à la prochaine mise à jour)
+    void setUnitsPerKm(double unitsPerKm);
+
+    // === Tampon circulaire (lecture par les géométries) ===
+    const QVector3D& sampleAt(int slot) const { return m_ring[slot]; }
+
+signals:
+    void culledChanged();
+
+protected:
+    void resizeRing(int capacity) override;
+    bool sample(int slot, double minutesSinceEpoch) override;
+    bool updateCurrent(double minutesSinceEpoch) override;
+
+private:
+    QPointer<SatelliteCuller> m_culler;
+    double m_unitsPerKm;
+
+    QVector<QVector3D> m_ring;      // Positions (unités de la scène), une par case
+    QVector3D m_currentPosition;
+    bool m_culled;
+
+    bool updateCulled();
+};
+
+#endif // ORBITTRACK_H
@@ -0,0 +1,418 @@
+#include "Profiler.h"
+#include <QQuickWindow>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QThread>
+#include <QVector>
+#include <QDebug>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Publication des moyennes vers QML
+const int PUBLISH_INTERVAL_MS = 250;
+
+// Événements conservés par thread (les plus anciens sont écrasés)
+const int RING_CAPACITY = 1 << 14;
+
+namespace {
+
+struct TraceEvent {
+    enum Kind : qint32 { Complete = 0, CounterSample };
+
+    const char* name;
+    qint64 start;           // ns (Profiler::now)
+    qint64 value;           // Durée (ns) ou valeur du compteur
+    qint32 kind;
+};
+
+/**
+ * @brief Tampon circulaire d'un thread : un seul écrivain (le thread lui-même)
+ *
+ * L'écrivain remplit la case puis publie le nouveau total (release) ; le
+ * lecteur copie les cases et relit le total pour écarter celles écrasées
+ * pendant la copie.
+ */
+struct ThreadBuffer {
+    TraceEvent events[RING_CAPACITY];
+    std::atomic<quint64> written{0};
+    int index = 0;
+    QString threadName;
+
+    void push(const char* name, qint64 start, qint64 value, qint32 kind)
+    {
+        const quint64 n = written.load(std::memory_order_relaxed);
+        TraceEvent& event = events[n & (RING_CAPACITY - 1)];
+        event.name = name;
+        event.start = start;
+        event.value = value;
+        event.kind = kind;
+        written.store(n + 1, std::memory_order_release);
+    }
+};
+
+/**
+ * @brief Tampons de tous les threads ayant enregistré au moins une mesure
+ *
+ * Jamais détruit : un thread de travail peut encore écrire pendant la
+ * destruction des objets statiques.
+ */
+struct Registry {
+    QMutex mutex;
+    QVector<ThreadBuffer*> buffers;
+};
+
+Registry& registry()
+{
+    static Registry* instance = new Registry;
+    return *instance;
+}
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+ThreadBuffer* threadBuffer()
+{
+    if (!t_buffer) {
+        ThreadBuffer* buffer = new ThreadBuffer;
+        const QString name = QThread::currentThread()->objectName();
+
+        Registry& r = registry();
+        QMutexLocker locker(&r.mutex);
+        buffer->index = r.buffers.size();
+        buffer->threadName = !name.isEmpty() ? name
+                             : (qApp && QThread::currentThread() == qApp->thread()) ? QStringLiteral("GUI")
+                             : QStringLiteral("Thread %1").arg(buffer->index);
+        r.buffers.append(buffer);
+        t_buffer = buffer;
+    }
+    return t_buffer;
+}
+
+const QElapsedTimer& monotonicClock()
+{
+    static const QElapsedTimer timer = []() {
+        QElapsedTimer t;
+        t.start();
+        return t;
+    }();
+    return timer;
+}
+
+// Durées de l'image en cours, par métrique (ns)
+std::atomic<qint64> s_frameAccumulators[Profiler::MetricCount];
+
+} // namespace
+
+std::atomic<bool> Profiler::s_enabled(false);
+std::atomic<qint64> Profiler::s_counters[Profiler::CounterCount];
+
+// ============================================
+// ALLOCATIONS C++ (compteur Profiler::Allocations)
+// ============================================
+
+#if defined(ORBIFRANCE_PROFILING)
+// Remplacement des opérateurs globaux de l'exécutable : un test de
+// l'indicateur d'activation par allocation, rien d'autre
+void* operator new(std::size_t size)
+{
+    Profiler::count(Profiler::Allocations);
+    if (void* pointer = std::malloc(size ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+#endif
+
+// ============================================
+// CHEMIN CRITIQUE
+// ============================================
+
+qint64 Profiler::now()
+{
+    return monotonicClock().nsecsElapsed();
+}
+
+void Profiler::record(const char* name, qint64 startNs, qint64 durationNs, Metric metric)
+{
+    if (metric != NoMetric) {
+        s_frameAccumulators[metric].fetch_add(durationNs, std::memory_order_relaxed);
+    }
+    threadBuffer()->push(name, startNs, durationNs, TraceEvent::Complete);
+}
+
+// ============================================
+// OBJET QML
+// ============================================
+
+Profiler::Profiler(QObject *parent)
+    : QObject(parent)
+    , m_lastFrameEnd(-1)
+    , m_syncStart(-1)
+    , m_renderStart(-1)
+    , m_windowFrames(0)
+    , m_windowFrameMax(0.0)
+    , m_frameTimeMaxMs(0.0)
+    , m_framesPerSecond(0.0)
+{
+    std::memset(m_windowSum, 0, sizeof(m_windowSum));
+    std::memset(m_windowCounterStart, 0, sizeof(m_windowCounterStart));
+    std::memset(m_frameCounterLast, 0, sizeof(m_frameCounterLast));
+    std::memset(m_published, 0, sizeof(m_published));
+    std::memset(m_publishedCounters, 0, sizeof(m_publishedCounters));
+
+    m_publishTimer.setInterval(PUBLISH_INTERVAL_MS);
+    connect(&m_publishTimer, &QTimer::timeout, this, &Profiler::publish);
+}
+
+Profiler::~Profiler()
+{
+    s_enabled.store(false);
+}
+
+void Profiler::setEnabled(bool enabled)
+{
+    if (s_enabled.load() == enabled)
+        return;
+
+    {
+        QMutexLocker locker(&m_frameMutex);
+        m_lastFrameEnd = -1;
+        m_windowFrames = 0;
+        m_windowFrameMax = 0.0;
+        std::memset(m_windowSum, 0, sizeof(m_windowSum));
+        for (int c = 0; c < CounterCount; ++c) {
+            m_windowCounterStart[c] = s_counters[c].load();
+        }
+        for (int m = 0; m < MetricCount; ++m) {
+            s_frameAccumulators[m].store(0);
+        }
+    }
+
+    s_enabled.store(enabled);
+    if (enabled) {
+        m_publishTimer.start();
+    } else {
+        m_publishTimer.stop();
+    }
+
+    qDebug() << (enabled ? "⏱️ Profilage activé" : "⏱️ Profilage désactivé");
+    emit enabledChanged();
+}
+
+qint64 Profiler::recordedEvents() const
+{
+    Registry& r = registry();
+    QMutexLocker locker(&r.mutex);
+
+    qint64 total = 0;
+    for (const ThreadBuffer* buffer : std::as_const(r.buffers)) {
+        total += qMin<quint64>(buffer->written.load(std::memory_order_acquire), RING_CAPACITY);
+    }
+    return total;
+}
+
+void Profiler::attachToWindow(QQuickWindow* window)
+{
+    if (m_window) {
+        disconnect(m_window, nullptr, this, nullptr);
+    }
+
+    m_window = window;
+    if (!m_window) {
+        return;
+    }
+
+    // Signaux du thread de rendu : traités sur place (DirectConnection)
+    connect(m_window, &QQuickWindow::beforeSynchronizing, this, [this]() {
+        m_syncStart = enabled() ? now() : -1;
+    }, Qt::DirectConnection);
+    connect(m_window, &QQuickWindow::afterSynchronizing, this, [this]() {
+        if (m_syncStart >= 0) {
+            record("Synchronisation", m_syncStart, now() - m_syncStart, RenderSync);
+        }
+    }, Qt::DirectConnection);
+    connect(m_window, &QQuickWindow::beforeRendering, this, [this]() {
+        m_renderStart = enabled() ? now() : -1;
+    }, Qt::DirectConnection);
+    connect(m_window, &QQuickWindow::afterRendering, this, [this]() {
+        if (m_renderStart >= 0) {
+            record("Rendu", m_renderStart, now() - m_renderStart, Render);
+        }
+    }, Qt::DirectConnection);
+    connect(m_window, &QQuickWindow::frameSwapped, this, &Profiler::endFrame,
+            Qt::DirectConnection);
+}
+
+void Profiler::endFrame()
+{
+    if (!enabled()) {
+        return;
+    }
+
+    const qint64 end = now();
+    QMutexLocker locker(&m_frameMutex);
+
+    if (m_lastFrameEnd >= 0) {
+        const qint64 frameTime = end - m_lastFrameEnd;
+        ThreadBuffer* buffer = threadBuffer();
+        buffer->push("Image", m_lastFrameEnd, frameTime, TraceEvent::Complete);
+
+        m_windowSum[FrameTime] += frameTime;
+        m_windowFrameMax = qMax(m_windowFrameMax, double(frameTime));
+        for (int m = FrameTime + 1; m < MetricCount; ++m) {
+            m_windowSum[m] += s_frameAccumulators[m].exchange(0, std::memory_order_relaxed);
+        }
+        ++m_windowFrames;
+
+        // Compteurs : valeur de l'image écoulée, échantillonnée pour la trace
+        static const char* const COUNTER_NAMES[CounterCount] = {
+            "Propagations", "Objets propagés", "Allocations", "Objets écartés"
+        };
+        for (int c = 0; c < CounterCount; ++c) {
+            const qint64 total = s_counters[c].load(std::memory_order_relaxed);
+            buffer->push(COUNTER_NAMES[c], end, total - m_frameCounterLast[c], TraceEvent::CounterSample);
+            m_frameCounterLast[c] = total;
+        }
+    } else {
+        for (int c = 0; c < CounterCount; ++c) {
+            m_frameCounterLast[c] = s_counters[c].load(std::memory_order_relaxed);
+        }
+        for (int m = 0; m < MetricCount; ++m) {
+            s_frameAccumulators[m].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    m_lastFrameEnd = end;
+}
+
+void Profiler::publish()
+{
+    QMutexLocker locker(&m_frameMutex);
+
+    const int frames = m_windowFrames;
+    if (frames == 0) {
+        return;
+    }
+
+    for (int m = 0; m < MetricCount; ++m) {
+        m_published[m] = m_windowSum[m] / frames / 1.0e6;
+        m_windowSum[m] = 0.0;
+    }
+    for (int c = 0; c < CounterCount; ++c) {
+        const qint64 total = s_counters[c].load();
+        m_publishedCounters[c] = double(total - m_windowCounterStart[c]) / frames;
+        m_windowCounterStart[c] = total;
+    }
+
+    m_frameTimeMaxMs = m_windowFrameMax / 1.0e6;
+    m_framesPerSecond = m_published[FrameTime] > 0.0 ? 1000.0 / m_published[FrameTime] : 0.0;
+    m_windowFrameMax = 0.0;
+    m_windowFrames = 0;
+
+    locker.unlock();
+    emit statsChanged();
+}
+
+QString Profiler::exportChromeTrace(const QString& path)
+{
+    QString outputPath = path;
+    if (outputPath.isEmpty()) {
+        const QString directory = QCoreApplication::applicationDirPath() + "/../traces";
+        QDir().mkpath(directory);
+        outputPath = QDir(directory).absoluteFilePath(
+            QStringLiteral("orbifrance-%1.json").arg(QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss")));
+    }
+
+    QVector<ThreadBuffer*> buffers;
+    {
+        Registry& r = registry();
+        QMutexLocker locker(&r.mutex);
+        buffers = r.buffers;
+    }
+
+    QJsonArray events;
+    QJsonObject process;
+    process["name"] = QStringLiteral("process_name");
+    process["ph"] = QStringLiteral("M");
+    process["pid"] = 1;
+    process["args"] = QJsonObject{ { "name", QCoreApplication::applicationName() } };
+    events.append(process);
+
+    QVector<TraceEvent> snapshot(RING_CAPACITY);
+    for (ThreadBuffer* buffer : std::as_const(buffers)) {
+        QJsonObject thread;
+        thread["name"] = QStringLiteral("thread_name");
+        thread["ph"] = QStringLiteral("M");
+        thread["pid"] = 1;
+        thread["tid"] = buffer->index;
+        thread["args"] = QJsonObject{ { "name", buffer->threadName } };
+        events.append(thread);
+
+        // Copie puis relecture du total : les cases réécrites entre-temps sont écartées
+        const quint64 end = buffer->written.load(std::memory_order_acquire);
+        const quint64 begin = end > quint64(RING_CAPACITY) ? end - RING_CAPACITY : 0;
+        for (quint64 i = begin; i < end; ++i) {
+            snapshot[int(i - begin)] = buffer->events[i & (RING_CAPACITY - 1)];
+        }
+        // Barrière : la copie ne peut pas être réordonnée après la relecture
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const quint64 after = buffer->written.load(std::memory_order_relaxed);
+        const quint64 firstValid = after > quint64(RING_CAPACITY) ? after - RING_CAPACITY : 0;
+
+        for (quint64 i = qMax(begin, firstValid); i < end; ++i) {
+            const TraceEvent& event = snapshot[int(i - begin)];
+            QJsonObject json;
+            json["name"] = QString::fromUtf8(event.name);
+            json["pid"] = 1;
+            json["tid"] = buffer->index;
+            json["ts"] = event.start / 1000.0;     // µs
+            if (event.kind == TraceEvent::Complete) {
+                json["cat"] = QStringLiteral("orbifrance");
+                json["ph"] = QStringLiteral("X");
+                json["dur"] = event.value / 1000.0;
+            } else {
+                json["ph"] = QStringLiteral("C");
+                json["args"] = QJsonObject{ { "value", double(event.value) } };
+            }
+            events.append(json);
+        }
+    }
+
+    QJsonObject counters;
+    counters["propagations"] = double(s_counters[Propagations].load());
+    counters["propagated_objects"] = double(s_counters[PropagatedObjects].load());
+    counters["allocations"] = double(s_counters[Allocations].load());
+    counters["culled_objects"] = double(s_counters[CulledObjects].load());
+
+    QJsonObject trace;
+    trace["traceEvents"] = events;
+    trace["displayTimeUnit"] = QStringLiteral("ms");
+    trace["otherData"] = QJsonObject{ { "counters", counters } };
+
+    QSaveFile file(outputPath);
+    const QByteArray json = QJsonDocument(trace).toJson(QJsonDocument::Compact);
+    if (!file.open(QIODevice::WriteOnly) || file.write(json) != json.size() || !file.commit()) {
+        qWarning() << "❌ Export de la trace impossible:" << outputPath;
+        return QString();
+    }
+
+    qDebug() << "⏱️ Trace Chrome exportée:" << outputPath << "(" << events.size() << "événements )";
+    return outputPath;
+}
@@ -0,0 +1,199 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <QObject>
+#include <QPointer>
+#include <QMutex>
+#include <QTimer>
+#include <atomic>
+
+class QQuickWindow;
+
+/**
+ * @brief Instrumentation des chemins critiques (temps par image, compteurs, trace)
+ *
+ * Trois niveaux, du plus fréquent au plus rare :
+ *  - ORBI_PROFILE_SCOPE : minuteur de portée ; chaque mesure est écrite
+ *    dans un tampon circulaire propre au thread appelant (sans verrou ni
+ *    allocation passé la première mesure du thread), et cumulée dans une
+ *    métrique de l'image courante ;
+ *  - Profiler::count : compteurs atomiques (propagations, allocations,
+ *    objets écartés par le culling) ;
+ *  - objet Profiler (QML) : moyennes publiées 4 fois par seconde pour
+ *    l'overlay, export de la trace au format Chrome (chrome://tracing,
+ *    Perfetto).
+ *
+ * Désactivé (cas par défaut), une portée coûte une lecture atomique et un
+ * test. Compilé sans ORBIFRANCE_PROFILING, les macros disparaissent.
+ */
+class Profiler : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged)
+
+    // Moyennes par image sur la dernière période de publication (ms)
+    Q_PROPERTY(double frameTimeMs READ frameTimeMs NOTIFY statsChanged)
+    Q_PROPERTY(double frameTimeMaxMs READ frameTimeMaxMs NOTIFY statsChanged)
+    Q_PROPERTY(double framesPerSecond READ framesPerSecond NOTIFY statsChanged)
+    Q_PROPERTY(double propagationMs READ propagationMs NOTIFY statsChanged)
+    Q_PROPERTY(double cullingMs READ cullingMs NOTIFY statsChanged)
+    Q_PROPERTY(double syncMs READ syncMs NOTIFY statsChanged)
+    Q_PROPERTY(double renderMs READ renderMs NOTIFY statsChanged)
+
+    // Compteurs par image (moyennes)
+    Q_PROPERTY(double propagatedObjectsPerFrame READ propagatedObjectsPerFrame NOTIFY statsChanged)
+    Q_PROPERTY(double allocationsPerFrame READ allocationsPerFrame NOTIFY statsChanged)
+    Q_PROPERTY(double culledObjectsPerFrame READ culledObjectsPerFrame NOTIFY statsChanged)
+    Q_PROPERTY(qint64 recordedEvents READ recordedEvents NOTIFY statsChanged)
+
+public:
+    /**
+     * @brief Durées cumulées par image
+     */
+    enum Metric {
+        NoMetric = -1,
+        FrameTime = 0,      // Intervalle entre deux images présentées
+        Propagation,        // SGP4 (catalogue, traces)
+        Culling,            // Classement frustum / occultation / LOD
+        RenderSync,         // Synchronisation scène -> thread de rendu
+        Render,             // Préparation et envoi des commandes GPU
+        MetricCount
+    };
+    Q_ENUM(Metric)
+
+    /**
+     * @brief Compteurs cumulés (totaux depuis le lancement, activé uniquement)
+     */
+    enum Counter {
+        Propagations = 0,   // Propagations complètes d'un lot
+        PropagatedObjects,  // Objets propagés
+        Allocations,        // Allocations C++ (operator new)
+        CulledObjects,      // Objets écartés (hors champ, cachés, ignorés)
+        CounterCount
+    };
+    Q_ENUM(Counter)
+
+    explicit Profiler(QObject *parent = nullptr);
+    ~Profiler() override;
+
+    // === Chemin critique (appelable depuis n'importe quel thread) ===
+
+    static bool enabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Horloge monotone commune à tous les threads (ns)
+     */
+    static qint64 now();
+
+    /**
+     * @brief Enregistre une mesure terminée
+     * @param name Libellé statique (littéral : seul le pointeur est conservé)
+     */
+    static void record(const char* name, qint64 startNs, qint64 durationNs, Metric metric = NoMetric);
+
+    static void count(Counter counter, qint64 amount = 1)
+    {
+        if (enabled()) {
+            s_counters[counter].fetch_add(amount, std::memory_order_relaxed);
+        }
+    }
+
+    // === Objet QML (thread GUI) ===
+
+    bool isEnabled() const { return enabled(); }
+    void setEnabled(bool enabled);
+
+    double frameTimeMs() const { return m_published[FrameTime]; }
+    double frameTimeMaxMs() const { return m_frameTimeMaxMs; }
+    double framesPerSecond() const { return m_framesPerSecond; }
+    double propagationMs() const { return m_published[Propagation]; }
+    double cullingMs() const { return m_published[Culling]; }
+    double syncMs() const { return m_published[RenderSync]; }
+    double renderMs() const { return m_published[Render]; }
+    double propagatedObjectsPerFrame() const { return m_publishedCounters[PropagatedObjects]; }
+    double allocationsPerFrame() const { return m_publishedCounters[Allocations]; }
+    double culledObjectsPerFrame() const { return m_publishedCounters[CulledObjects]; }
+    qint64 recordedEvents() const;
+
+    /**
+     * @brief Mesure le rythme d'images, la synchronisation et le rendu de la fenêtre
+     */
+    void attachToWindow(QQuickWindow* window);
+
+    /**
+     * @brief Écrit les tampons de tous les threads au format Chrome trace
+     * @param path Fichier de sortie ; vide : traces/orbifrance-<date>.json à côté de bin/
+     * @return Chemin écrit, vide en cas d'échec
+     */
+    Q_INVOKABLE QString exportChromeTrace(const QString& path = QString());
+
+signals:
+    void enabledChanged();
+    void statsChanged();
+
+private:
+    static std::atomic<bool> s_enabled;
+    static std::atomic<qint64> s_counters[CounterCount];
+
+    QPointer<QQuickWindow> m_window;
+    QTimer m_publishTimer;
+
+    // Fin d'image (thread de rendu) -> publication (thread GUI)
+    QMutex m_frameMutex;
+    qint64 m_lastFrameEnd;
+    qint64 m_syncStart;
+    qint64 m_renderStart;
+    int m_windowFrames;
+    double m_windowSum[MetricCount];
+    double m_windowFrameMax;
+    qint64 m_windowCounterStart[CounterCount];
+    qint64 m_frameCounterLast[CounterCount];
+
+    double m_published[MetricCount];
+    double m_publishedCounters[CounterCount];
+    double m_frameTimeMaxMs;
+    double m_framesPerSecond;
+
+    void endFrame();
+    void publish();
+};
+
+/**
+ * @brief Minuteur de portée : mesure du constructeur au destructeur
+ */
+class ProfileScope
+{
+public:
+    ProfileScope(const char* name, Profiler::Metric metric = Profiler::NoMetric)
+        : m_name(name)
+        , m_metric(metric)
+        , m_start(Profiler::enabled() ? Profiler::now() : -1)
+    {
+    }
+
+    ~ProfileScope()
+    {
+        if (m_start >= 0) {
+            Profiler::record(m_name, m_start, Profiler::now() - m_start, m_metric);
+        }
+    }
+
+private:
+    Q_DISABLE_COPY(ProfileScope)
+
+    const char* m_name;
+    Profiler::Metric m_metric;
+    qint64 m_start;
+};
+
+#if defined(ORBIFRANCE_PROFILING)
+#define ORBI_PROFILE_CONCAT_(a, b) a##b
+#define ORBI_PROFILE_CONCAT(a, b) ORBI_PROFILE_CONCAT_(a, b)
+#define ORBI_PROFILE_SCOPE(...) ProfileScope ORBI_PROFILE_CONCAT(profileScope_, __LINE__)(__VA_ARGS__)
+#define ORBI_PROFILE_COUNT(...) Profiler::count(__VA_ARGS__)
+#else
+#define ORBI_PROFILE_SCOPE(...) do {} while (false)
+#define ORBI_PROFILE_COUNT(...) do { if (false) Profiler::count(__VA_ARGS__); } while (false)
+#endif
+
+#endif // PROFILER_H
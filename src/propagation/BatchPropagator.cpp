@@ -0,0 +1,429 @@
+#include "BatchPropagator.h"
+#include "../data/TLEParser.h"
+#include <QElapsedTimer>
+#include <QPair>
+#include <QThread>
+#include <QVarLengthArray>
+#include <QDebug>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+// Includes complets de libsgp4
+#include "SGP4.h"
+#include "Tle.h"
+#include "Eci.h"
+#include "DecayedException.h"
+
+// Date julienne de J2000
+const double JD_J2000 = 2451545.0;
+
+// Satellites proche Terre propagés par bloc (états intermédiaires sur la pile)
+const int NEAR_CHUNK = 256;
+
+// Rayon équatorial (km) pour les altitudes d'apogée
+const double EARTH_RADIUS_KM = 6378.135;
+
+OrbitRegime::Code OrbitRegime::classify(const ElementSet& set)
+{
+    if (set.eccentricity > 0.25) {
+        return HighlyElliptical;
+    }
+
+    const double apogeeAltitude = set.semiMajorAxis * (1.0 + set.eccentricity) - EARTH_RADIUS_KM;
+    if (apogeeAltitude < 2000.0) {
+        return LowEarth;
+    }
+    if (set.period >= 1300.0 && set.period <= 1500.0) {
+        return Geosynchronous;
+    }
+    return MediumEarth;
+}
+
+const char* OrbitRegime::name(Code code)
+{
+    switch (code) {
+    case LowEarth:         return "LEO";
+    case MediumEarth:      return "MEO";
+    case Geosynchronous:   return "GEO";
+    case HighlyElliptical: return "HEO";
+    }
+    return "inconnu";
+}
+
+// Accélération gravitationnelle (centrale + J2) évaluée en double
+template <typename Real>
+static inline void writeAcceleration(double x, double y, double z, Real* a)
+{
+    double ax, ay, az;
+    SGP4Kernel::gravityAcceleration(x, y, z, ax, ay, az);
+    a[0] = static_cast<Real>(ax);
+    a[1] = static_cast<Real>(ay);
+    a[2] = static_cast<Real>(az);
+}
+
+BatchPropagator::BatchPropagator(QObject *parent)
+    : QObject(parent)
+    , m_deepSpaceDecayedAfter(nullptr)
+    , m_deepSpaceBusy(nullptr)
+{
+}
+
+BatchPropagator::~BatchPropagator()
+{
+    clear();
+}
+
+void BatchPropagator::clear()
+{
+    qDeleteAll(m_deepSpace);
+    m_deepSpace.clear();
+    m_deepSpaceEpoch.clear();
+    m_deepSpaceIndex.clear();
+    delete[] m_deepSpaceDecayedAfter;
+    m_deepSpaceDecayedAfter = nullptr;
+    delete[] m_deepSpaceBusy;
+    m_deepSpaceBusy = nullptr;
+
+    m_near.clear();
+    m_nearIndex.clear();
+
+    m_regimes.clear();
+    m_initStatus.clear();
+    m_status.clear();
+    m_summary = SGP4StatusSummary();
+    m_reportedSummary = SGP4StatusSummary();
+    m_count = 0;
+}
+
+int BatchPropagator::initialize(const ElementSet* sets, int count)
+{
+    clear();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    m_count = count;
+    m_initStatus.fill(SGP4Status::Ok, count);
+    m_status.fill(SGP4Status::NotInitialized, count);
+
+    m_regimes.resize(count);
+
+    // Répartition proche Terre / espace lointain
+    for (int i = 0; i < count; ++i) {
+        m_regimes[i] = OrbitRegime::classify(sets[i]);
+        if (SGP4Kernel::isDeepSpace(sets[i])) {
+            m_deepSpaceIndex.append(i);
+        } else {
+            m_nearIndex.append(i);
+        }
+    }
+
+    // === PROCHE TERRE : constantes en structure de tableaux ===
+    const int nearCount = m_nearIndex.size();
+    m_near.resize(nearCount);
+
+    int slot = 0;
+    QVector<int> acceptedNear;
+    acceptedNear.reserve(nearCount);
+    for (int index : m_nearIndex) {
+        SGP4Status::Code status = SGP4Kernel::initialize(sets[index], m_near, slot);
+        if (status == SGP4Status::Ok) {
+            acceptedNear.append(index);
+            ++slot;
+        } else {
+            m_initStatus[index] = status;
+        }
+    }
+    m_nearIndex = acceptedNear;
+    m_near.resize(slot);
+
+    // === ESPACE LOINTAIN : un objet libsgp4 par satellite ===
+    QVector<int> acceptedDeep;
+    for (int index : m_deepSpaceIndex) {
+        try {
+            TLEData tle = TLEParser::fromElementSet(sets[index]);
+            libsgp4::Tle tleObj(tle.name.toStdString(),
+                                tle.line1.toStdString(),
+                                tle.line2.toStdString());
+
+            m_deepSpace.append(new libsgp4::SGP4(tleObj));
+            m_deepSpaceEpoch.append(SGP4Kernel::epochJ2000(sets[index]));
+            acceptedDeep.append(index);
+
+        } catch (const std::exception& e) {
+            qWarning() << "❌ Erreur initialisation SGP4 (NORAD" << sets[index].noradId << "):" << e.what();
+            m_initStatus[index] = SGP4Status::InvalidElements;
+        }
+    }
+    m_deepSpaceIndex = acceptedDeep;
+
+    m_deepSpaceDecayedAfter = new std::atomic<double>[acceptedDeep.size()];
+    m_deepSpaceBusy = new std::atomic<bool>[acceptedDeep.size()];
+    for (int k = 0; k < acceptedDeep.size(); ++k) {
+        m_deepSpaceDecayedAfter[k].store(std::numeric_limits<double>::infinity());
+        m_deepSpaceBusy[k].store(false);
+    }
+
+    const int initialized = m_nearIndex.size() + m_deepSpaceIndex.size();
+
+    qDebug() << "🛰️ BatchPropagator:" << initialized << "/" << count << "satellites initialisés"
+             << "(" << m_nearIndex.size() << "proche Terre," << m_deepSpaceIndex.size()
+             << "espace lointain ) en" << timer.elapsed() << "ms, noyau"
+             << SGP4Kernel::implementationName(SGP4Kernel::implementation());
+
+    return initialized;
+}
+
+int BatchPropagator::initialize(const BatchPropagator& source)
+{
+    if (&source == this) {
+        return m_nearIndex.size() + m_deepSpaceIndex.size();
+    }
+
+    clear();
+
+    // === PROCHE TERRE : tableaux partagés, jamais modifiés après initialisation ===
+    m_count = source.m_count;
+    m_near = source.m_near;
+    m_nearIndex = source.m_nearIndex;
+    m_regimes = source.m_regimes;
+    m_initStatus = source.m_initStatus;
+    m_status.fill(SGP4Status::NotInitialized, m_count);
+
+    // === ESPACE LOINTAIN : objets libsgp4 propres à la copie ===
+    const int deepCount = source.m_deepSpace.size();
+    m_deepSpace.reserve(deepCount);
+    for (const libsgp4::SGP4* sgp4 : source.m_deepSpace) {
+        m_deepSpace.append(new libsgp4::SGP4(*sgp4));
+    }
+    m_deepSpaceEpoch = source.m_deepSpaceEpoch;
+    m_deepSpaceIndex = source.m_deepSpaceIndex;
+
+    m_deepSpaceDecayedAfter = new std::atomic<double>[deepCount];
+    m_deepSpaceBusy = new std::atomic<bool>[deepCount];
+    for (int k = 0; k < deepCount; ++k) {
+        m_deepSpaceDecayedAfter[k].store(source.m_deepSpaceDecayedAfter[k].load(std::memory_order_relaxed));
+        m_deepSpaceBusy[k].store(false);
+    }
+
+    return m_nearIndex.size() + m_deepSpaceIndex.size();
+}
+
+void BatchPropagator::propagate(double julianDate, double* positions, double* velocities,
+                                double* accelerations)
+{
+    propagateImpl(julianDate - JD_J2000, 0, m_count, positions, velocities, accelerations,
+                  m_status.data());
+    reportStatus();
+}
+
+void BatchPropagator::propagate(double julianDate, float* positions, float* velocities,
+                                float* accelerations)
+{
+    propagateImpl(julianDate - JD_J2000, 0, m_count, positions, velocities, accelerations,
+                  m_status.data());
+    reportStatus();
+}
+
+void BatchPropagator::propagateSeries(double startJulian, double stepSeconds, int count,
+                                      float* positions, float* velocities,
+                                      float* accelerations)
+{
+    const double startJ2000 = startJulian - JD_J2000;
+    const double stepDays = stepSeconds / 86400.0;
+    const qsizetype stride = 3 * qsizetype(m_count);
+
+    for (int k = 0; k < count; ++k) {
+        propagateImpl(startJ2000 + k * stepDays, 0, m_count,
+                      positions + k * stride,
+                      velocities ? velocities + k * stride : nullptr,
+                      accelerations ? accelerations + k * stride : nullptr,
+                      m_status.data());
+    }
+    reportStatus();
+}
+
+void BatchPropagator::reportStatus()
+{
+    m_summary = SGP4StatusSummary();
+    m_summary.add(m_status.constData(), m_count);
+
+    if (!m_summary.hasErrors()) {
+        m_reportedSummary = m_summary;
+        return;
+    }
+
+    // Un log seulement quand le bilan change, pas à chaque image
+    if (m_summary != m_reportedSummary) {
+        qWarning() << "⚠️ BatchPropagator:" << m_summary.failed() << "/" << m_count
+                   << "satellites en échec, dont" << m_summary.count(SGP4Status::Decayed) << "retombés";
+        m_reportedSummary = m_summary;
+    }
+
+    emit propagationErrors(m_summary);
+}
+
+void BatchPropagator::propagateRange(double julianDate, int begin, int end,
+                                     double* positions, double* velocities, quint8* status,
+                                     double* accelerations) const
+{
+    propagateImpl(julianDate - JD_J2000, begin, end, positions, velocities, accelerations, status);
+}
+
+void BatchPropagator::propagateRange(double julianDate, int begin, int end,
+                                     float* positions, float* velocities, quint8* status,
+                                     float* accelerations) const
+{
+    propagateImpl(julianDate - JD_J2000, begin, end, positions, velocities, accelerations, status);
+}
+
+template <typename Real>
+void BatchPropagator::propagateImpl(double timeJ2000, int begin, int end,
+                                    Real* positions, Real* velocities, Real* accelerations,
+                                    quint8* status) const
+{
+    begin = qMax(begin, 0);
+    end = qMin(end, m_count);
+    if (begin >= end) {
+        return;
+    }
+
+    // Satellites rejetés : sortie à zéro
+    std::memset(positions + 3 * begin, 0, sizeof(Real) * 3 * (end - begin));
+    if (velocities) {
+        std::memset(velocities + 3 * begin, 0, sizeof(Real) * 3 * (end - begin));
+    }
+    if (accelerations) {
+        std::memset(accelerations + 3 * begin, 0, sizeof(Real) * 3 * (end - begin));
+    }
+    if (status) {
+        std::memcpy(status + begin, m_initStatus.constData() + begin, end - begin);
+    }
+
+    // Les index sont croissants : la tranche correspond à un intervalle contigu
+    auto sliceOf = [begin, end](const QVector<int>& indices) {
+        const int first = std::lower_bound(indices.constBegin(), indices.constEnd(), begin) - indices.constBegin();
+        const int last = std::lower_bound(indices.constBegin(), indices.constEnd(), end) - indices.constBegin();
+        return qMakePair(first, last);
+    };
+
+    // === PROCHE TERRE : boucle unique sur les tableaux, par blocs ===
+    const QPair<int, int> near = sliceOf(m_nearIndex);
+
+    double x[NEAR_CHUNK], y[NEAR_CHUNK], z[NEAR_CHUNK];
+    double vx[NEAR_CHUNK], vy[NEAR_CHUNK], vz[NEAR_CHUNK];
+    quint8 nearStatus[NEAR_CHUNK];
+    SGP4StateArrays states{ x, y, z, vx, vy, vz, nearStatus };
+
+    for (int first = near.first; first < near.second; first += NEAR_CHUNK) {
+        const int count = qMin(NEAR_CHUNK, near.second - first);
+        SGP4Kernel::propagate(m_near, first, first + count, timeJ2000, states);
+
+        for (int j = 0; j < count; ++j) {
+            const int i = m_nearIndex[first + j];
+            if (status) {
+                status[i] = nearStatus[j];
+            }
+            if (nearStatus[j] != SGP4Status::Ok) {
+                continue;
+            }
+
+            Real* p = positions + 3 * i;
+            p[0] = static_cast<Real>(x[j]);
+            p[1] = static_cast<Real>(y[j]);
+            p[2] = static_cast<Real>(z[j]);
+
+            if (velocities) {
+                Real* v = velocities + 3 * i;
+                v[0] = static_cast<Real>(vx[j]);
+                v[1] = static_cast<Real>(vy[j]);
+                v[2] = static_cast<Real>(vz[j]);
+            }
+            if (accelerations) {
+                writeAcceleration(x[j], y[j], z[j], accelerations + 3 * i);
+            }
+        }
+    }
+
+    // === ESPACE LOINTAIN : chemin scalaire libsgp4 ===
+    // Un objet libsgp4 n'est propagé que par un thread à la fois : ceux
+    // qu'un autre thread propage déjà sont repris à la fin de la tranche
+    const QPair<int, int> deep = sliceOf(m_deepSpaceIndex);
+    QVarLengthArray<int, 64> busy;
+
+    for (int k = deep.first; k < deep.second; ++k) {
+        if (m_deepSpaceBusy[k].exchange(true, std::memory_order_acquire)) {
+            busy.append(k);
+            continue;
+        }
+        propagateDeepSpace(k, timeJ2000, positions, velocities, accelerations, status);
+        m_deepSpaceBusy[k].store(false, std::memory_order_release);
+    }
+
+    for (int k : busy) {
+        while (m_deepSpaceBusy[k].exchange(true, std::memory_order_acquire)) {
+            QThread::yieldCurrentThread();
+        }
+        propagateDeepSpace(k, timeJ2000, positions, velocities, accelerations, status);
+        m_deepSpaceBusy[k].store(false, std::memory_order_release);
+    }
+}
+
+template <typename Real>
+void BatchPropagator::propagateDeepSpace(int k, double timeJ2000,
+                                         Real* positions, Real* velocities, Real* accelerations,
+                                         quint8* status) const
+{
+    const int i = m_deepSpaceIndex[k];
+    const double tsince = (timeJ2000 - m_deepSpaceEpoch[k]) * 1440.0;
+
+    // Retombée déjà constatée plus tôt : inutile de relancer libsgp4
+    if (tsince >= m_deepSpaceDecayedAfter[k].load(std::memory_order_relaxed)) {
+        if (status) {
+            status[i] = SGP4Status::Decayed;
+        }
+        return;
+    }
+
+    try {
+        libsgp4::Eci eci = m_deepSpace[k]->FindPosition(tsince);
+        libsgp4::Vector pos = eci.Position();
+        libsgp4::Vector vel = eci.Velocity();
+
+        Real* p = positions + 3 * i;
+        p[0] = static_cast<Real>(pos.x);
+        p[1] = static_cast<Real>(pos.y);
+        p[2] = static_cast<Real>(pos.z);
+
+        if (velocities) {
+            Real* v = velocities + 3 * i;
+            v[0] = static_cast<Real>(vel.x);
+            v[1] = static_cast<Real>(vel.y);
+            v[2] = static_cast<Real>(vel.z);
+        }
+        if (accelerations) {
+            writeAcceleration(pos.x, pos.y, pos.z, accelerations + 3 * i);
+        }
+        if (status) {
+            status[i] = SGP4Status::Ok;
+        }
+
+    } catch (const libsgp4::DecayedException&) {
+        if (status) {
+            status[i] = SGP4Status::Decayed;
+        }
+        if (tsince >= 0.0) {
+            // Minimum atomique : plusieurs tuiles peuvent constater la retombée
+            double current = m_deepSpaceDecayedAfter[k].load(std::memory_order_relaxed);
+            while (tsince < current
+                   && !m_deepSpaceDecayedAfter[k].compare_exchange_weak(current, tsince,
+                                                                        std::memory_order_relaxed)) {
+            }
+        }
+    } catch (const std::exception&) {
+        if (status) {
+            status[i] = SGP4Status::InvalidElements;
+        }
+    }
+}
@@ -0,0 +1,209 @@
+#ifndef BATCHPROPAGATOR_H
+#define BATCHPROPAGATOR_H
+
+#include <QObject>
+#include <QVector>
+#include <QSharedPointer>
+#include <atomic>
+#include "SGP4Kernel.h"
+#include "../data/TLECatalog.h"
+
+namespace libsgp4 {
+class SGP4;
+}
+
+/**
+ * @brief Régime orbital d'un satellite (catégorie d'affichage, filtrage)
+ */
+namespace OrbitRegime {
+enum Code : quint8 {
+    LowEarth = 0,               // Apogée sous 2000 km
+    MediumEarth,                // Entre LEO et géosynchrone
+    Geosynchronous,             // Période de 1300 à 1500 min, quasi circulaire
+    HighlyElliptical            // Excentricité > 0.25 (Molniya, GTO...)
+};
+
+const int CodeCount = HighlyElliptical + 1;
+
+/**
+ * @brief Classe un jeu d'éléments selon son orbite moyenne
+ */
+Code classify(const ElementSet& set);
+
+/**
+ * @brief Nom lisible d'un régime (journaux, interface)
+ */
+const char* name(Code code);
+}
+
+/**
+ * @brief Propagation SGP4 d'un catalogue entier en un seul appel
+ *
+ * Les constantes SGP4 des satellites proche Terre sont stockées en
+ * structure de tableaux (SGP4Batch) et propagées par une boucle unique,
+ * sans objet par satellite, vectorisée (AVX2/AVX-512) quand le processeur
+ * le permet. Les satellites en espace lointain (SDP4,
+ * période >= 225 min) passent par libsgp4::SGP4.
+ *
+ * Les sorties sont écrites dans des tampons contigus fournis par
+ * l'appelant, dans l'ordre des jeux d'éléments : x, y, z puis satellite
+ * suivant (km et km/s, repère TEME comme libsgp4). L'accélération
+ * optionnelle (gravité centrale + J2) est évaluée à la position propagée,
+ * sans seconde propagation.
+ *
+ * Les échecs sont rapportés par code (status()) et résumés en un seul
+ * signal par lot : aucune exception, aucun log ni signal par satellite.
+ *
+ * Un catalogue détenu par QSharedPointer peut aussi être propagé en
+ * arrière-plan (PropagationScheduler, via sharedFromThis()).
+ */
+class BatchPropagator : public QObject, public QEnableSharedFromThis<BatchPropagator>
+{
+    Q_OBJECT
+
+public:
+    explicit BatchPropagator(QObject *parent = nullptr);
+    ~BatchPropagator();
+
+    /**
+     * @brief Initialise les constantes SGP4 de tous les satellites
+     * @param sets Jeux d'éléments
+     * @param count Nombre de jeux d'éléments
+     * @return Nombre de satellites initialisés avec succès
+     */
+    int initialize(const ElementSet* sets, int count);
+    int initialize(const QVector<ElementSet>& sets) { return initialize(sets.constData(), sets.size()); }
+
+    /**
+     * @brief Copie de travail d'un catalogue déjà initialisé
+     *
+     * Les constantes proche Terre sont partagées (copie implicite, lecture
+     * seule) ; chaque objet libsgp4 est dupliqué avec son état
+     * d'intégration. Des threads qui propagent chacun leur copie ne se
+     * disputent donc aucun verrou d'espace lointain.
+     * @return Nombre de satellites initialisés
+     */
+    int initialize(const BatchPropagator& source);
+
+    /**
+     * @brief Libère toutes les constantes
+     */
+    void clear();
+
+    /**
+     * @brief Propage tous les satellites à un instant commun
+     * @param julianDate Instant cible (date julienne UTC)
+     * @param positions [out] 3 × size() valeurs (km), satellites rejetés à 0
+     * @param velocities [out] 3 × size() valeurs (km/s), ou nullptr
+     * @param accelerations [out] 3 × size() valeurs (km/s², gravité + J2), ou nullptr
+     */
+    void propagate(double julianDate, double* positions, double* velocities = nullptr,
+                   double* accelerations = nullptr);
+    void propagate(double julianDate, float* positions, float* velocities = nullptr,
+                   float* accelerations = nullptr);
+
+    /**
+     * @brief Propage tous les satellites sur une série temporelle régulière
+     *
+     * Les instants sont calculés par incrément en jours depuis J2000, sans
+     * conversion calendaire par échantillon. status() reflète le dernier instant.
+     * @param startJulian Premier instant (date julienne UTC)
+     * @param stepSeconds Pas entre deux instants (secondes)
+     * @param count Nombre d'instants
+     * @param positions [out] count × 3 × size() valeurs, instant par instant
+     * @param velocities [out] Même disposition, ou nullptr
+     * @param accelerations [out] Même disposition, ou nullptr
+     */
+    void propagateSeries(double startJulian, double stepSeconds, int count,
+                         float* positions, float* velocities = nullptr,
+                         float* accelerations = nullptr);
+
+    /**
+     * @brief Propage les satellites [begin, end[ sans toucher aux résultats internes
+     *
+     * Utilisable depuis plusieurs threads. Un objet libsgp4 (espace
+     * lointain) garde un état d'intégration mutable : il est verrouillé le
+     * temps de sa propagation, et un thread qui le trouve occupé passe aux
+     * suivants avant d'y revenir. Les tampons sont indexés comme pour
+     * propagate() : le satellite i est écrit en 3 × i.
+     * @param status [out] size() codes SGP4Status::Code, ou nullptr
+     * @param accelerations [out] 3 × size() valeurs (km/s²), ou nullptr
+     */
+    void propagateRange(double julianDate, int begin, int end,
+                        double* positions, double* velocities, quint8* status,
+                        double* accelerations = nullptr) const;
+    void propagateRange(double julianDate, int begin, int end,
+                        float* positions, float* velocities, quint8* status,
+                        float* accelerations = nullptr) const;
+
+    // Getters
+    int size() const { return m_count; }
+    int nearEarthCount() const { return m_nearIndex.size(); }
+    int deepSpaceCount() const { return m_deepSpaceIndex.size(); }
+
+    /**
+     * @brief Régime orbital de chaque satellite (OrbitRegime::Code), fixé à l'initialisation
+     */
+    const QVector<quint8>& orbitRegimes() const { return m_regimes; }
+
+    /**
+     * @brief Résultat de la dernière propagation (SGP4Status::Code par satellite)
+     */
+    const QVector<quint8>& status() const { return m_status; }
+
+    /**
+     * @brief Décompte des codes de la dernière propagation
+     */
+    const SGP4StatusSummary& summary() const { return m_summary; }
+
+signals:
+    /**
+     * @brief Résumé des échecs, émis une fois par lot s'il y en a
+     */
+    void propagationErrors(const SGP4StatusSummary& summary);
+
+private:
+    Q_DISABLE_COPY(BatchPropagator)
+
+    int m_count = 0;
+
+    // === Proche Terre : structure de tableaux ===
+    SGP4Batch m_near;
+    QVector<int> m_nearIndex;              // Indice tableau -> indice satellite
+
+    // === Espace lointain : libsgp4 ===
+    QVector<libsgp4::SGP4*> m_deepSpace;
+    QVector<double> m_deepSpaceEpoch;      // Jours depuis J2000
+    QVector<int> m_deepSpaceIndex;
+
+    // Premier instant (minutes depuis l'époque, >= 0) où libsgp4 a signalé
+    // la retombée : les instants suivants sont rejetés sans nouvel appel
+    // (et donc sans nouvelle exception). Partagé entre threads.
+    std::atomic<double>* m_deepSpaceDecayedAfter;
+
+    // Objet libsgp4 en cours de propagation (état d'intégration mutable)
+    std::atomic<bool>* m_deepSpaceBusy;
+
+    QVector<quint8> m_regimes;             // OrbitRegime::Code par satellite
+    QVector<quint8> m_initStatus;          // Résultat de l'initialisation par satellite
+    QVector<quint8> m_status;              // Résultat de la dernière propagation
+    SGP4StatusSummary m_summary;
+    SGP4StatusSummary m_reportedSummary;   // Dernier résumé journalisé
+
+    void reportStatus();
+
+    template <typename Real>
+    void propagateImpl(double timeJ2000, int begin, int end,
+                       Real* positions, Real* velocities, Real* accelerations,
+                       quint8* status) const;
+
+    /**
+     * @brief Propage l'objet libsgp4 k (verrou m_deepSpaceBusy[k] tenu par l'appelant)
+     */
+    template <typename Real>
+    void propagateDeepSpace(int k, double timeJ2000,
+                            Real* positions, Real* velocities, Real* accelerations,
+                            quint8* status) const;
+};
+
+#endif // BATCHPROPAGATOR_H
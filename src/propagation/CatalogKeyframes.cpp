@@ -0,0 +1,215 @@
+#include "CatalogKeyframes.h"
+#include <QtGlobal>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+const double JD_J2000 = 2451545.0;
+const double SECONDS_PER_DAY = 86400.0;
+
+// Pas par défaut : une propagation par seconde de temps simulé
+const double DEFAULT_STEP_SECONDS = 1.0;
+const double MIN_STEP_SECONDS = 0.01;
+
+CatalogKeyframes::CatalogKeyframes()
+    : m_stepSeconds(DEFAULT_STEP_SECONDS)
+    , m_lastSeconds(0.0)
+    , m_hasLast(false)
+    , m_propagationCount(0)
+    , m_prefetchJob(0)
+    , m_prefetchGrid(0)
+    , m_prefetchCount(0)
+{
+    invalidate();
+}
+
+void CatalogKeyframes::setCatalog(BatchPropagator* catalog)
+{
+    m_catalog = catalog;
+    invalidate();
+}
+
+void CatalogKeyframes::setScheduler(PropagationScheduler* scheduler)
+{
+    invalidate();
+    m_scheduler = scheduler;
+}
+
+void CatalogKeyframes::setStepSeconds(double seconds)
+{
+    seconds = qMax(MIN_STEP_SECONDS, seconds);
+    if (qFuzzyCompare(m_stepSeconds, seconds))
+        return;
+
+    // Nouvelle grille : les images clés existantes ne tombent plus dessus
+    m_stepSeconds = seconds;
+    invalidate();
+}
+
+void CatalogKeyframes::invalidate()
+{
+    for (Keyframe& key : m_keys) {
+        key.grid = 0;
+        key.valid = false;
+    }
+
+    // Image clé en préparation : plus sur la grille ni pour ce catalogue
+    m_prefetched.valid = false;
+    if (m_prefetchJob && m_scheduler) {
+        m_scheduler->cancel(m_prefetchJob);
+    }
+    m_prefetchJob = 0;
+}
+
+void CatalogKeyframes::propagateKey(Keyframe& key, qint64 grid)
+{
+    const int count = m_catalog->size();
+    key.positions.resize(3 * count);
+    key.velocities.resize(3 * count);
+
+    m_catalog->propagate(JD_J2000 + grid * m_stepSeconds / SECONDS_PER_DAY,
+                         key.positions.data(), key.velocities.data());
+    key.status = m_catalog->status();
+    key.grid = grid;
+    key.valid = true;
+    ++m_propagationCount;
+}
+
+bool CatalogKeyframes::takePrefetched(Keyframe& key, qint64 grid)
+{
+    if (!m_prefetched.valid || m_prefetched.grid != grid
+        || m_prefetched.positions.size() != 3 * m_catalog->size()) {
+        return false;
+    }
+
+    std::swap(key, m_prefetched);
+    m_prefetched.valid = false;
+    ++m_prefetchCount;
+    return true;
+}
+
+void CatalogKeyframes::prefetch(qint64 grid)
+{
+    if (!m_scheduler || (m_prefetched.valid && m_prefetched.grid == grid)
+        || (m_prefetchJob && m_prefetchGrid == grid)) {
+        return;
+    }
+
+    // Catalogue non partagé : sa durée de vie n'est pas garantie pendant la tâche
+    const QSharedPointer<const BatchPropagator> catalog = m_catalog->sharedFromThis();
+    if (!catalog) {
+        return;
+    }
+
+    if (m_prefetchJob) {
+        m_scheduler->cancel(m_prefetchJob);
+    }
+    m_prefetchJob = m_scheduler->submit(catalog, QVector<double>{ JD_J2000 + grid * m_stepSeconds / SECONDS_PER_DAY },
+                                        PropagationScheduler::FramePriority, true);
+    m_prefetchGrid = grid;
+}
+
+void CatalogKeyframes::deliver(quint64 jobId, const QSharedPointer<const PropagationResult>& result)
+{
+    if (jobId == 0 || jobId != m_prefetchJob) {
+        return;
+    }
+    m_prefetchJob = 0;
+
+    if (!m_catalog || result->satelliteCount != m_catalog->size()) {
+        return;
+    }
+
+    // Tampons du résultat partagés, sans copie
+    m_prefetched.positions = result->positions;
+    m_prefetched.velocities = result->velocities;
+    m_prefetched.status = result->status;
+    m_prefetched.grid = m_prefetchGrid;
+    m_prefetched.valid = true;
+}
+
+bool CatalogKeyframes::evaluate(double julianDate, float* positions, quint8* status)
+{
+    if (!m_catalog) {
+        return false;
+    }
+
+    const int count = m_catalog->size();
+    const double seconds = (julianDate - JD_J2000) * SECONDS_PER_DAY;
+    const double gridPosition = seconds / m_stepSeconds;
+    const qint64 k = qint64(std::floor(gridPosition));
+    const float s = float(gridPosition - double(k));
+    const bool forward = !m_hasLast || seconds >= m_lastSeconds;
+
+    // Catalogue réinitialisé depuis la dernière propagation
+    for (Keyframe& key : m_keys) {
+        if (key.valid && key.positions.size() != 3 * count) {
+            key.valid = false;
+        }
+    }
+
+    const bool bracketed = m_keys[0].valid && m_keys[0].grid == k
+                           && m_keys[1].valid && m_keys[1].grid == k + 1;
+
+    if (!bracketed) {
+        if (m_hasLast && qAbs(seconds - m_lastSeconds) > m_stepSeconds) {
+            // Plus d'un intervalle depuis la dernière image : propagation directe
+            m_catalog->propagate(julianDate, positions);
+            std::memcpy(status, m_catalog->status().constData(), count);
+            ++m_propagationCount;
+            invalidate();
+
+            m_lastSeconds = seconds;
+            m_hasLast = true;
+            return true;
+        }
+
+        // Glissement d'un intervalle (dans un sens ou dans l'autre) :
+        // l'image clé commune est conservée, une seule propagation
+        if (m_keys[1].valid && m_keys[1].grid == k) {
+            std::swap(m_keys[0], m_keys[1]);
+        } else if (m_keys[0].valid && m_keys[0].grid == k + 1) {
+            std::swap(m_keys[0], m_keys[1]);
+        }
+
+        if (!(m_keys[0].valid && m_keys[0].grid == k) && !takePrefetched(m_keys[0], k)) {
+            propagateKey(m_keys[0], k);
+        }
+        if (!(m_keys[1].valid && m_keys[1].grid == k + 1) && !takePrefetched(m_keys[1], k + 1)) {
+            propagateKey(m_keys[1], k + 1);
+        }
+    }
+
+    // Image clé du prochain glissement, dans le sens du temps
+    prefetch(forward ? k + 2 : k - 1);
+
+    m_lastSeconds = seconds;
+    m_hasLast = true;
+
+    // === Hermite cubique entre les deux images clés ===
+    const float h = float(m_stepSeconds);
+    const float s2 = s * s;
+    const float s3 = s2 * s;
+    const float h00 = 2.0f * s3 - 3.0f * s2 + 1.0f;
+    const float h10 = (s3 - 2.0f * s2 + s) * h;
+    const float h01 = -2.0f * s3 + 3.0f * s2;
+    const float h11 = (s3 - s2) * h;
+
+    const float* p0 = m_keys[0].positions.constData();
+    const float* p1 = m_keys[1].positions.constData();
+    const float* v0 = m_keys[0].velocities.constData();
+    const float* v1 = m_keys[1].velocities.constData();
+
+    for (int j = 0; j < 3 * count; ++j) {
+        positions[j] = h00 * p0[j] + h10 * v0[j] + h01 * p1[j] + h11 * v1[j];
+    }
+
+    // Un échec sur l'une des images clés invalide l'intervalle
+    const quint8* st0 = m_keys[0].status.constData();
+    const quint8* st1 = m_keys[1].status.constData();
+    for (int i = 0; i < count; ++i) {
+        status[i] = (st0[i] != SGP4Status::Ok) ? st0[i] : st1[i];
+    }
+
+    return true;
+}
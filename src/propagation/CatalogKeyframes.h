@@ -0,0 +1,113 @@
+#ifndef CATALOGKEYFRAMES_H
+#define CATALOGKEYFRAMES_H
+
+#include <QVector>
+#include <QPointer>
+#include <QSharedPointer>
+#include "BatchPropagator.h"
+#include "PropagationScheduler.h"
+
+/**
+ * @brief Positions du catalogue à cadence de propagation fixe
+ *
+ * Le catalogue est propagé sur une grille de temps simulé (multiples de
+ * stepSeconds), indépendante de la cadence d'affichage. Entre les deux
+ * images clés encadrantes, les positions sont interpolées (Hermite
+ * cubique sur position + vitesse, comme EphemerisCache). Quand le temps
+ * avance d'un intervalle, l'image clé suivante est la seule propagée.
+ *
+ * Si une seule image d'affichage couvre plus d'un intervalle (forte
+ * accélération), interpoler n'a plus de sens : le catalogue est propagé
+ * directement à l'instant demandé, une fois au plus par évaluation.
+ *
+ * Avec un ordonnanceur (setScheduler) et un catalogue détenu par
+ * QSharedPointer, l'image clé suivante dans le sens du temps est
+ * propagée en arrière-plan pendant l'interpolation de l'intervalle
+ * courant : au glissement, elle est reprise sans propagation sur le
+ * thread GUI. Le propriétaire transmet les résultats (deliver()).
+ *
+ * Non thread-safe : prévu pour le thread GUI.
+ */
+class CatalogKeyframes
+{
+public:
+    CatalogKeyframes();
+
+    /**
+     * @brief Catalogue source (non possédé) ; les images clés sont invalidées
+     */
+    void setCatalog(BatchPropagator* catalog);
+    BatchPropagator* catalog() const { return m_catalog; }
+
+    /**
+     * @brief Ordonnanceur pour l'image clé suivante (non possédé), ou nullptr
+     */
+    void setScheduler(PropagationScheduler* scheduler);
+    PropagationScheduler* scheduler() const { return m_scheduler; }
+
+    /**
+     * @brief Résultat d'une tâche de l'ordonnanceur (PropagationScheduler::jobFinished)
+     *
+     * Les tâches qui ne sont pas l'image clé suivante demandée sont ignorées.
+     */
+    void deliver(quint64 jobId, const QSharedPointer<const PropagationResult>& result);
+
+    /**
+     * @brief Intervalle entre images clés (secondes de temps simulé)
+     */
+    void setStepSeconds(double seconds);
+    double stepSeconds() const { return m_stepSeconds; }
+
+    /**
+     * @brief Oublie les images clés (prochaine évaluation : repropagation)
+     */
+    void invalidate();
+
+    /**
+     * @brief Positions du catalogue à l'instant donné
+     * @param julianDate Instant (date julienne UTC)
+     * @param positions [out] 3 × size() floats (km, repère TEME)
+     * @param status [out] size() codes SGP4Status::Code
+     * @return false si aucun catalogue n'est défini
+     */
+    bool evaluate(double julianDate, float* positions, quint8* status);
+
+    /**
+     * @brief Nombre de propagations complètes du catalogue depuis le début
+     */
+    qint64 propagationCount() const { return m_propagationCount; }
+
+    /**
+     * @brief Nombre d'images clés reprises de l'ordonnanceur (sans propagation sur le thread GUI)
+     */
+    qint64 prefetchCount() const { return m_prefetchCount; }
+
+private:
+    struct Keyframe {
+        qint64 grid;                // Indice de grille (temps / pas)
+        bool valid;
+        QVector<float> positions;   // km
+        QVector<float> velocities;  // km/s
+        QVector<quint8> status;
+    };
+
+    QPointer<BatchPropagator> m_catalog;
+    double m_stepSeconds;
+    Keyframe m_keys[2];             // m_keys[0] : début de l'intervalle, m_keys[1] : fin
+    double m_lastSeconds;           // Dernière évaluation (secondes depuis J2000)
+    bool m_hasLast;
+    qint64 m_propagationCount;
+
+    // Image clé suivante, propagée en arrière-plan
+    QPointer<PropagationScheduler> m_scheduler;
+    Keyframe m_prefetched;
+    quint64 m_prefetchJob;          // Tâche en cours (0 : aucune)
+    qint64 m_prefetchGrid;
+    qint64 m_prefetchCount;
+
+    void propagateKey(Keyframe& key, qint64 grid);
+    bool takePrefetched(Keyframe& key, qint64 grid);
+    void prefetch(qint64 grid);
+};
+
+#endif // CATALOGKEYFRAMES_H
@@ -0,0 +1,338 @@
+#include "EphemerisCache.h"
+#include "../data/SGP4Propagator.h"
+#include <QtMath>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+
+// Budget mémoire par défaut : 32 Mio (~20 000 cellules)
+const qint64 DEFAULT_MEMORY_BUDGET = 32 * 1024 * 1024;
+
+// Erreur par défaut : 10 m, invisible à l'échelle d'affichage
+const double DEFAULT_ERROR_BOUND_KM = 0.01;
+
+// En dessous, l'écart entre SGP4 et son interpolant n'a plus de sens physique
+const double MIN_ERROR_BOUND_KM = 0.001;
+
+// Bornes du pas de grille (secondes)
+const double MIN_STEP_SECONDS = 1.0;
+const double MAX_STEP_SECONDS = 1800.0;
+
+// Marge sur l'estimation de la dérivée quatrième (orbites perturbées, excentriques)
+const double STEP_SAFETY_FACTOR = 0.7;
+
+EphemerisCache::EphemerisCache()
+    : m_lruHead(nullptr)
+    , m_lruTail(nullptr)
+    , m_cellCount(0)
+    , m_errorBound(DEFAULT_ERROR_BOUND_KM)
+    , m_memoryBudget(DEFAULT_MEMORY_BUDGET)
+    , m_hits(0)
+    , m_misses(0)
+    , m_evictions(0)
+{
+}
+
+EphemerisCache::~EphemerisCache()
+{
+    invalidate();
+}
+
+int EphemerisCache::addSatellite(const SGP4Propagator* propagator)
+{
+    if (!propagator || !propagator->isInitialized()) {
+        qWarning() << "⚠️ EphemerisCache: propagateur non initialisé ignoré";
+        return -1;
+    }
+
+    // Propagateur partagé par plusieurs traces : cellules partagées aussi
+    for (int i = 0; i < m_satellites.size(); ++i) {
+        if (m_satellites[i].propagator == propagator) {
+            return i;
+        }
+    }
+
+    const TLEData& tle = propagator->tleData();
+
+    Satellite satellite;
+    satellite.propagator = propagator;
+    satellite.epochJulian = propagator->epochJulian();
+
+    // Vitesse angulaire au périgée : n × sqrt((1 + e) / (1 - e)³)
+    const double e = qBound(0.0, tle.eccentricity, 0.99);
+    const double meanMotion = tle.meanMotion * 2.0 * M_PI / 86400.0;
+    satellite.perigeeRadius = tle.semiMajorAxis * (1.0 - e);
+    satellite.perigeeRate = meanMotion * std::sqrt((1.0 + e) / ((1.0 - e) * (1.0 - e) * (1.0 - e)));
+
+    updateStep(satellite);
+    m_satellites.append(satellite);
+
+    return m_satellites.size() - 1;
+}
+
+void EphemerisCache::clear()
+{
+    invalidate();
+    m_satellites.clear();
+}
+
+void EphemerisCache::invalidate()
+{
+    Cell* cell = m_lruHead;
+    while (cell) {
+        Cell* next = cell->next;
+        delete cell;
+        cell = next;
+    }
+
+    m_cells.clear();
+    m_lruHead = nullptr;
+    m_lruTail = nullptr;
+    m_cellCount = 0;
+}
+
+void EphemerisCache::setErrorBound(double km)
+{
+    km = qMax(km, MIN_ERROR_BOUND_KM);
+    if (km == m_errorBound) {
+        return;
+    }
+
+    m_errorBound = km;
+    for (Satellite& satellite : m_satellites) {
+        updateStep(satellite);
+    }
+    invalidate();
+}
+
+void EphemerisCache::setMemoryBudget(qint64 bytes)
+{
+    m_memoryBudget = qMax(bytes, qint64(sizeof(Cell)));
+    evictToBudget();
+}
+
+double EphemerisCache::sampleStepSeconds(int satellite) const
+{
+    if (satellite < 0 || satellite >= m_satellites.size()) {
+        return 0.0;
+    }
+    return m_satellites[satellite].stepMinutes * 60.0;
+}
+
+void EphemerisCache::updateStep(Satellite& satellite) const
+{
+    // Erreur d'Hermite cubique : h⁴ / 384 × max|x⁗|, avec |x⁗| ≈ r ω⁴ au périgée
+    const double omega2 = satellite.perigeeRate * satellite.perigeeRate;
+    const double fourthDerivative = satellite.perigeeRadius * omega2 * omega2;
+
+    double stepSeconds = MAX_STEP_SECONDS;
+    if (fourthDerivative > 0.0) {
+        stepSeconds = STEP_SAFETY_FACTOR * std::pow(384.0 * m_errorBound / fourthDerivative, 0.25);
+    }
+
+    satellite.stepMinutes = qBound(MIN_STEP_SECONDS, stepSeconds, MAX_STEP_SECONDS) / 60.0;
+}
+
+bool EphemerisCache::stateAtJulian(int satellite, double julianDate,
+                                   double* position, double* velocity,
+                                   double* acceleration)
+{
+    if (satellite < 0 || satellite >= m_satellites.size()) {
+        return false;
+    }
+
+    const double minutes = (julianDate - m_satellites[satellite].epochJulian) * 1440.0;
+    return stateAtMinutes(satellite, minutes, position, velocity, acceleration);
+}
+
+bool EphemerisCache::stateAtJulian(int satellite, double julianDate,
+                                   QVector3D& position, QVector3D* velocity,
+                                   QVector3D* acceleration)
+{
+    if (satellite < 0 || satellite >= m_satellites.size()) {
+        return false;
+    }
+
+    const double minutes = (julianDate - m_satellites[satellite].epochJulian) * 1440.0;
+    return stateAtMinutes(satellite, minutes, position, velocity, acceleration);
+}
+
+bool EphemerisCache::stateAtMinutes(int satellite, double minutesSinceEpoch,
+                                    QVector3D& position, QVector3D* velocity,
+                                    QVector3D* acceleration)
+{
+    double p[3], v[3], a[3];
+    if (!stateAtMinutes(satellite, minutesSinceEpoch, p,
+                        velocity ? v : nullptr, acceleration ? a : nullptr)) {
+        return false;
+    }
+
+    position = QVector3D(p[0], p[1], p[2]);
+    if (velocity) {
+        *velocity = QVector3D(v[0], v[1], v[2]);
+    }
+    if (acceleration) {
+        *acceleration = QVector3D(a[0], a[1], a[2]);
+    }
+    return true;
+}
+
+bool EphemerisCache::stateAtMinutes(int satellite, double minutesSinceEpoch,
+                                    double* position, double* velocity,
+                                    double* acceleration)
+{
+    if (satellite < 0 || satellite >= m_satellites.size()) {
+        return false;
+    }
+
+    // Localisation dans la grille : cellule, intervalle, abscisse normalisée
+    const double stepMinutes = m_satellites[satellite].stepMinutes;
+    const double gridPosition = minutesSinceEpoch / stepMinutes;
+    const qint64 cellIndex = qint64(std::floor(gridPosition / CELL_INTERVALS));
+
+    const double local = gridPosition - double(cellIndex) * CELL_INTERVALS;
+    const int interval = qBound(0, int(local), CELL_INTERVALS - 1);
+    const double s = local - interval;
+
+    Cell* cell = cellFor(satellite, cellIndex);
+
+    const quint64 needed = quint64(3) << interval;
+    if ((cell->validMask & needed) != needed) {
+        return false;
+    }
+
+    const double* p0 = cell->samples + interval * 6;
+    const double* p1 = p0 + 6;
+    const double* v0 = p0 + 3;
+    const double* v1 = p1 + 3;
+    const double h = stepMinutes * 60.0;     // Pas en secondes (vitesses en km/s)
+
+    // Bases d'Hermite cubique
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+    const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+    const double h10 = s3 - 2.0 * s2 + s;
+    const double h01 = -2.0 * s3 + 3.0 * s2;
+    const double h11 = s3 - s2;
+
+    for (int c = 0; c < 3; ++c) {
+        position[c] = h00 * p0[c] + h10 * h * v0[c] + h01 * p1[c] + h11 * h * v1[c];
+    }
+
+    if (velocity) {
+        // Dérivées des bases (par rapport à s, puis / h)
+        const double d00 = (6.0 * s2 - 6.0 * s) / h;
+        const double d10 = 3.0 * s2 - 4.0 * s + 1.0;
+        const double d01 = -d00;
+        const double d11 = 3.0 * s2 - 2.0 * s;
+
+        for (int c = 0; c < 3; ++c) {
+            velocity[c] = d00 * p0[c] + d10 * v0[c] + d01 * p1[c] + d11 * v1[c];
+        }
+    }
+
+    if (acceleration) {
+        // Dérivée seconde de l'interpolant trop grossière : modèle de force
+        SGP4Kernel::gravityAcceleration(position[0], position[1], position[2],
+                                        acceleration[0], acceleration[1], acceleration[2]);
+    }
+
+    return true;
+}
+
+EphemerisCache::Cell* EphemerisCache::cellFor(int satellite, qint64 index)
+{
+    const QPair<int, qint64> key(satellite, index);
+
+    Cell* cell = m_cells.value(key, nullptr);
+    if (cell) {
+        ++m_hits;
+        touch(cell);
+        return cell;
+    }
+
+    // Remplissage à la demande
+    ++m_misses;
+    cell = new Cell;
+    cell->satellite = satellite;
+    cell->index = index;
+    cell->prev = nullptr;
+    cell->next = nullptr;
+    fillCell(cell);
+
+    m_cells.insert(key, cell);
+    ++m_cellCount;
+    touch(cell);
+    evictToBudget();
+
+    return cell;
+}
+
+void EphemerisCache::fillCell(Cell* cell) const
+{
+    const Satellite& satellite = m_satellites[cell->satellite];
+    const double start = double(cell->index) * CELL_INTERVALS * satellite.stepMinutes;
+
+    cell->validMask = 0;
+
+    for (int i = 0; i <= CELL_INTERVALS; ++i) {
+        double* sample = cell->samples + i * 6;
+
+        // Échantillons en double : pas d'arrondi float avant interpolation
+        const double minutes = start + i * satellite.stepMinutes;
+        if (satellite.propagator->computeState(minutes, sample, sample + 3) == SGP4Status::Ok) {
+            cell->validMask |= quint64(1) << i;
+        } else {
+            std::fill(sample, sample + 6, 0.0);
+        }
+    }
+}
+
+void EphemerisCache::touch(Cell* cell)
+{
+    if (m_lruHead == cell) {
+        return;
+    }
+
+    unlink(cell);
+
+    cell->next = m_lruHead;
+    if (m_lruHead) {
+        m_lruHead->prev = cell;
+    }
+    m_lruHead = cell;
+    if (!m_lruTail) {
+        m_lruTail = cell;
+    }
+}
+
+void EphemerisCache::unlink(Cell* cell)
+{
+    if (cell->prev) {
+        cell->prev->next = cell->next;
+    }
+    if (cell->next) {
+        cell->next->prev = cell->prev;
+    }
+    if (m_lruHead == cell) {
+        m_lruHead = cell->next;
+    }
+    if (m_lruTail == cell) {
+        m_lruTail = cell->prev;
+    }
+    cell->prev = nullptr;
+    cell->next = nullptr;
+}
+
+void EphemerisCache::evictToBudget()
+{
+    // La cellule la plus récente (tête) est toujours conservée
+    while (memoryUsage() > m_memoryBudget && m_lruTail && m_lruTail != m_lruHead) {
+        Cell* victim = m_lruTail;
+        unlink(victim);
+        m_cells.remove(qMakePair(victim->satellite, victim->index));
+        delete victim;
+        --m_cellCount;
+        ++m_evictions;
+    }
+}
@@ -0,0 +1,155 @@
+#ifndef EPHEMERISCACHE_H
+#define EPHEMERISCACHE_H
+
+#include <QVector>
+#include <QHash>
+#include <QPair>
+#include <QVector3D>
+
+class SGP4Propagator;
+
+/**
+ * @brief Cache d'éphémérides interpolées (Hermite cubique)
+ *
+ * L'état SGP4 (position + vitesse) de chaque satellite est échantillonné
+ * sur une grille régulière dont le pas découle de la borne d'erreur
+ * demandée. Une requête à un instant quelconque est interpolée entre les
+ * deux échantillons encadrants, pour un coût bien inférieur à celui de
+ * SGP4Propagator::propagate().
+ *
+ * La grille est découpée en cellules de CELL_INTERVALS intervalles,
+ * calculées à la première requête qui les touche. Les cellules les moins
+ * récemment utilisées sont libérées au-delà du budget mémoire.
+ *
+ * Non thread-safe : prévu pour le thread GUI (curseur temporel).
+ */
+class EphemerisCache
+{
+public:
+    /**
+     * @brief Nombre d'intervalles de grille par cellule
+     */
+    static const int CELL_INTERVALS = 32;
+
+    EphemerisCache();
+    ~EphemerisCache();
+
+    /**
+     * @brief Ajoute un satellite au cache
+     * @param propagator Propagateur initialisé (non possédé, doit survivre au cache)
+     * @return Indice du satellite (le même si le propagateur est déjà présent),
+     *         ou -1 si le propagateur n'est pas initialisé
+     */
+    int addSatellite(const SGP4Propagator* propagator);
+
+    /**
+     * @brief Retire tous les satellites et libère toutes les cellules
+     */
+    void clear();
+
+    /**
+     * @brief Libère les cellules calculées (les satellites sont conservés)
+     */
+    void invalidate();
+
+    /**
+     * @brief Erreur d'interpolation maximale visée sur la position (km)
+     *
+     * Le pas de grille de chaque satellite est recalculé et les cellules
+     * existantes sont libérées. Minimum 1 m.
+     */
+    void setErrorBound(double km);
+    double errorBound() const { return m_errorBound; }
+
+    /**
+     * @brief Mémoire maximale occupée par les cellules (octets)
+     */
+    void setMemoryBudget(qint64 bytes);
+    qint64 memoryBudget() const { return m_memoryBudget; }
+    qint64 memoryUsage() const { return m_cellCount * qint64(sizeof(Cell)); }
+
+    /**
+     * @brief État interpolé en minutes depuis l'époque TLE du satellite
+     *
+     * Échantillons et interpolation en double : la borne d'erreur tient
+     * jusqu'en orbite géostationnaire.
+     * @param position [out] x, y, z ECI (km)
+     * @param velocity [out] vx, vy, vz ECI (km/s), ou nullptr
+     * @param acceleration [out] Accélération (km/s², gravité + J2 à la position interpolée), ou nullptr
+     * @return false si SGP4 a échoué sur l'un des échantillons encadrants
+     */
+    bool stateAtMinutes(int satellite, double minutesSinceEpoch,
+                        double* position, double* velocity = nullptr,
+                        double* acceleration = nullptr);
+
+    /**
+     * @brief Variante QVector3D (arrondie en float à la sortie)
+     */
+    bool stateAtMinutes(int satellite, double minutesSinceEpoch,
+                        QVector3D& position, QVector3D* velocity = nullptr,
+                        QVector3D* acceleration = nullptr);
+
+    /**
+     * @brief État interpolé à une date julienne (UTC)
+     */
+    bool stateAtJulian(int satellite, double julianDate,
+                       double* position, double* velocity = nullptr,
+                       double* acceleration = nullptr);
+    bool stateAtJulian(int satellite, double julianDate,
+                       QVector3D& position, QVector3D* velocity = nullptr,
+                       QVector3D* acceleration = nullptr);
+
+    // Getters
+    int satelliteCount() const { return m_satellites.size(); }
+    double sampleStepSeconds(int satellite) const;
+    int cellCount() const { return m_cellCount; }
+    qint64 hits() const { return m_hits; }
+    qint64 misses() const { return m_misses; }
+    qint64 evictions() const { return m_evictions; }
+
+private:
+    Q_DISABLE_COPY(EphemerisCache)
+
+    struct Satellite {
+        const SGP4Propagator* propagator;
+        double epochJulian;
+        double stepMinutes;         // Pas de grille
+        double perigeeRadius;       // km, pour le choix du pas
+        double perigeeRate;         // rad/s, vitesse angulaire au périgée
+    };
+
+    struct Cell {
+        int satellite;
+        qint64 index;               // Cellule couvrant [index, index + 1[ × CELL_INTERVALS pas
+
+        // x, y, z (km), vx, vy, vz (km/s) pour chaque échantillon
+        double samples[(CELL_INTERVALS + 1) * 6];
+        quint64 validMask;          // Bit i : échantillon i calculé sans erreur
+
+        // Liste LRU (tête = plus récemment utilisée)
+        Cell* prev;
+        Cell* next;
+    };
+
+    QVector<Satellite> m_satellites;
+    QHash<QPair<int, qint64>, Cell*> m_cells;
+    Cell* m_lruHead;
+    Cell* m_lruTail;
+    int m_cellCount;
+
+    double m_errorBound;            // km
+    qint64 m_memoryBudget;          // octets
+
+    qint64 m_hits;
+    qint64 m_misses;
+    qint64 m_evictions;
+
+    void updateStep(Satellite& satellite) const;
+    Cell* cellFor(int satellite, qint64 index);
+    void fillCell(Cell* cell) const;
+    void touch(Cell* cell);
+    void unlink(Cell* cell);
+    void evictToBudget();
+};
+
+#endif // EPHEMERISCACHE_H
@@ -0,0 +1,325 @@
+#include "PropagationScheduler.h"
+#include "../profiling/Profiler.h"
+#include "BatchPropagator.h"
+#include <QThread>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QList>
+#include <QDebug>
+#include <atomic>
+
+const int PRIORITY_COUNT = PropagationScheduler::BackgroundPriority + 1;
+
+struct PropagationScheduler::Job {
+    quint64 id = 0;
+    QSharedPointer<const BatchPropagator> catalog;
+    QSharedPointer<PropagationResult> result;
+    Priority priority = NormalPriority;
+
+    // Pointeurs bruts vers les tampons du résultat (pas de détachement
+    // QVector depuis les threads de travail)
+    float* positions = nullptr;
+    float* velocities = nullptr;
+    float* accelerations = nullptr;
+    quint8* status = nullptr;
+
+    std::atomic<bool> cancelled{false};
+    std::atomic<int> remainingTiles{0};
+    std::atomic<int> statusCounts[SGP4Status::CodeCount] = {};
+    QElapsedTimer timer;
+};
+
+struct PropagationScheduler::Tile {
+    QSharedPointer<Job> job;
+    int timeIndex = 0;
+    int begin = 0;
+    int end = 0;
+};
+
+struct PropagationScheduler::Worker {
+    QMutex mutex;
+    QList<Tile> queues[PRIORITY_COUNT];    // Le propriétaire prend en fin, les voleurs en tête
+    QThread* thread = nullptr;
+};
+
+struct PropagationScheduler::Sync {
+    QMutex mutex;
+    QWaitCondition wake;
+    std::atomic<int> pendingTiles{0};
+    bool stopping = false;
+};
+
+PropagationScheduler::PropagationScheduler(QObject *parent)
+    : PropagationScheduler(0, parent)
+{
+}
+
+PropagationScheduler::PropagationScheduler(int threadCount, QObject *parent)
+    : QObject(parent)
+    , m_nextJobId(1)
+    , m_nextWorker(0)
+    , m_sync(new Sync)
+{
+    startWorkers(threadCount > 0 ? threadCount : qMax(1, QThread::idealThreadCount()));
+}
+
+PropagationScheduler::~PropagationScheduler()
+{
+    cancelAll();
+
+    {
+        QMutexLocker locker(&m_sync->mutex);
+        m_sync->stopping = true;
+        m_sync->wake.wakeAll();
+    }
+
+    for (Worker* worker : m_workers) {
+        worker->thread->wait();
+        delete worker->thread;
+    }
+    qDeleteAll(m_workers);
+    m_workers.clear();
+
+    delete m_sync;
+}
+
+void PropagationScheduler::startWorkers(int threadCount)
+{
+    for (int i = 0; i < threadCount; ++i) {
+        m_workers.append(new Worker);
+    }
+
+    for (int i = 0; i < threadCount; ++i) {
+        QThread* thread = QThread::create([this, i]() { workerLoop(i); });
+        thread->setObjectName(QString("PropagationWorker-%1").arg(i));
+        m_workers[i]->thread = thread;
+        thread->start();
+    }
+
+    qDebug() << "🧵 PropagationScheduler:" << threadCount << "threads de travail";
+}
+
+quint64 PropagationScheduler::submit(QSharedPointer<const BatchPropagator> catalog,
+                                     const QVector<double>& julianDates,
+                                     Priority priority,
+                                     bool withVelocities,
+                                     bool withAccelerations)
+{
+    if (!catalog || catalog->size() == 0 || julianDates.isEmpty()) {
+        qWarning() << "⚠️ PropagationScheduler: tâche vide ignorée";
+        return 0;
+    }
+
+    const int satelliteCount = catalog->size();
+    const int timeCount = julianDates.size();
+
+    QSharedPointer<Job> job(new Job);
+    job->id = m_nextJobId++;
+    job->catalog = catalog;
+    job->priority = priority;
+    job->timer.start();
+
+    // Résultat alloué une fois, rempli en place par les tuiles
+    job->result.reset(new PropagationResult);
+    PropagationResult* result = job->result.data();
+    result->julianDates = julianDates;
+    result->satelliteCount = satelliteCount;
+    result->positions.resize(3 * satelliteCount * timeCount);
+    result->status.resize(satelliteCount * timeCount);
+    if (withVelocities) {
+        result->velocities.resize(3 * satelliteCount * timeCount);
+    }
+    if (withAccelerations) {
+        result->accelerations.resize(3 * satelliteCount * timeCount);
+    }
+    job->positions = result->positions.data();
+    job->velocities = withVelocities ? result->velocities.data() : nullptr;
+    job->accelerations = withAccelerations ? result->accelerations.data() : nullptr;
+    job->status = result->status.data();
+
+    // Découpage en plages (quatre chaînes par thread au moins), premier
+    // instant de chaque plage réparti en tourniquet (l'équilibrage fin se
+    // fait par vol) puis publié en un seul verrouillage par thread
+    const int workerCount = m_workers.size();
+    const int tileSize = qBound(int(MIN_TILE_SIZE),
+                                (satelliteCount + 4 * workerCount - 1) / (4 * workerCount),
+                                int(TILE_SIZE));
+    QVector<QList<Tile>> perWorker(workerCount);
+    int rangeCount = 0;
+    for (int begin = 0; begin < satelliteCount; begin += tileSize) {
+        Tile tile;
+        tile.job = job;
+        tile.timeIndex = 0;
+        tile.begin = begin;
+        tile.end = qMin(begin + tileSize, satelliteCount);
+        perWorker[m_nextWorker].append(tile);
+        m_nextWorker = (m_nextWorker + 1) % workerCount;
+        ++rangeCount;
+    }
+    job->remainingTiles.store(rangeCount * timeCount);
+    m_jobs.insert(job->id, job);
+
+    for (int w = 0; w < workerCount; ++w) {
+        QMutexLocker locker(&m_workers[w]->mutex);
+        m_workers[w]->queues[priority].append(perWorker[w]);
+    }
+
+    {
+        QMutexLocker locker(&m_sync->mutex);
+        m_sync->pendingTiles.fetch_add(rangeCount);
+        m_sync->wake.wakeAll();
+    }
+
+    return job->id;
+}
+
+quint64 PropagationScheduler::submit(QSharedPointer<const BatchPropagator> catalog,
+                                     double startJulian, double stepSeconds, int count,
+                                     Priority priority,
+                                     bool withVelocities,
+                                     bool withAccelerations)
+{
+    QVector<double> julianDates(qMax(count, 0));
+    const double stepDays = stepSeconds / 86400.0;
+    for (int k = 0; k < julianDates.size(); ++k) {
+        julianDates[k] = startJulian + k * stepDays;
+    }
+    return submit(catalog, julianDates, priority, withVelocities, withAccelerations);
+}
+
+void PropagationScheduler::cancel(quint64 jobId)
+{
+    auto it = m_jobs.constFind(jobId);
+    if (it != m_jobs.constEnd()) {
+        it.value()->cancelled.store(true);
+    }
+}
+
+void PropagationScheduler::cancelAll()
+{
+    for (const QSharedPointer<Job>& job : std::as_const(m_jobs)) {
+        job->cancelled.store(true);
+    }
+}
+
+void PropagationScheduler::workerLoop(int workerIndex)
+{
+    for (;;) {
+        Tile tile;
+        if (takeTile(workerIndex, tile)) {
+            runTile(tile, workerIndex);
+            continue;
+        }
+
+        QMutexLocker locker(&m_sync->mutex);
+        if (m_sync->stopping) {
+            return;
+        }
+        if (m_sync->pendingTiles.load() <= 0) {
+            m_sync->wake.wait(&m_sync->mutex);
+        }
+    }
+}
+
+bool PropagationScheduler::takeTile(int workerIndex, Tile& tile)
+{
+    const int workerCount = m_workers.size();
+
+    for (int priority = 0; priority < PRIORITY_COUNT; ++priority) {
+        // Sa propre file d'abord (tuiles les plus récentes, données chaudes)
+        Worker* own = m_workers[workerIndex];
+        {
+            QMutexLocker locker(&own->mutex);
+            if (!own->queues[priority].isEmpty()) {
+                tile = own->queues[priority].takeLast();
+                m_sync->pendingTiles.fetch_sub(1);
+                return true;
+            }
+        }
+
+        // Puis vol en tête de file chez les autres
+        for (int offset = 1; offset < workerCount; ++offset) {
+            Worker* victim = m_workers[(workerIndex + offset) % workerCount];
+            QMutexLocker locker(&victim->mutex);
+            if (!victim->queues[priority].isEmpty()) {
+                tile = victim->queues[priority].takeFirst();
+                m_sync->pendingTiles.fetch_sub(1);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void PropagationScheduler::runTile(const Tile& tile, int workerIndex)
+{
+    ORBI_PROFILE_SCOPE("Tuile SGP4", Profiler::Propagation);
+    Job* job = tile.job.data();
+    const int timeCount = job->result->timeCount();
+
+    // Tuiles terminées par cet appel : celle-ci, ou toute la fin de la chaîne si annulée
+    int finishedTiles = timeCount - tile.timeIndex;
+
+    if (!job->cancelled.load(std::memory_order_relaxed)) {
+        const qsizetype offset = qsizetype(job->result->satelliteCount) * tile.timeIndex;
+        job->catalog->propagateRange(job->result->julianDates.at(tile.timeIndex),
+                                     tile.begin, tile.end,
+                                     job->positions + 3 * offset,
+                                     job->velocities ? job->velocities + 3 * offset : nullptr,
+                                     job->status + offset,
+                                     job->accelerations ? job->accelerations + 3 * offset : nullptr);
+
+        // Décompte local à la tuile, puis une addition atomique par code
+        SGP4StatusSummary tileSummary;
+        tileSummary.add(job->status + offset + tile.begin, tile.end - tile.begin);
+        for (int code = 0; code < SGP4Status::CodeCount; ++code) {
+            if (tileSummary.counts[code]) {
+                job->statusCounts[code].fetch_add(tileSummary.counts[code], std::memory_order_relaxed);
+            }
+        }
+        finishedTiles = 1;
+
+        // Instant suivant de la même plage : publié seulement maintenant,
+        // en fin de file (repris aussitôt par ce thread, sauf vol)
+        if (tile.timeIndex + 1 < timeCount) {
+            Tile next = tile;
+            ++next.timeIndex;
+            Worker* own = m_workers[workerIndex];
+            QMutexLocker locker(&own->mutex);
+            own->queues[job->priority].append(next);
+            m_sync->pendingTiles.fetch_add(1);
+        }
+    }
+
+    if (job->remainingTiles.fetch_sub(finishedTiles) == finishedTiles) {
+        // Dernière tuile : livraison dans le thread de l'ordonnanceur
+        QSharedPointer<Job> finished = tile.job;
+        QMetaObject::invokeMethod(this, [this, finished]() { finishJob(finished); },
+                                  Qt::QueuedConnection);
+    }
+}
+
+void PropagationScheduler::finishJob(const QSharedPointer<Job>& job)
+{
+    m_jobs.remove(job->id);
+
+    if (job->cancelled.load()) {
+        emit jobCancelled(job->id);
+        return;
+    }
+
+    PropagationResult* result = job->result.data();
+    result->elapsedMs = job->timer.elapsed();
+    for (int code = 0; code < SGP4Status::CodeCount; ++code) {
+        result->summary.counts[code] = job->statusCounts[code].load();
+        result->summary.total += result->summary.counts[code];
+    }
+
+    emit jobFinished(job->id, job->result);
+    if (result->summary.hasErrors()) {
+        emit jobErrors(job->id, result->summary);
+    }
+}
@@ -0,0 +1,160 @@
+#ifndef PROPAGATIONSCHEDULER_H
+#define PROPAGATIONSCHEDULER_H
+
+#include <QObject>
+#include <QVector>
+#include <QHash>
+#include <QSharedPointer>
+#include "SGP4Kernel.h"
+
+class BatchPropagator;
+class QThread;
+
+/**
+ * @brief Résultat d'une tâche de propagation (catalogue × grille de temps)
+ *
+ * Tampons contigus, instant par instant : positions[(t × N + i) × 3 + axe].
+ */
+struct PropagationResult {
+    QVector<double> julianDates;    // Grille de temps (dates juliennes UTC)
+    int satelliteCount = 0;
+
+    QVector<float> positions;       // km, repère TEME
+    QVector<float> velocities;      // km/s (vide si non demandées)
+    QVector<float> accelerations;   // km/s², gravité + J2 (vide si non demandées)
+    QVector<quint8> status;         // SGP4Status::Code par instant et satellite
+    SGP4StatusSummary summary;      // Décompte sur toute la tâche
+
+    qint64 elapsedMs = 0;           // Durée de la tâche (file d'attente comprise)
+
+    int timeCount() const { return julianDates.size(); }
+    const float* positionsAt(int timeIndex) const { return positions.constData() + 3 * satelliteCount * timeIndex; }
+    const float* velocitiesAt(int timeIndex) const { return velocities.constData() + 3 * satelliteCount * timeIndex; }
+    const float* accelerationsAt(int timeIndex) const { return accelerations.constData() + 3 * satelliteCount * timeIndex; }
+    const quint8* statusAt(int timeIndex) const { return status.constData() + satelliteCount * timeIndex; }
+};
+
+/**
+ * @brief Ordonnanceur de propagation parallèle (vol de tâches)
+ *
+ * Une tâche (catalogue × instants) est découpée en plages d'au plus
+ * TILE_SIZE satellites ; une tuile est une plage à un instant donné. Les
+ * instants d'une plage sont enchaînés : la tuile de l'instant suivant
+ * n'est publiée qu'à la fin de la précédente, si bien qu'une plage n'est
+ * jamais propagée par deux threads à la fois (les objets libsgp4 de
+ * l'espace lointain ont un état d'intégration mutable). Les premières
+ * tuiles de chaque plage sont réparties entre les files des threads de
+ * travail ; un thread sans travail vole les tuiles des autres, et les
+ * tuiles de priorité supérieure passent toujours avant, même volées.
+ *
+ * submit() et cancel() s'appellent depuis le thread de l'ordonnanceur
+ * (thread GUI) ; les résultats y sont livrés par signal, sans jamais
+ * bloquer la boucle d'événements.
+ */
+class PropagationScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Priorité d'une tâche
+     */
+    enum Priority {
+        FramePriority = 0,      // Image visible : passe avant tout le reste
+        NormalPriority,
+        BackgroundPriority      // Précalcul
+    };
+    Q_ENUM(Priority)
+
+    /**
+     * @brief Nombre maximal de satellites par tuile
+     *
+     * Les plages sont réduites (jusqu'à MIN_TILE_SIZE) pour donner
+     * plusieurs chaînes à chaque thread sur un petit catalogue.
+     */
+    static const int TILE_SIZE = 1024;
+    static const int MIN_TILE_SIZE = 64;
+
+    explicit PropagationScheduler(QObject *parent = nullptr);
+
+    /**
+     * @param threadCount Nombre de threads de travail (0 = nombre de cœurs)
+     */
+    explicit PropagationScheduler(int threadCount, QObject *parent = nullptr);
+    ~PropagationScheduler();
+
+    /**
+     * @brief Soumet la propagation d'un catalogue sur une grille de temps
+     * @param catalog Catalogue initialisé (partagé, non modifié pendant la tâche)
+     * @param julianDates Instants (dates juliennes UTC)
+     * @param priority Priorité de la tâche
+     * @param withVelocities Calcule aussi les vitesses
+     * @param withAccelerations Calcule aussi les accélérations
+     * @return Identifiant de la tâche (0 si rien à propager)
+     */
+    quint64 submit(QSharedPointer<const BatchPropagator> catalog,
+                   const QVector<double>& julianDates,
+                   Priority priority = NormalPriority,
+                   bool withVelocities = false,
+                   bool withAccelerations = false);
+
+    /**
+     * @brief Variante pour une grille régulière (début + pas)
+     * @param startJulian Premier instant (date julienne UTC)
+     * @param stepSeconds Pas entre deux instants (secondes)
+     * @param count Nombre d'instants
+     */
+    quint64 submit(QSharedPointer<const BatchPropagator> catalog,
+                   double startJulian, double stepSeconds, int count,
+                   Priority priority = NormalPriority,
+                   bool withVelocities = false,
+                   bool withAccelerations = false);
+
+    /**
+     * @brief Annule une tâche : ses tuiles restantes sont abandonnées
+     */
+    void cancel(quint64 jobId);
+    void cancelAll();
+
+    // Getters
+    int threadCount() const { return m_workers.size(); }
+    int activeJobCount() const { return m_jobs.size(); }
+
+signals:
+    /**
+     * @brief Tâche terminée (émis dans le thread de l'ordonnanceur)
+     */
+    void jobFinished(quint64 jobId, QSharedPointer<const PropagationResult> result);
+
+    /**
+     * @brief Tâche annulée, toutes ses tuiles en cours sont terminées
+     */
+    void jobCancelled(quint64 jobId);
+
+    /**
+     * @brief Résumé des échecs d'une tâche terminée (un seul signal par tâche)
+     */
+    void jobErrors(quint64 jobId, const SGP4StatusSummary& summary);
+
+private:
+    struct Job;
+    struct Tile;
+    struct Worker;
+
+    QVector<Worker*> m_workers;
+    QHash<quint64, QSharedPointer<Job>> m_jobs;    // Tâches en cours (thread de l'ordonnanceur)
+    quint64 m_nextJobId;
+    int m_nextWorker;
+
+    void startWorkers(int threadCount);
+    void workerLoop(int workerIndex);
+    bool takeTile(int workerIndex, Tile& tile);
+    void runTile(const Tile& tile, int workerIndex);
+    void finishJob(const QSharedPointer<Job>& job);
+
+    // Synchronisation des threads de travail (définie dans le .cpp)
+    struct Sync;
+    Sync* m_sync;
+};
+
+#endif // PROPAGATIONSCHEDULER_H
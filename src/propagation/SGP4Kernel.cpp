@@ -0,0 +1,620 @@
+#include "SGP4Kernel.h"
+#include "../data/TLECatalog.h"
+#include <QByteArray>
+#include <QtGlobal>
+#include <atomic>
+#include <cmath>
+
+#if defined(ORBIFRANCE_SIMD_KERNELS) && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+// Constantes WGS-72 du modèle SGP4 (identiques à libsgp4/Globals.h)
+namespace {
+
+const double kPI = 3.14159265358979323846264338327950288419716939937510582;
+const double kTWOPI = 2.0 * kPI;
+const double kTWOTHIRD = 2.0 / 3.0;
+const double kMINUTES_PER_DAY = 1440.0;
+
+const double kAE = 1.0;
+const double kQ0 = 120.0;
+const double kS0 = 78.0;
+const double kMU = 398600.8;
+const double kXKMPER = 6378.135;
+const double kXJ2 = 1.082616e-3;
+const double kXJ3 = -2.53881e-6;
+const double kXJ4 = -1.65597e-6;
+
+const double kXKE = 60.0 / std::sqrt(kXKMPER * kXKMPER * kXKMPER / kMU);
+const double kCK2 = 0.5 * kXJ2 * kAE * kAE;
+const double kCK4 = -0.375 * kXJ4 * kAE * kAE * kAE * kAE;
+const double kQOMS2T = std::pow((kQ0 - kS0) * kAE / kXKMPER, 4.0);
+const double kS = kAE * (1.0 + kS0 / kXKMPER);
+const double kA3OVK2 = -kXJ3 / kCK2 * kAE * kAE * kAE;
+
+// Date julienne de J2000
+const double JD_J2000 = 2451545.0;
+
+double degreesToRadians(double degrees)
+{
+    return degrees * kPI / 180.0;
+}
+
+} // namespace
+
+void SGP4Batch::resize(int count)
+{
+    for (QVector<double>* array : {
+             &epoch, &meanAnomaly, &argPerigee, &raan, &eccentricity, &inclination,
+             &bstar, &meanMotion, &semiMajorAxis,
+             &cosio, &sinio, &x3thm1, &x1mth2, &x7thm1, &xlcof, &aycof, &eta,
+             &c1, &c4, &t2cof, &xmdot, &omgdot, &xnodot, &xnodcf,
+             &c5, &omgcof, &xmcof, &delmo, &sinmo, &d2, &d3, &d4,
+             &t3cof, &t4cof, &t5cof }) {
+        array->resize(count);
+    }
+}
+
+SGP4BatchView::SGP4BatchView(const SGP4Batch& batch)
+    : epoch(batch.epoch.constData())
+    , meanAnomaly(batch.meanAnomaly.constData())
+    , argPerigee(batch.argPerigee.constData())
+    , raan(batch.raan.constData())
+    , eccentricity(batch.eccentricity.constData())
+    , inclination(batch.inclination.constData())
+    , bstar(batch.bstar.constData())
+    , meanMotion(batch.meanMotion.constData())
+    , semiMajorAxis(batch.semiMajorAxis.constData())
+    , cosio(batch.cosio.constData())
+    , sinio(batch.sinio.constData())
+    , x3thm1(batch.x3thm1.constData())
+    , x1mth2(batch.x1mth2.constData())
+    , x7thm1(batch.x7thm1.constData())
+    , xlcof(batch.xlcof.constData())
+    , aycof(batch.aycof.constData())
+    , eta(batch.eta.constData())
+    , c1(batch.c1.constData())
+    , c4(batch.c4.constData())
+    , t2cof(batch.t2cof.constData())
+    , xmdot(batch.xmdot.constData())
+    , omgdot(batch.omgdot.constData())
+    , xnodot(batch.xnodot.constData())
+    , xnodcf(batch.xnodcf.constData())
+    , c5(batch.c5.constData())
+    , omgcof(batch.omgcof.constData())
+    , xmcof(batch.xmcof.constData())
+    , delmo(batch.delmo.constData())
+    , sinmo(batch.sinmo.constData())
+    , d2(batch.d2.constData())
+    , d3(batch.d3.constData())
+    , d4(batch.d4.constData())
+    , t3cof(batch.t3cof.constData())
+    , t4cof(batch.t4cof.constData())
+    , t5cof(batch.t5cof.constData())
+{
+}
+
+const char* SGP4Status::name(Code code)
+{
+    switch (code) {
+    case Ok:                     return "ok";
+    case NotInitialized:         return "non initialisé";
+    case EccentricityOutOfRange: return "excentricité hors limites";
+    case InclinationOutOfRange:  return "inclinaison hors limites";
+    case Decayed:                return "retombé";
+    case InvalidElements:        return "éléments invalides";
+    }
+    return "inconnu";
+}
+
+namespace SGP4Kernel {
+
+namespace {
+
+// -1 tant que la détection n'a pas eu lieu
+std::atomic<int> s_implementation{-1};
+
+bool isSupported(Implementation impl)
+{
+    if (impl == Implementation::Scalar) {
+        return true;
+    }
+
+#if defined(ORBIFRANCE_SIMD_KERNELS)
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (impl == Implementation::AVX512) {
+        return __builtin_cpu_supports("avx512f");
+    }
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave) {
+        return false;
+    }
+
+    // Registres YMM (et ZMM) sauvegardés par le système
+    const unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    if (impl == Implementation::AVX512) {
+        return (info[1] & (1 << 16)) != 0 && (xcr0 & 0xe6) == 0xe6;
+    }
+    return (info[1] & (1 << 5)) != 0 && fma && (xcr0 & 0x6) == 0x6;
+#else
+    return false;
+#endif
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+Implementation detectImplementation()
+{
+    // Forçage possible pour comparer les implémentations :
+    // ORBIFRANCE_SGP4_KERNEL=scalar|avx2|avx512
+    const QByteArray forced = qgetenv("ORBIFRANCE_SGP4_KERNEL").toLower();
+    if (forced == "scalar") {
+        return Implementation::Scalar;
+    }
+    if (forced == "avx2" && isSupported(Implementation::AVX2)) {
+        return Implementation::AVX2;
+    }
+
+    if (isSupported(Implementation::AVX512)) {
+        return Implementation::AVX512;
+    }
+    if (isSupported(Implementation::AVX2)) {
+        return Implementation::AVX2;
+    }
+    return Implementation::Scalar;
+}
+
+Implementation implementation()
+{
+    int impl = s_implementation.load(std::memory_order_relaxed);
+    if (impl < 0) {
+        impl = static_cast<int>(detectImplementation());
+        s_implementation.store(impl, std::memory_order_relaxed);
+    }
+    return static_cast<Implementation>(impl);
+}
+
+void setImplementation(Implementation impl)
+{
+    if (isSupported(impl)) {
+        s_implementation.store(static_cast<int>(impl), std::memory_order_relaxed);
+    }
+}
+
+const char* implementationName(Implementation impl)
+{
+    switch (impl) {
+    case Implementation::AVX2:   return "AVX2";
+    case Implementation::AVX512: return "AVX-512";
+    case Implementation::Scalar: break;
+    }
+    return "scalaire";
+}
+
+void propagate(const SGP4Batch& batch, int begin, int end, double timeJ2000,
+               const SGP4StateArrays& out)
+{
+    int next = begin;
+
+#if defined(ORBIFRANCE_SIMD_KERNELS)
+    switch (implementation()) {
+    case Implementation::AVX512:
+        next = propagateAVX512(SGP4BatchView(batch), begin, end, timeJ2000, out);
+        break;
+    case Implementation::AVX2:
+        next = propagateAVX2(SGP4BatchView(batch), begin, end, timeJ2000, out);
+        break;
+    case Implementation::Scalar:
+        break;
+    }
+#endif
+
+    // Reste (moins d'un paquet) ou processeur sans SIMD
+    const int offset = next - begin;
+    SGP4StateArrays tail{ out.x + offset, out.y + offset, out.z + offset,
+                          out.vx + offset, out.vy + offset, out.vz + offset,
+                          out.status + offset };
+    propagateScalar(batch, next, end, timeJ2000, tail);
+}
+
+void gravityAcceleration(double x, double y, double z, double& ax, double& ay, double& az)
+{
+    const double r2 = x * x + y * y + z * z;
+    const double r = std::sqrt(r2);
+    const double muOverR3 = kMU / (r2 * r);
+
+    // Terme J2 : 1.5 J2 (Re/r)², modulé par la latitude (z²/r²)
+    const double j2Term = 1.5 * kXJ2 * (kXKMPER * kXKMPER) / r2;
+    const double z2OverR2 = (z * z) / r2;
+
+    const double equatorial = muOverR3 * (1.0 - j2Term * (5.0 * z2OverR2 - 1.0));
+    ax = -x * equatorial;
+    ay = -y * equatorial;
+    az = -z * muOverR3 * (1.0 - j2Term * (5.0 * z2OverR2 - 3.0));
+}
+
+double epochJ2000(const ElementSet& set)
+{
+    // 1er janvier à 0h en jours depuis J2000 (demi-entier exact), puis
+    // fraction d'année : évite la perte de précision d'une date julienne brute
+    double jan1 = 367.0 * set.epochYear - std::floor(7.0 * set.epochYear / 4.0)
+                  + 1721044.5 - JD_J2000;
+    return jan1 + (set.epochDay - 1.0);
+}
+
+bool isDeepSpace(const ElementSet& set)
+{
+    // Même critère que libsgp4 : période calculée avec le mouvement moyen "recovered"
+    const double n0 = set.meanMotion * kTWOPI / kMINUTES_PER_DAY;
+    const double e0 = set.eccentricity;
+    const double cosio = std::cos(degreesToRadians(set.inclination));
+
+    const double a1 = std::pow(kXKE / n0, kTWOTHIRD);
+    const double betao2 = 1.0 - e0 * e0;
+    const double temp = (1.5 * kCK2) * (3.0 * cosio * cosio - 1.0) / (std::sqrt(betao2) * betao2);
+    const double del1 = temp / (a1 * a1);
+    const double a0 = a1 * (1.0 - del1 * (1.0 / 3.0 + del1 * (1.0 + del1 * 134.0 / 81.0)));
+    const double del0 = temp / (a0 * a0);
+    const double recoveredMeanMotion = n0 / (1.0 + del0);
+
+    return kTWOPI / recoveredMeanMotion >= DEEP_SPACE_PERIOD;
+}
+
+SGP4Status::Code initialize(const ElementSet& set, SGP4Batch& batch, int slot)
+{
+    // === ÉLÉMENTS MOYENS (libsgp4::OrbitalElements) ===
+    const double m0 = degreesToRadians(set.meanAnomaly);
+    const double argp0 = degreesToRadians(set.argOfPerigee);
+    const double raan0 = degreesToRadians(set.raan);
+    const double e0 = set.eccentricity;
+    const double i0 = degreesToRadians(set.inclination);
+    const double n0 = set.meanMotion * kTWOPI / kMINUTES_PER_DAY;
+    const double bstar = set.bstar;
+
+    if (e0 < 0.0 || e0 > 0.999) {
+        return SGP4Status::EccentricityOutOfRange;
+    }
+    if (i0 < 0.0 || i0 > kPI) {
+        return SGP4Status::InclinationOutOfRange;
+    }
+
+    const double cosio = std::cos(i0);
+    const double sinio = std::sin(i0);
+    const double theta2 = cosio * cosio;
+    const double x3thm1 = 3.0 * theta2 - 1.0;
+    const double eosq = e0 * e0;
+    const double betao2 = 1.0 - eosq;
+    const double betao = std::sqrt(betao2);
+
+    // Récupération du mouvement moyen et du demi-grand axe originaux
+    const double a1 = std::pow(kXKE / n0, kTWOTHIRD);
+    const double temp0 = (1.5 * kCK2) * x3thm1 / (betao * betao2);
+    const double del1 = temp0 / (a1 * a1);
+    const double a0 = a1 * (1.0 - del1 * (1.0 / 3.0 + del1 * (1.0 + del1 * 134.0 / 81.0)));
+    const double del0 = temp0 / (a0 * a0);
+    const double xnodp = n0 / (1.0 + del0);
+    const double aodp = a0 / (1.0 - del0);
+    const double perigee = (aodp * (1.0 - e0) - kAE) * kXKMPER;
+
+    // Le modèle simplifié s'applique sous 220 km de périgée
+    const bool useSimpleModel = perigee < 220.0;
+
+    // === CONSTANTES COMMUNES (libsgp4::SGP4::Initialise) ===
+    double s4 = kS;
+    double qoms24 = kQOMS2T;
+    if (perigee < 156.0) {
+        s4 = perigee - 78.0;
+        if (perigee < 98.0) {
+            s4 = 20.0;
+        }
+        qoms24 = std::pow((120.0 - s4) * kAE / kXKMPER, 4.0);
+        s4 = s4 / kXKMPER + kAE;
+    }
+
+    const double pinvsq = 1.0 / (aodp * aodp * betao2 * betao2);
+    const double tsi = 1.0 / (aodp - s4);
+    const double eta = aodp * e0 * tsi;
+    const double etasq = eta * eta;
+    const double eeta = e0 * eta;
+    const double psisq = std::fabs(1.0 - etasq);
+    const double coef = qoms24 * std::pow(tsi, 4.0);
+    const double coef1 = coef / std::pow(psisq, 3.5);
+    const double c2 = coef1 * xnodp
+                      * (aodp * (1.0 + 1.5 * etasq + eeta * (4.0 + etasq))
+                         + 0.75 * kCK2 * tsi / psisq * x3thm1
+                               * (8.0 + 3.0 * etasq * (8.0 + etasq)));
+    const double c1 = bstar * c2;
+    const double x1mth2 = 1.0 - theta2;
+    const double c4 = 2.0 * xnodp * coef1 * aodp * betao2
+                      * (eta * (2.0 + 0.5 * etasq) + e0 * (0.5 + 2.0 * etasq)
+                         - 2.0 * kCK2 * tsi / (aodp * psisq)
+                               * (-3.0 * x3thm1 * (1.0 - 2.0 * eeta + etasq * (1.5 - 0.5 * eeta))
+                                  + 0.75 * x1mth2 * (2.0 * etasq - eeta * (1.0 + etasq))
+                                        * std::cos(2.0 * argp0)));
+    const double theta4 = theta2 * theta2;
+    const double temp1 = 3.0 * kCK2 * pinvsq * xnodp;
+    const double temp2 = temp1 * kCK2 * pinvsq;
+    const double temp3 = 1.25 * kCK4 * pinvsq * pinvsq * xnodp;
+    const double xmdot = xnodp + 0.5 * temp1 * betao * x3thm1
+                         + 0.0625 * temp2 * betao * (13.0 - 78.0 * theta2 + 137.0 * theta4);
+    const double x1m5th = 1.0 - 5.0 * theta2;
+    const double omgdot = -0.5 * temp1 * x1m5th
+                          + 0.0625 * temp2 * (7.0 - 114.0 * theta2 + 395.0 * theta4)
+                          + temp3 * (3.0 - 36.0 * theta2 + 49.0 * theta4);
+    const double xhdot1 = -temp1 * cosio;
+    const double xnodot = xhdot1 + (0.5 * temp2 * (4.0 - 19.0 * theta2)
+                                    + 2.0 * temp3 * (3.0 - 7.0 * theta2)) * cosio;
+    const double xnodcf = 3.5 * betao2 * xhdot1 * c1;
+    const double t2cof = 1.5 * c1;
+
+    double xlcof;
+    if (std::fabs(cosio + 1.0) > 1.5e-12) {
+        xlcof = 0.125 * kA3OVK2 * sinio * (3.0 + 5.0 * cosio) / (1.0 + cosio);
+    } else {
+        xlcof = 0.125 * kA3OVK2 * sinio * (3.0 + 5.0 * cosio) / 1.5e-12;
+    }
+    const double aycof = 0.25 * kA3OVK2 * sinio;
+    const double x7thm1 = 7.0 * theta2 - 1.0;
+
+    // === CONSTANTES PROCHE TERRE ===
+    double c5 = 0.0;
+    double omgcof = 0.0;
+    double xmcof = 0.0;
+    double delmo = 0.0;
+    double sinmo = 0.0;
+    double d2 = 0.0;
+    double d3 = 0.0;
+    double d4 = 0.0;
+    double t3cof = 0.0;
+    double t4cof = 0.0;
+    double t5cof = 0.0;
+
+    if (!useSimpleModel) {
+        double c3 = 0.0;
+        if (e0 > 1.0e-4) {
+            c3 = coef * tsi * kA3OVK2 * xnodp * kAE * sinio / e0;
+        }
+
+        c5 = 2.0 * coef1 * aodp * betao2 * (1.0 + 2.75 * (etasq + eeta) + eeta * etasq);
+        omgcof = bstar * c3 * std::cos(argp0);
+
+        if (e0 > 1.0e-4) {
+            xmcof = -kTWOTHIRD * coef * bstar * kAE / eeta;
+        }
+
+        delmo = std::pow(1.0 + eta * std::cos(m0), 3.0);
+        sinmo = std::sin(m0);
+
+        const double c1sq = c1 * c1;
+        d2 = 4.0 * aodp * tsi * c1sq;
+        const double temp = d2 * tsi * c1 / 3.0;
+        d3 = (17.0 * aodp + s4) * temp;
+        d4 = 0.5 * temp * aodp * tsi * (221.0 * aodp + 31.0 * s4) * c1;
+        t3cof = d2 + 2.0 * c1sq;
+        t4cof = 0.25 * (3.0 * d3 + c1 * (12.0 * d2 + 10.0 * c1sq));
+        t5cof = 0.2 * (3.0 * d4 + 12.0 * c1 * d3 + 6.0 * d2 * d2 + 15.0 * c1sq * (2.0 * d2 + c1sq));
+    }
+
+    // === RANGEMENT ===
+    batch.epoch[slot] = epochJ2000(set);
+    batch.meanAnomaly[slot] = m0;
+    batch.argPerigee[slot] = argp0;
+    batch.raan[slot] = raan0;
+    batch.eccentricity[slot] = e0;
+    batch.inclination[slot] = i0;
+    batch.bstar[slot] = bstar;
+    batch.meanMotion[slot] = xnodp;
+    batch.semiMajorAxis[slot] = aodp;
+
+    batch.cosio[slot] = cosio;
+    batch.sinio[slot] = sinio;
+    batch.x3thm1[slot] = x3thm1;
+    batch.x1mth2[slot] = x1mth2;
+    batch.x7thm1[slot] = x7thm1;
+    batch.xlcof[slot] = xlcof;
+    batch.aycof[slot] = aycof;
+    batch.eta[slot] = eta;
+    batch.c1[slot] = c1;
+    batch.c4[slot] = c4;
+    batch.t2cof[slot] = t2cof;
+    batch.xmdot[slot] = xmdot;
+    batch.omgdot[slot] = omgdot;
+    batch.xnodot[slot] = xnodot;
+    batch.xnodcf[slot] = xnodcf;
+
+    batch.c5[slot] = c5;
+    batch.omgcof[slot] = omgcof;
+    batch.xmcof[slot] = xmcof;
+    batch.delmo[slot] = delmo;
+    batch.sinmo[slot] = sinmo;
+    batch.d2[slot] = d2;
+    batch.d3[slot] = d3;
+    batch.d4[slot] = d4;
+    batch.t3cof[slot] = t3cof;
+    batch.t4cof[slot] = t4cof;
+    batch.t5cof[slot] = t5cof;
+
+    return SGP4Status::Ok;
+}
+
+void propagateScalar(const SGP4Batch& batch, int begin, int end, double timeJ2000,
+                     const SGP4StateArrays& out)
+{
+    for (int k = begin; k < end; ++k) {
+        const int o = k - begin;   // Indice de sortie
+        const double tsince = (timeJ2000 - batch.epoch[k]) * kMINUTES_PER_DAY;
+
+        // === TERMES SÉCULAIRES (gravité et traînée) ===
+        const double xmdf = batch.meanAnomaly[k] + batch.xmdot[k] * tsince;
+        const double omgadf = batch.argPerigee[k] + batch.omgdot[k] * tsince;
+        const double xnoddf = batch.raan[k] + batch.xnodot[k] * tsince;
+
+        const double tsq = tsince * tsince;
+        const double tcube = tsq * tsince;
+        const double tfour = tsince * tcube;
+        const double xnode = xnoddf + batch.xnodcf[k] * tsq;
+
+        // Termes d'ordre supérieur (nuls pour le modèle simplifié)
+        const double delomg = batch.omgcof[k] * tsince;
+        const double delm = batch.xmcof[k]
+                            * (std::pow(1.0 + batch.eta[k] * std::cos(xmdf), 3.0) - batch.delmo[k]);
+        const double xmp = xmdf + delomg + delm;
+        const double omega = omgadf - (delomg + delm);
+
+        const double tempa = 1.0 - batch.c1[k] * tsince
+                             - batch.d2[k] * tsq - batch.d3[k] * tcube - batch.d4[k] * tfour;
+        const double tempe = batch.bstar[k] * batch.c4[k] * tsince
+                             + batch.bstar[k] * batch.c5[k] * (std::sin(xmp) - batch.sinmo[k]);
+        const double templ = batch.t2cof[k] * tsq + batch.t3cof[k] * tcube
+                             + tfour * (batch.t4cof[k] + tsince * batch.t5cof[k]);
+
+        const double a = batch.semiMajorAxis[k] * tempa * tempa;
+        double e = batch.eccentricity[k] - tempe;
+        const double xl = xmp + omega + xnode + batch.meanMotion[k] * templ;
+
+        if (a < 1.0) {
+            out.status[o] = SGP4Status::Decayed;
+            continue;
+        }
+        if (e <= -0.001) {
+            out.status[o] = SGP4Status::EccentricityOutOfRange;
+            continue;
+        }
+        if (e < 1.0e-6) {
+            e = 1.0e-6;
+        } else if (e > 1.0 - 1.0e-6) {
+            e = 1.0 - 1.0e-6;
+        }
+
+        // === TERMES PÉRIODIQUES LONGS ===
+        const double beta2 = 1.0 - e * e;
+        const double xn = kXKE / std::pow(a, 1.5);
+        const double axn = e * std::cos(omega);
+        const double temp11 = 1.0 / (a * beta2);
+        const double xll = temp11 * batch.xlcof[k] * axn;
+        const double aynl = temp11 * batch.aycof[k];
+        const double xlt = xl + xll;
+        const double ayn = e * std::sin(omega) + aynl;
+        const double elsq = axn * axn + ayn * ayn;
+
+        if (elsq >= 1.0) {
+            out.status[o] = SGP4Status::InvalidElements;
+            continue;
+        }
+
+        // === ÉQUATION DE KEPLER (Newton-Raphson, 10 itérations max) ===
+        const double capu = std::fmod(xlt - xnode, kTWOPI);
+        double epw = capu;
+        double sinepw = 0.0;
+        double cosepw = 0.0;
+        double ecose = 0.0;
+        double esine = 0.0;
+
+        const double maxNewtonRaphson = 1.25 * std::fabs(std::sqrt(elsq));
+        for (int i = 0; i < 10; i++) {
+            sinepw = std::sin(epw);
+            cosepw = std::cos(epw);
+            ecose = axn * cosepw + ayn * sinepw;
+            esine = axn * sinepw - ayn * cosepw;
+
+            const double f = capu - epw + esine;
+            if (std::fabs(f) < 1.0e-12) {
+                break;
+            }
+
+            const double fdot = 1.0 - ecose;
+            double deltaEpw = f / fdot;
+            if (i == 0) {
+                if (deltaEpw > maxNewtonRaphson) {
+                    deltaEpw = maxNewtonRaphson;
+                } else if (deltaEpw < -maxNewtonRaphson) {
+                    deltaEpw = -maxNewtonRaphson;
+                }
+            } else {
+                deltaEpw = f / (fdot + 0.5 * esine * deltaEpw);
+            }
+            epw += deltaEpw;
+        }
+
+        // === TERMES PÉRIODIQUES COURTS ===
+        const double temp21 = 1.0 - elsq;
+        const double pl = a * temp21;
+        if (pl < 0.0) {
+            out.status[o] = SGP4Status::InvalidElements;
+            continue;
+        }
+
+        const double r = a * (1.0 - ecose);
+        const double temp31 = 1.0 / r;
+        const double rdot = kXKE * std::sqrt(a) * esine * temp31;
+        const double rfdot = kXKE * std::sqrt(pl) * temp31;
+        const double temp32 = a * temp31;
+        const double betal = std::sqrt(temp21);
+        const double temp33 = 1.0 / (1.0 + betal);
+        const double cosu = temp32 * (cosepw - axn + ayn * esine * temp33);
+        const double sinu = temp32 * (sinepw - ayn - axn * esine * temp33);
+        const double u = std::atan2(sinu, cosu);
+        const double sin2u = 2.0 * sinu * cosu;
+        const double cos2u = 2.0 * cosu * cosu - 1.0;
+
+        const double temp41 = 1.0 / pl;
+        const double temp42 = kCK2 * temp41;
+        const double temp43 = temp42 * temp41;
+
+        const double rk = r * (1.0 - 1.5 * temp43 * betal * batch.x3thm1[k])
+                          + 0.5 * temp42 * batch.x1mth2[k] * cos2u;
+        const double uk = u - 0.25 * temp43 * batch.x7thm1[k] * sin2u;
+        const double xnodek = xnode + 1.5 * temp43 * batch.cosio[k] * sin2u;
+        const double xinck = batch.inclination[k]
+                             + 1.5 * temp43 * batch.cosio[k] * batch.sinio[k] * cos2u;
+        const double rdotk = rdot - xn * temp42 * batch.x1mth2[k] * sin2u;
+        const double rfdotk = rfdot + xn * temp42 * (batch.x1mth2[k] * cos2u + 1.5 * batch.x3thm1[k]);
+
+        if (rk < 1.0) {
+            out.status[o] = SGP4Status::Decayed;
+            continue;
+        }
+
+        // === VECTEURS D'ORIENTATION ===
+        const double sinuk = std::sin(uk);
+        const double cosuk = std::cos(uk);
+        const double sinik = std::sin(xinck);
+        const double cosik = std::cos(xinck);
+        const double sinnok = std::sin(xnodek);
+        const double cosnok = std::cos(xnodek);
+        const double xmx = -sinnok * cosik;
+        const double xmy = cosnok * cosik;
+        const double ux = xmx * sinuk + cosnok * cosuk;
+        const double uy = xmy * sinuk + sinnok * cosuk;
+        const double uz = sinik * sinuk;
+        const double vx = xmx * cosuk - cosnok * sinuk;
+        const double vy = xmy * cosuk - sinnok * sinuk;
+        const double vz = sinik * cosuk;
+
+        // === POSITION (km) ET VITESSE (km/s) ===
+        out.x[o] = rk * ux * kXKMPER;
+        out.y[o] = rk * uy * kXKMPER;
+        out.z[o] = rk * uz * kXKMPER;
+
+        const double velocityScale = kXKMPER / 60.0;
+        out.vx[o] = (rdotk * ux + rfdotk * vx) * velocityScale;
+        out.vy[o] = (rdotk * uy + rfdotk * vy) * velocityScale;
+        out.vz[o] = (rdotk * uz + rfdotk * vz) * velocityScale;
+
+        out.status[o] = SGP4Status::Ok;
+    }
+}
+
+} // namespace SGP4Kernel
@@ -0,0 +1,287 @@
+#ifndef SGP4KERNEL_H
+#define SGP4KERNEL_H
+
+#include <QVector>
+#include <QtGlobal>
+
+struct ElementSet;
+
+/**
+ * @brief Codes de résultat de propagation (un octet par satellite)
+ */
+namespace SGP4Status {
+enum Code : quint8 {
+    Ok = 0,
+    NotInitialized,             // Satellite rejeté à l'initialisation
+    EccentricityOutOfRange,     // Excentricité hors de [0, 0.999] ou dérivée < -0.001
+    InclinationOutOfRange,      // Inclinaison hors de [0, π]
+    Decayed,                    // Satellite retombé (a < 1 ou r < 1 rayon terrestre)
+    InvalidElements             // elsq >= 1 ou pl < 0 (éléments non physiques)
+};
+
+const int CodeCount = InvalidElements + 1;
+
+/**
+ * @brief Nom lisible d'un code (journaux, interface)
+ */
+const char* name(Code code);
+}
+
+/**
+ * @brief Décompte des codes SGP4Status d'une propagation par lots
+ *
+ * Remplace le signal/log par satellite en échec : un seul résumé par lot.
+ */
+struct SGP4StatusSummary {
+    int counts[SGP4Status::CodeCount] = {};
+    int total = 0;
+
+    void add(const quint8* status, int count)
+    {
+        for (int i = 0; i < count; ++i) {
+            ++counts[status[i] < SGP4Status::CodeCount ? status[i] : SGP4Status::InvalidElements];
+        }
+        total += count;
+    }
+
+    int count(SGP4Status::Code code) const { return counts[code]; }
+    int failed() const { return total - counts[SGP4Status::Ok]; }
+    bool hasErrors() const { return failed() > 0; }
+
+    bool operator==(const SGP4StatusSummary& other) const
+    {
+        for (int i = 0; i < SGP4Status::CodeCount; ++i) {
+            if (counts[i] != other.counts[i]) {
+                return false;
+            }
+        }
+        return total == other.total;
+    }
+    bool operator!=(const SGP4StatusSummary& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Constantes SGP4 proche Terre de N satellites (structure de tableaux)
+ *
+ * Reprend les constantes calculées par libsgp4::SGP4::Initialise() pour le
+ * modèle proche Terre (période < 225 min), un tableau par constante. Pour
+ * le modèle simplifié (périgée < 220 km), les termes d'ordre supérieur
+ * sont mis à zéro : le même calcul s'applique alors à tous les satellites,
+ * sans branchement.
+ */
+struct SGP4Batch {
+    // === Époque ===
+    QVector<double> epoch;          // Jours depuis J2000 (2000-01-01 12:00 UTC)
+
+    // === Éléments moyens (radians, rayons terrestres, rad/min) ===
+    QVector<double> meanAnomaly;
+    QVector<double> argPerigee;
+    QVector<double> raan;
+    QVector<double> eccentricity;
+    QVector<double> inclination;
+    QVector<double> bstar;
+    QVector<double> meanMotion;     // Mouvement moyen "recovered"
+    QVector<double> semiMajorAxis;  // Demi-grand axe "recovered"
+
+    // === Constantes communes ===
+    QVector<double> cosio;
+    QVector<double> sinio;
+    QVector<double> x3thm1;
+    QVector<double> x1mth2;
+    QVector<double> x7thm1;
+    QVector<double> xlcof;
+    QVector<double> aycof;
+    QVector<double> eta;
+    QVector<double> c1;
+    QVector<double> c4;
+    QVector<double> t2cof;
+    QVector<double> xmdot;
+    QVector<double> omgdot;
+    QVector<double> xnodot;
+    QVector<double> xnodcf;
+
+    // === Constantes proche Terre (nulles pour le modèle simplifié) ===
+    QVector<double> c5;
+    QVector<double> omgcof;
+    QVector<double> xmcof;
+    QVector<double> delmo;
+    QVector<double> sinmo;
+    QVector<double> d2;
+    QVector<double> d3;
+    QVector<double> d4;
+    QVector<double> t3cof;
+    QVector<double> t4cof;
+    QVector<double> t5cof;
+
+    int size() const { return epoch.size(); }
+    void clear() { resize(0); }
+    void resize(int count);
+};
+
+/**
+ * @brief Vue brute (pointeurs) sur un SGP4Batch
+ *
+ * Passée aux noyaux SIMD, compilés avec des options propres : ils ne
+ * manipulent ainsi aucun type Qt.
+ */
+struct SGP4BatchView {
+    const double* epoch;
+    const double* meanAnomaly;
+    const double* argPerigee;
+    const double* raan;
+    const double* eccentricity;
+    const double* inclination;
+    const double* bstar;
+    const double* meanMotion;
+    const double* semiMajorAxis;
+    const double* cosio;
+    const double* sinio;
+    const double* x3thm1;
+    const double* x1mth2;
+    const double* x7thm1;
+    const double* xlcof;
+    const double* aycof;
+    const double* eta;
+    const double* c1;
+    const double* c4;
+    const double* t2cof;
+    const double* xmdot;
+    const double* omgdot;
+    const double* xnodot;
+    const double* xnodcf;
+    const double* c5;
+    const double* omgcof;
+    const double* xmcof;
+    const double* delmo;
+    const double* sinmo;
+    const double* d2;
+    const double* d3;
+    const double* d4;
+    const double* t3cof;
+    const double* t4cof;
+    const double* t5cof;
+
+    explicit SGP4BatchView(const SGP4Batch& batch);
+};
+
+/**
+ * @brief États propagés en structure de tableaux (km, km/s, repère TEME)
+ *
+ * Indexés à partir du premier satellite propagé : une tranche [begin, end[
+ * n'a besoin que de end - begin éléments.
+ */
+struct SGP4StateArrays {
+    double* x;
+    double* y;
+    double* z;
+    double* vx;
+    double* vy;
+    double* vz;
+    quint8* status;     // SGP4Status::Code par satellite
+};
+
+/**
+ * @brief Noyau de calcul SGP4 proche Terre sur des tableaux
+ */
+namespace SGP4Kernel {
+
+/**
+ * @brief Période (minutes) à partir de laquelle le modèle espace lointain (SDP4) s'applique
+ */
+const double DEEP_SPACE_PERIOD = 225.0;
+
+/**
+ * @brief Époque d'un jeu d'éléments en jours depuis J2000
+ */
+double epochJ2000(const ElementSet& set);
+
+/**
+ * @brief Indique si un jeu d'éléments relève du modèle espace lointain
+ */
+bool isDeepSpace(const ElementSet& set);
+
+/**
+ * @brief Initialise les constantes d'un satellite proche Terre
+ * @param set Jeu d'éléments (degrés, révolutions/jour)
+ * @param batch Tableaux à remplir
+ * @param slot Indice dans les tableaux
+ * @return SGP4Status::Ok ou la cause du rejet
+ */
+SGP4Status::Code initialize(const ElementSet& set, SGP4Batch& batch, int slot);
+
+/**
+ * @brief Propage les satellites [begin, end[ à un instant commun (version scalaire)
+ * @param batch Constantes initialisées
+ * @param begin Premier indice
+ * @param end Indice de fin (exclu)
+ * @param timeJ2000 Instant cible en jours depuis J2000
+ * @param out États de sortie : le satellite begin est écrit à l'indice 0
+ */
+void propagateScalar(const SGP4Batch& batch, int begin, int end, double timeJ2000,
+                     const SGP4StateArrays& out);
+
+/**
+ * @brief Accélération gravitationnelle (terme central + J2, WGS-72) en un point
+ *
+ * Complète l'état SGP4 (position, vitesse) sans seconde propagation ni
+ * différence finie. Les perturbations non modélisées (traînée, J3, J4)
+ * restent inférieures à 1e-3 de l'accélération totale.
+ * @param x, y, z Position (km, repère TEME)
+ * @param ax, ay, az [out] Accélération (km/s²)
+ */
+void gravityAcceleration(double x, double y, double z, double& ax, double& ay, double& az);
+
+/**
+ * @brief Implémentations disponibles du noyau
+ */
+enum class Implementation {
+    Scalar,
+    AVX2,       // 4 satellites par instruction
+    AVX512      // 8 satellites par instruction
+};
+
+/**
+ * @brief Meilleure implémentation supportée par le processeur courant
+ */
+Implementation detectImplementation();
+
+/**
+ * @brief Implémentation utilisée par propagate()
+ */
+Implementation implementation();
+
+/**
+ * @brief Force une implémentation (validation, mesures)
+ *
+ * Une implémentation non supportée par le processeur est ignorée.
+ */
+void setImplementation(Implementation impl);
+
+const char* implementationName(Implementation impl);
+
+/**
+ * @brief Propage [begin, end[ avec la meilleure implémentation disponible
+ *
+ * Les satellites sont traités par paquets de 4 (AVX2) ou 8 (AVX-512),
+ * le reste par la version scalaire. Les résultats concordent avec la
+ * version scalaire (et libsgp4::SGP4::FindPosition) à mieux que 1e-6 km
+ * en position et 1e-9 km/s en vitesse.
+ *
+ * Pour un satellite en erreur (status != Ok), les états de sortie sont
+ * indéfinis.
+ */
+void propagate(const SGP4Batch& batch, int begin, int end, double timeJ2000,
+               const SGP4StateArrays& out);
+
+/**
+ * @brief Noyaux vectoriels (compilés uniquement sur x86-64)
+ * @return Indice du premier satellite non traité (reste pour la version scalaire)
+ */
+int propagateAVX2(const SGP4BatchView& batch, int begin, int end, double timeJ2000,
+                  const SGP4StateArrays& out);
+int propagateAVX512(const SGP4BatchView& batch, int begin, int end, double timeJ2000,
+                    const SGP4StateArrays& out);
+
+} // namespace SGP4Kernel
+
+#endif // SGP4KERNEL_H
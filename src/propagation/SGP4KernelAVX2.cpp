@@ -0,0 +1,59 @@
+// Compilé avec -mavx2 -mfma (voir CMakeLists.txt) : n'est appelé
+// qu'après détection du support AVX2 par SGP4Kernel::detectImplementation().
+
+#include "SGP4KernelSimd.h"
+#include <immintrin.h>
+
+namespace {
+
+/**
+ * @brief Opérations AVX2 sur 4 doubles
+ */
+struct Avx2 {
+    static const int Width = 4;
+
+    struct D {
+        __m256d v;
+        D() = default;
+        D(__m256d value) : v(value) {}
+        D operator+(D o) const { return _mm256_add_pd(v, o.v); }
+        D operator-(D o) const { return _mm256_sub_pd(v, o.v); }
+        D operator*(D o) const { return _mm256_mul_pd(v, o.v); }
+        D operator/(D o) const { return _mm256_div_pd(v, o.v); }
+    };
+
+    // Masque : tous les bits à 1 dans les voies vraies
+    using M = __m256d;
+
+    static D load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, D x) { _mm256_storeu_pd(p, x.v); }
+    static D set1(double value) { return _mm256_set1_pd(value); }
+
+    static D sqrt(D x) { return _mm256_sqrt_pd(x.v); }
+    static D abs(D x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x.v); }
+    static D floor(D x) { return _mm256_floor_pd(x.v); }
+    static D trunc(D x) { return _mm256_round_pd(x.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+
+    static M lt(D a, D b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ); }
+    static M le(D a, D b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ); }
+    static M gt(D a, D b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ); }
+    static M ge(D a, D b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ); }
+    static M eq(D a, D b) { return _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ); }
+
+    static M maskOr(M a, M b) { return _mm256_or_pd(a, b); }
+    static M maskAndNot(M a, M b) { return _mm256_andnot_pd(b, a); }
+    static M maskNot(M a) { return _mm256_xor_pd(a, _mm256_castsi256_pd(_mm256_set1_epi64x(-1))); }
+    static bool any(M a) { return _mm256_movemask_pd(a) != 0; }
+    static int bits(M a) { return _mm256_movemask_pd(a); }
+
+    // mask ? a : b
+    static D select(M mask, D a, D b) { return _mm256_blendv_pd(b.v, a.v, mask); }
+};
+
+} // namespace
+
+int SGP4Kernel::propagateAVX2(const SGP4BatchView& batch, int begin, int end, double timeJ2000,
+                              const SGP4StateArrays& out)
+{
+    return propagateSimd<Avx2>(batch, begin, end, timeJ2000, out);
+}
@@ -0,0 +1,59 @@
+// Compilé avec -mavx512f (voir CMakeLists.txt) : n'est appelé
+// qu'après détection du support AVX-512F par SGP4Kernel::detectImplementation().
+
+#include "SGP4KernelSimd.h"
+#include <immintrin.h>
+
+namespace {
+
+/**
+ * @brief Opérations AVX-512F sur 8 doubles
+ */
+struct Avx512 {
+    static const int Width = 8;
+
+    struct D {
+        __m512d v;
+        D() = default;
+        D(__m512d value) : v(value) {}
+        D operator+(D o) const { return _mm512_add_pd(v, o.v); }
+        D operator-(D o) const { return _mm512_sub_pd(v, o.v); }
+        D operator*(D o) const { return _mm512_mul_pd(v, o.v); }
+        D operator/(D o) const { return _mm512_div_pd(v, o.v); }
+    };
+
+    // Masque : un bit par voie
+    using M = __mmask8;
+
+    static D load(const double* p) { return _mm512_loadu_pd(p); }
+    static void store(double* p, D x) { _mm512_storeu_pd(p, x.v); }
+    static D set1(double value) { return _mm512_set1_pd(value); }
+
+    static D sqrt(D x) { return _mm512_sqrt_pd(x.v); }
+    static D abs(D x) { return _mm512_abs_pd(x.v); }
+    static D floor(D x) { return _mm512_roundscale_pd(x.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+    static D trunc(D x) { return _mm512_roundscale_pd(x.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+
+    static M lt(D a, D b) { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ); }
+    static M le(D a, D b) { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_LE_OQ); }
+    static M gt(D a, D b) { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ); }
+    static M ge(D a, D b) { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_GE_OQ); }
+    static M eq(D a, D b) { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ); }
+
+    static M maskOr(M a, M b) { return static_cast<M>(a | b); }
+    static M maskAndNot(M a, M b) { return static_cast<M>(a & ~b); }
+    static M maskNot(M a) { return static_cast<M>(~a); }
+    static bool any(M a) { return a != 0; }
+    static int bits(M a) { return a; }
+
+    // mask ? a : b
+    static D select(M mask, D a, D b) { return _mm512_mask_blend_pd(mask, b.v, a.v); }
+};
+
+} // namespace
+
+int SGP4Kernel::propagateAVX512(const SGP4BatchView& batch, int begin, int end, double timeJ2000,
+                                const SGP4StateArrays& out)
+{
+    return propagateSimd<Avx512>(batch, begin, end, timeJ2000, out);
+}
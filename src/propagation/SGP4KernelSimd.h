@@ -0,0 +1,304 @@
+#ifndef SGP4KERNELSIMD_H
+#define SGP4KERNELSIMD_H
+
+// En-tête interne : inclus uniquement par SGP4KernelAVX2.cpp et
+// SGP4KernelAVX512.cpp, chacun compilé avec ses propres options.
+// Tout est en espace de noms anonyme pour qu'aucune fonction compilée
+// avec des instructions AVX ne soit partagée avec le reste du programme.
+
+#include "SGP4Kernel.h"
+
+namespace {
+
+// Constantes WGS-72 (identiques à SGP4Kernel.cpp)
+const double SIMD_PI = 3.14159265358979323846264338327950288419716939937510582;
+const double SIMD_TWOPI = 2.0 * SIMD_PI;
+const double SIMD_MINUTES_PER_DAY = 1440.0;
+const double SIMD_XKMPER = 6378.135;
+const double SIMD_XJ2 = 1.082616e-3;
+const double SIMD_CK2 = 0.5 * SIMD_XJ2;
+const double SIMD_XKE = 0.07436691613317342;     // 60 / sqrt(XKMPER³ / MU), MU = 398600.8
+
+// Réduction d'argument de Cody-Waite (π/4 en trois morceaux, Cephes)
+const double SINCOS_DP1 = 7.85398125648498535156E-1;
+const double SINCOS_DP2 = 3.77489470793079817668E-8;
+const double SINCOS_DP3 = 2.69515142907905952645E-15;
+const double SINCOS_FOPI = 1.27323954473516268615;   // 4/π
+
+/**
+ * @brief sin et cos simultanés, précision double (polynômes Cephes)
+ *
+ * Tous les tests d'octant se font en arithmétique flottante : aucun
+ * vecteur d'entiers, le même code sert pour 4 ou 8 voies.
+ */
+template <typename S>
+inline void simdSinCos(typename S::D x, typename S::D& sinOut, typename S::D& cosOut)
+{
+    using D = typename S::D;
+    using M = typename S::M;
+
+    const D ax = S::abs(x);
+
+    // Octant : y = floor(|x| × 4/π), arrondi au pair supérieur
+    D y = S::floor(ax * S::set1(SINCOS_FOPI));
+    const D odd = y - S::set1(2.0) * S::floor(y * S::set1(0.5));
+    y = y + odd;
+    const D j = y - S::set1(8.0) * S::floor(y * S::set1(0.125));   // 0, 2, 4 ou 6
+
+    const D z = ((ax - y * S::set1(SINCOS_DP1)) - y * S::set1(SINCOS_DP2)) - y * S::set1(SINCOS_DP3);
+    const D zz = z * z;
+
+    const D polySin = ((((( S::set1(1.58962301576546568060E-10) * zz
+                          + S::set1(-2.50507477628578072866E-8)) * zz
+                          + S::set1(2.75573136213857245213E-6)) * zz
+                          + S::set1(-1.98412698295895385996E-4)) * zz
+                          + S::set1(8.33333333332211858878E-3)) * zz
+                          + S::set1(-1.66666666666666307295E-1));
+    const D polyCos = ((((( S::set1(-1.13585365213876817300E-11) * zz
+                          + S::set1(2.08757008419747316778E-9)) * zz
+                          + S::set1(-2.75573141792967388112E-7)) * zz
+                          + S::set1(2.48015872888517045348E-5)) * zz
+                          + S::set1(-1.38888888888730564116E-3)) * zz
+                          + S::set1(4.16666666666665929218E-2));
+
+    const D ps = z + z * zz * polySin;
+    const D pc = S::set1(1.0) - S::set1(0.5) * zz + zz * zz * polyCos;
+
+    const M j2 = S::eq(j, S::set1(2.0));
+    const M j4 = S::eq(j, S::set1(4.0));
+    const M j6 = S::eq(j, S::set1(6.0));
+    const M swap = S::maskOr(j2, j6);
+
+    D s = S::select(swap, pc, ps);
+    D c = S::select(swap, ps, pc);
+    s = S::select(S::maskOr(j4, j6), S::set1(0.0) - s, s);
+    c = S::select(S::maskOr(j2, j4), S::set1(0.0) - c, c);
+
+    // sin est impaire
+    sinOut = S::select(S::lt(x, S::set1(0.0)), S::set1(0.0) - s, s);
+    cosOut = c;
+}
+
+/**
+ * @brief Noyau SGP4 proche Terre sur S::Width satellites à la fois
+ *
+ * Transcription vectorielle de SGP4Kernel::propagateScalar. Différences :
+ * - fmod(x, 2π) devient x - 2π × trunc(x / 2π) ;
+ * - sin(uk)/cos(uk) sont obtenus par addition d'angles à partir de
+ *   sin(u)/cos(u), sans atan2 ;
+ * - l'itération de Kepler continue tant qu'une voie n'a pas convergé,
+ *   les voies convergées sont figées par masque.
+ */
+template <typename S>
+int propagateSimd(const SGP4BatchView& b, int begin, int end, double timeJ2000,
+                  const SGP4StateArrays& out)
+{
+    using D = typename S::D;
+    using M = typename S::M;
+    const int W = S::Width;
+
+    const D one = S::set1(1.0);
+    const D zero = S::set1(0.0);
+    const D half = S::set1(0.5);
+    const D t = S::set1(timeJ2000);
+
+    int k = begin;
+    for (; k + W <= end; k += W) {
+        const int o = k - begin;   // Indice de sortie
+        const D tsince = (t - S::load(b.epoch + k)) * S::set1(SIMD_MINUTES_PER_DAY);
+
+        // === TERMES SÉCULAIRES ===
+        const D xmdf = S::load(b.meanAnomaly + k) + S::load(b.xmdot + k) * tsince;
+        const D omgadf = S::load(b.argPerigee + k) + S::load(b.omgdot + k) * tsince;
+        const D xnoddf = S::load(b.raan + k) + S::load(b.xnodot + k) * tsince;
+
+        const D tsq = tsince * tsince;
+        const D tcube = tsq * tsince;
+        const D tfour = tsince * tcube;
+        const D xnode = xnoddf + S::load(b.xnodcf + k) * tsq;
+
+        D sinXmdf;
+        D cosXmdf;
+        simdSinCos<S>(xmdf, sinXmdf, cosXmdf);
+
+        const D delomg = S::load(b.omgcof + k) * tsince;
+        const D etaCos = one + S::load(b.eta + k) * cosXmdf;
+        const D delm = S::load(b.xmcof + k) * (etaCos * etaCos * etaCos - S::load(b.delmo + k));
+        const D xmp = xmdf + delomg + delm;
+        const D omega = omgadf - (delomg + delm);
+
+        D sinXmp;
+        D cosXmp;
+        simdSinCos<S>(xmp, sinXmp, cosXmp);
+
+        const D bstar = S::load(b.bstar + k);
+        const D tempa = one - S::load(b.c1 + k) * tsince
+                        - S::load(b.d2 + k) * tsq - S::load(b.d3 + k) * tcube - S::load(b.d4 + k) * tfour;
+        const D tempe = bstar * S::load(b.c4 + k) * tsince
+                        + bstar * S::load(b.c5 + k) * (sinXmp - S::load(b.sinmo + k));
+        const D templ = S::load(b.t2cof + k) * tsq + S::load(b.t3cof + k) * tcube
+                        + tfour * (S::load(b.t4cof + k) + tsince * S::load(b.t5cof + k));
+
+        const D a = S::load(b.semiMajorAxis + k) * tempa * tempa;
+        D e = S::load(b.eccentricity + k) - tempe;
+        const D xl = xmp + omega + xnode + S::load(b.meanMotion + k) * templ;
+
+        const M decayedA = S::lt(a, one);
+        const M badEccentricity = S::le(e, S::set1(-0.001));
+        e = S::select(S::lt(e, S::set1(1.0e-6)), S::set1(1.0e-6), e);
+        e = S::select(S::gt(e, S::set1(1.0 - 1.0e-6)), S::set1(1.0 - 1.0e-6), e);
+
+        // === TERMES PÉRIODIQUES LONGS ===
+        D sinOmega;
+        D cosOmega;
+        simdSinCos<S>(omega, sinOmega, cosOmega);
+
+        const D beta2 = one - e * e;
+        const D sqrtA = S::sqrt(a);
+        const D xn = S::set1(SIMD_XKE) / (a * sqrtA);
+        const D axn = e * cosOmega;
+        const D temp11 = one / (a * beta2);
+        const D xll = temp11 * S::load(b.xlcof + k) * axn;
+        const D aynl = temp11 * S::load(b.aycof + k);
+        const D xlt = xl + xll;
+        const D ayn = e * sinOmega + aynl;
+        const D elsq = axn * axn + ayn * ayn;
+
+        const M badElsq = S::ge(elsq, one);
+
+        // === ÉQUATION DE KEPLER, convergence voie par voie ===
+        const D twoPi = S::set1(SIMD_TWOPI);
+        const D capuArg = xlt - xnode;
+        const D capu = capuArg - twoPi * S::trunc(capuArg / twoPi);
+        const D maxNewtonRaphson = S::set1(1.25) * S::sqrt(S::abs(elsq));
+
+        D epw = capu;
+        D sinepw = zero;
+        D cosepw = zero;
+        D ecose = zero;
+        D esine = zero;
+
+        M active = S::maskNot(S::maskOr(S::maskOr(decayedA, badEccentricity), badElsq));
+
+        for (int i = 0; i < 10 && S::any(active); i++) {
+            D s;
+            D c;
+            simdSinCos<S>(epw, s, c);
+            sinepw = S::select(active, s, sinepw);
+            cosepw = S::select(active, c, cosepw);
+            ecose = S::select(active, axn * cosepw + ayn * sinepw, ecose);
+            esine = S::select(active, axn * sinepw - ayn * cosepw, esine);
+
+            const D f = capu - epw + esine;
+            active = S::maskAndNot(active, S::lt(S::abs(f), S::set1(1.0e-12)));
+
+            const D fdot = one - ecose;
+            D delta = f / fdot;
+            if (i == 0) {
+                delta = S::select(S::gt(delta, maxNewtonRaphson), maxNewtonRaphson, delta);
+                delta = S::select(S::lt(delta, zero - maxNewtonRaphson), zero - maxNewtonRaphson, delta);
+            } else {
+                delta = f / (fdot + half * esine * delta);
+            }
+            epw = S::select(active, epw + delta, epw);
+        }
+
+        // === TERMES PÉRIODIQUES COURTS ===
+        const D temp21 = one - elsq;
+        const D pl = a * temp21;
+        const M badPl = S::lt(pl, zero);
+
+        const D r = a * (one - ecose);
+        const D temp31 = one / r;
+        const D rdot = S::set1(SIMD_XKE) * sqrtA * esine * temp31;
+        const D rfdot = S::set1(SIMD_XKE) * S::sqrt(pl) * temp31;
+        const D temp32 = a * temp31;
+        const D betal = S::sqrt(temp21);
+        const D temp33 = one / (one + betal);
+        const D cosu = temp32 * (cosepw - axn + ayn * esine * temp33);
+        const D sinu = temp32 * (sinepw - ayn - axn * esine * temp33);
+        const D sin2u = S::set1(2.0) * sinu * cosu;
+        const D cos2u = S::set1(2.0) * cosu * cosu - one;
+
+        const D temp41 = one / pl;
+        const D temp42 = S::set1(SIMD_CK2) * temp41;
+        const D temp43 = temp42 * temp41;
+
+        const D x3thm1 = S::load(b.x3thm1 + k);
+        const D x1mth2 = S::load(b.x1mth2 + k);
+        const D cosio = S::load(b.cosio + k);
+        const D sinio = S::load(b.sinio + k);
+
+        const D rk = r * (one - S::set1(1.5) * temp43 * betal * x3thm1)
+                     + half * temp42 * x1mth2 * cos2u;
+        const D deltaU = S::set1(0.25) * temp43 * S::load(b.x7thm1 + k) * sin2u;
+        const D xnodek = xnode + S::set1(1.5) * temp43 * cosio * sin2u;
+        const D xinck = S::load(b.inclination + k) + S::set1(1.5) * temp43 * cosio * sinio * cos2u;
+        const D rdotk = rdot - xn * temp42 * x1mth2 * sin2u;
+        const D rfdotk = rfdot + xn * temp42 * (x1mth2 * cos2u + S::set1(1.5) * x3thm1);
+
+        const M decayedR = S::lt(rk, one);
+
+        // uk = u - deltaU : addition d'angles au lieu de atan2 puis sin/cos
+        D sinDeltaU;
+        D cosDeltaU;
+        simdSinCos<S>(deltaU, sinDeltaU, cosDeltaU);
+        const D sinuk = sinu * cosDeltaU - cosu * sinDeltaU;
+        const D cosuk = cosu * cosDeltaU + sinu * sinDeltaU;
+
+        D sinik;
+        D cosik;
+        simdSinCos<S>(xinck, sinik, cosik);
+        D sinnok;
+        D cosnok;
+        simdSinCos<S>(xnodek, sinnok, cosnok);
+
+        const D xmx = (zero - sinnok) * cosik;
+        const D xmy = cosnok * cosik;
+        const D ux = xmx * sinuk + cosnok * cosuk;
+        const D uy = xmy * sinuk + sinnok * cosuk;
+        const D uz = sinik * sinuk;
+        const D vx = xmx * cosuk - cosnok * sinuk;
+        const D vy = xmy * cosuk - sinnok * sinuk;
+        const D vz = sinik * cosuk;
+
+        // === POSITION (km) ET VITESSE (km/s) ===
+        const D xkmper = S::set1(SIMD_XKMPER);
+        S::store(out.x + o, rk * ux * xkmper);
+        S::store(out.y + o, rk * uy * xkmper);
+        S::store(out.z + o, rk * uz * xkmper);
+
+        const D velocityScale = S::set1(SIMD_XKMPER / 60.0);
+        S::store(out.vx + o, (rdotk * ux + rfdotk * vx) * velocityScale);
+        S::store(out.vy + o, (rdotk * uy + rfdotk * vy) * velocityScale);
+        S::store(out.vz + o, (rdotk * uz + rfdotk * vz) * velocityScale);
+
+        // === STATUTS (même priorité que la version scalaire) ===
+        const int decayedABits = S::bits(decayedA);
+        const int eccBits = S::bits(badEccentricity);
+        const int elsqBits = S::bits(badElsq);
+        const int plBits = S::bits(badPl);
+        const int decayedRBits = S::bits(decayedR);
+
+        for (int lane = 0; lane < W; ++lane) {
+            const int bit = 1 << lane;
+            quint8 status = SGP4Status::Ok;
+            if (decayedABits & bit) {
+                status = SGP4Status::Decayed;
+            } else if (eccBits & bit) {
+                status = SGP4Status::EccentricityOutOfRange;
+            } else if ((elsqBits | plBits) & bit) {
+                status = SGP4Status::InvalidElements;
+            } else if (decayedRBits & bit) {
+                status = SGP4Status::Decayed;
+            }
+            out.status[o + lane] = status;
+        }
+    }
+
+    return k;
+}
+
+} // namespace
+
+#endif // SGP4KERNELSIMD_H
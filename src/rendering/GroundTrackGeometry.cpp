@@ -0,0 +1,215 @@
+#include "GroundTrackGeometry.h"
+#include <algorithm>
+#include <cmath>
+
+// Juste au-dessus de la Terre de main.qml (150 unités) : ~40 km
+const float DEFAULT_RADIUS = 151.0f;
+
+// Points du contour de l'empreinte
+const int FOOTPRINT_SEGMENTS = 96;
+
+const int FLOATS_PER_VERTEX = 3;
+
+GroundTrackGeometry::GroundTrackGeometry(QQuick3DObject *parent)
+    : RingGeometry(parent)
+    , m_part(TrackLine)
+    , m_radius(DEFAULT_RADIUS)
+    , m_vertexCount(0)
+    , m_uploadedBytes(0)
+    , m_fullUpload(true)
+    , m_updatePending(false)
+{
+}
+
+void GroundTrackGeometry::setTrack(GroundTrack* track)
+{
+    if (m_track == track)
+        return;
+
+    if (m_track) {
+        disconnect(m_track, nullptr, this, nullptr);
+    }
+
+    m_track = track;
+    if (m_track) {
+        connect(m_track, &GroundTrack::trackChanged, this, &GroundTrackGeometry::scheduleUpdate);
+        connect(m_track, &GroundTrack::windowChanged, this, &GroundTrackGeometry::scheduleFullUpload);
+    }
+
+    emit trackChanged();
+    scheduleFullUpload();
+}
+
+void GroundTrackGeometry::setPart(Part part)
+{
+    if (m_part == part)
+        return;
+
+    m_part = part;
+    emit partChanged();
+    scheduleFullUpload();
+}
+
+void GroundTrackGeometry::setRadius(float radius)
+{
+    if (qFuzzyCompare(m_radius, radius))
+        return;
+
+    m_radius = radius;
+    emit radiusChanged();
+    scheduleFullUpload();
+}
+
+void GroundTrackGeometry::scheduleFullUpload()
+{
+    m_fullUpload = true;
+    scheduleUpdate();
+}
+
+void GroundTrackGeometry::scheduleUpdate()
+{
+    // Un seul envoi au GPU par tour de boucle
+    if (m_updatePending)
+        return;
+
+    m_updatePending = true;
+    QMetaObject::invokeMethod(this, &GroundTrackGeometry::updateBuffers, Qt::QueuedConnection);
+}
+
+int GroundTrackGeometry::vertexBytes() const
+{
+    return (m_part == SwathArea ? 2 : 1) * FLOATS_PER_VERTEX * int(sizeof(float));
+}
+
+int GroundTrackGeometry::segmentBytes() const
+{
+    return (m_part == SwathArea ? 6 : 2) * int(sizeof(quint32));
+}
+
+void GroundTrackGeometry::writeVertices(int slot)
+{
+    const GroundSample& sample = m_track->sampleAt(slot);
+    float* out = reinterpret_cast<float*>(m_vertices.data() + slot * vertexBytes());
+
+    if (m_part == SwathArea) {
+        const QVector3D center = sample.up * std::cos(sample.swathAngle);
+        const QVector3D side = sample.crossTrack * std::sin(sample.swathAngle);
+        const QVector3D left = (center + side) * m_radius;
+        const QVector3D right = (center - side) * m_radius;
+        out[0] = left.x();  out[1] = left.y();  out[2] = left.z();
+        out[3] = right.x(); out[4] = right.y(); out[5] = right.z();
+    } else {
+        const QVector3D point = sample.up * m_radius;
+        out[0] = point.x(); out[1] = point.y(); out[2] = point.z();
+    }
+}
+
+void GroundTrackGeometry::writeSegment(int slot)
+{
+    const bool swath = (m_part == SwathArea);
+    const int verticesPerSlot = swath ? 2 : 1;
+    const int indicesPerSlot = swath ? 6 : 2;
+    quint32* segment = reinterpret_cast<quint32*>(m_indices.data()) + slot * indicesPerSlot;
+
+    const quint32 a = quint32(slot * verticesPerSlot);
+    std::fill(segment, segment + indicesPerSlot, a);
+
+    qint64 k;
+    if (!segmentAt(*m_track, slot, k)) {
+        return;
+    }
+
+    const quint32 b = quint32(m_track->slotOf(k + 1) * verticesPerSlot);
+    if (swath) {
+        // Quadrilatère gauche/droite entre deux échantillons
+        segment[0] = a;     segment[1] = a + 1; segment[2] = b;
+        segment[3] = a + 1; segment[4] = b + 1; segment[5] = b;
+    } else {
+        segment[0] = a;
+        segment[1] = b;
+    }
+}
+
+void GroundTrackGeometry::fillFootprint()
+{
+    QVector<QVector3D> directions;
+    m_track->footprint(directions, FOOTPRINT_SEGMENTS);
+
+    // Taille fixe : contour replié à l'origine quand la position est inconnue
+    m_vertices.fill('\0', (FOOTPRINT_SEGMENTS + 1) * FLOATS_PER_VERTEX * int(sizeof(float)));
+    m_indices.clear();
+
+    float* v = reinterpret_cast<float*>(m_vertices.data());
+    for (const QVector3D& direction : std::as_const(directions)) {
+        *v++ = direction.x() * m_radius;
+        *v++ = direction.y() * m_radius;
+        *v++ = direction.z() * m_radius;
+    }
+}
+
+void GroundTrackGeometry::fullUpload()
+{
+    if (m_part == Footprint) {
+        fillFootprint();
+    } else {
+        fillRing(*m_track, vertexBytes(), segmentBytes());
+    }
+
+    clear();
+    setStride(FLOATS_PER_VERTEX * sizeof(float));
+    addAttribute(QQuick3DGeometry::Attribute::PositionSemantic, 0,
+                 QQuick3DGeometry::Attribute::F32Type);
+
+    if (m_part == Footprint) {
+        setPrimitiveType(QQuick3DGeometry::PrimitiveType::LineStrip);
+    } else {
+        setPrimitiveType(m_part == SwathArea ? QQuick3DGeometry::PrimitiveType::Triangles
+                                             : QQuick3DGeometry::PrimitiveType::Lines);
+        addAttribute(QQuick3DGeometry::Attribute::IndexSemantic, 0,
+                     QQuick3DGeometry::Attribute::U32Type);
+        setIndexData(m_indices);
+    }
+    setVertexData(m_vertices);
+
+    // Bornes fixes : la sphère porteuse
+    setBounds(QVector3D(-m_radius, -m_radius, -m_radius), QVector3D(m_radius, m_radius, m_radius));
+}
+
+void GroundTrackGeometry::updateBuffers()
+{
+    m_updatePending = false;
+    m_uploadedBytes = 0;
+
+    if (!m_track) {
+        clear();
+        m_vertices.clear();
+        m_indices.clear();
+        m_vertexCount = 0;
+        update();
+        emit geometryUpdated();
+        return;
+    }
+
+    // Tampons à reprendre entièrement : partie ou rayon modifiés, trace
+    // vidée, ou saut sans recouvrement avec la fenêtre envoyée
+    const bool full = m_fullUpload || (m_part != Footprint && !continuesUpload(*m_track));
+
+    if (full) {
+        m_fullUpload = false;
+        fullUpload();
+        m_uploadedBytes = m_vertices.size() + m_indices.size();
+    } else if (m_part == Footprint) {
+        // Le contour suit la position courante : renvoyé en entier
+        fillFootprint();
+        setVertexData(0, m_vertices);
+        m_uploadedBytes = m_vertices.size();
+    } else {
+        m_uploadedBytes = uploadDelta(*m_track, vertexBytes(), segmentBytes());
+    }
+
+    m_vertexCount = m_vertices.size() / (FLOATS_PER_VERTEX * int(sizeof(float)));
+    if (m_uploadedBytes > 0) {
+        update();
+    }
+    emit geometryUpdated();
+}
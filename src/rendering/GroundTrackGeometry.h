@@ -0,0 +1,91 @@
+#ifndef GROUNDTRACKGEOMETRY_H
+#define GROUNDTRACKGEOMETRY_H
+
+#include <QPointer>
+#include "RingGeometry.h"
+#include "../orbit/GroundTrack.h"
+
+/**
+ * @brief Géométrie Qt Quick 3D d'une trace au sol, de sa fauchée ou de son empreinte
+ *
+ * Les sommets sont posés sur une sphère de rayon radius, en ECEF : le
+ * Model doit être placé dans un nœud tourné du temps sidéral (repère
+ * terrestre, voir earthFrame dans main.qml).
+ *
+ * Trace et fauchée : un bloc par case du tampon circulaire de
+ * GroundTrack (RingGeometry), d'un sommet et une ligne pour la trace, de
+ * deux sommets (bords gauche et droit) et deux triangles pour la fauchée.
+ *
+ * Empreinte : contour fermé autour du point sous-satellite courant,
+ * entièrement renvoyé à chaque mise à jour (il se déplace à chaque image).
+ */
+class GroundTrackGeometry : public RingGeometry
+{
+    Q_OBJECT
+
+    // Propriétés exposées à QML
+    Q_PROPERTY(GroundTrack* track READ track WRITE setTrack NOTIFY trackChanged)
+    Q_PROPERTY(Part part READ part WRITE setPart NOTIFY partChanged)
+    Q_PROPERTY(float radius READ radius WRITE setRadius NOTIFY radiusChanged)
+    Q_PROPERTY(int vertexCount READ vertexCount NOTIFY geometryUpdated)
+    Q_PROPERTY(int uploadedBytes READ uploadedBytes NOTIFY geometryUpdated)
+
+public:
+    /**
+     * @brief Élément de la trace représenté
+     */
+    enum Part {
+        TrackLine = 0,      // Trace du point sous-satellite (lignes)
+        SwathArea,          // Bande balayée par le capteur (triangles)
+        Footprint           // Empreinte courante (contour)
+    };
+    Q_ENUM(Part)
+
+    explicit GroundTrackGeometry(QQuick3DObject *parent = nullptr);
+
+    // Getters
+    GroundTrack* track() const { return m_track; }
+    Part part() const { return m_part; }
+    float radius() const { return m_radius; }
+    int vertexCount() const { return m_vertexCount; }
+
+    /**
+     * @brief Octets envoyés au GPU par la dernière mise à jour (sommets + indices)
+     */
+    int uploadedBytes() const { return m_uploadedBytes; }
+
+    // Setters (reconstruction complète à la prochaine mise à jour)
+    void setTrack(GroundTrack* track);
+    void setPart(Part part);
+    void setRadius(float radius);
+
+signals:
+    void trackChanged();
+    void partChanged();
+    void radiusChanged();
+    void geometryUpdated();
+
+protected:
+    void writeVertices(int slot) override;
+    void writeSegment(int slot) override;
+
+private:
+    QPointer<GroundTrack> m_track;
+    Part m_part;
+    float m_radius;
+
+    int m_vertexCount;
+    int m_uploadedBytes;
+    bool m_fullUpload;
+    bool m_updatePending;
+
+    void scheduleUpdate();
+    void scheduleFullUpload();
+    void updateBuffers();
+    void fullUpload();
+    void fillFootprint();
+    int vertexBytes() const;
+    int segmentBytes() const;
+};
+
+#endif // GROUNDTRACKGEOMETRY_H
@@ -0,0 +1,177 @@
+#include "KtxTexture.h"
+#include <QIODevice>
+#include <QtEndian>
+#include <cstring>
+
+namespace {
+
+const char KTX_IDENTIFIER[12] = {
+    '\xAB', 'K', 'T', 'X', ' ', '1', '1', '\xBB', '\r', '\n', '\x1A', '\n'
+};
+const quint32 KTX_ENDIANNESS = 0x04030201;
+
+// Lignes stockées de haut en bas (ordre de QImage)
+const char ORIENTATION_KEY[] = "KTXorientation";
+const char ORIENTATION_VALUE[] = "S=r,T=d";
+
+struct Header {
+    char identifier[12];
+    quint32 endianness;
+    quint32 glType;
+    quint32 glTypeSize;
+    quint32 glFormat;
+    quint32 glInternalFormat;
+    quint32 glBaseInternalFormat;
+    quint32 pixelWidth;
+    quint32 pixelHeight;
+    quint32 pixelDepth;
+    quint32 numberOfArrayElements;
+    quint32 numberOfFaces;
+    quint32 numberOfMipmapLevels;
+    quint32 bytesOfKeyValueData;
+};
+static_assert(sizeof(Header) == 64, "En-tête KTX 1.1 : 64 octets");
+
+inline quint32 padding4(quint32 bytes)
+{
+    return (4 - (bytes & 3)) & 3;
+}
+
+bool writeUInt32(QIODevice* device, quint32 value)
+{
+    const quint32 le = qToLittleEndian(value);
+    return device->write(reinterpret_cast<const char*>(&le), 4) == 4;
+}
+
+bool fail(QString* error, const QString& message)
+{
+    if (error) {
+        *error = message;
+    }
+    return false;
+}
+
+} // namespace
+
+namespace KtxTexture {
+
+bool write(QIODevice* device, quint32 glInternalFormat, quint32 glBaseInternalFormat,
+           int width, int height, const QVector<QByteArray>& levels)
+{
+    if (!device || levels.isEmpty()) {
+        return false;
+    }
+
+    // Une seule paire clé/valeur : orientation des lignes
+    const quint32 pairBytes = sizeof(ORIENTATION_KEY) + sizeof(ORIENTATION_VALUE);
+    const quint32 keyValueBytes = 4 + pairBytes + padding4(pairBytes);
+
+    Header header;
+    std::memcpy(header.identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER));
+    header.endianness = KTX_ENDIANNESS;
+    header.glType = 0;              // Format compressé : type et format nuls
+    header.glTypeSize = 1;
+    header.glFormat = 0;
+    header.glInternalFormat = glInternalFormat;
+    header.glBaseInternalFormat = glBaseInternalFormat;
+    header.pixelWidth = quint32(width);
+    header.pixelHeight = quint32(height);
+    header.pixelDepth = 0;
+    header.numberOfArrayElements = 0;
+    header.numberOfFaces = 1;
+    header.numberOfMipmapLevels = quint32(levels.size());
+    header.bytesOfKeyValueData = keyValueBytes;
+
+    // Fichier écrit en little-endian (le champ endianness le déclare)
+    quint32* fields = reinterpret_cast<quint32*>(reinterpret_cast<char*>(&header) + sizeof(header.identifier));
+    for (int i = 0; i < 13; ++i) {
+        fields[i] = qToLittleEndian(fields[i]);
+    }
+
+    if (device->write(reinterpret_cast<const char*>(&header), sizeof(header)) != qint64(sizeof(header))) {
+        return false;
+    }
+
+    const char zeros[4] = { 0, 0, 0, 0 };
+
+    if (!writeUInt32(device, pairBytes)
+        || device->write(ORIENTATION_KEY, sizeof(ORIENTATION_KEY)) != qint64(sizeof(ORIENTATION_KEY))
+        || device->write(ORIENTATION_VALUE, sizeof(ORIENTATION_VALUE)) != qint64(sizeof(ORIENTATION_VALUE))
+        || device->write(zeros, padding4(pairBytes)) != qint64(padding4(pairBytes))) {
+        return false;
+    }
+
+    for (const QByteArray& level : levels) {
+        const quint32 bytes = quint32(level.size());
+        if (!writeUInt32(device, bytes)
+            || device->write(level) != level.size()
+            || device->write(zeros, padding4(bytes)) != qint64(padding4(bytes))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool readInfo(QIODevice* device, Info& info, QString* error)
+{
+    if (!device || !device->isReadable()) {
+        return fail(error, QStringLiteral("fichier illisible"));
+    }
+
+    Header header;
+    if (device->read(reinterpret_cast<char*>(&header), sizeof(header)) != qint64(sizeof(header))) {
+        return fail(error, QStringLiteral("en-tête tronqué"));
+    }
+    if (std::memcmp(header.identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER)) != 0) {
+        return fail(error, QStringLiteral("identifiant KTX 1.1 absent"));
+    }
+
+    quint32* fields = reinterpret_cast<quint32*>(reinterpret_cast<char*>(&header) + sizeof(header.identifier));
+    const bool swapped = qFromLittleEndian(header.endianness) != KTX_ENDIANNESS;
+    for (int i = 0; i < 13; ++i) {
+        fields[i] = swapped ? qFromBigEndian(fields[i]) : qFromLittleEndian(fields[i]);
+    }
+    if (header.endianness != KTX_ENDIANNESS) {
+        return fail(error, QStringLiteral("boutisme inconnu"));
+    }
+
+    if (header.pixelWidth == 0 || header.pixelHeight == 0 || header.pixelDepth != 0
+        || header.numberOfArrayElements != 0 || header.numberOfFaces != 1) {
+        return fail(error, QStringLiteral("texture 2D simple attendue"));
+    }
+
+    const quint32 levels = qMax<quint32>(1, header.numberOfMipmapLevels);
+    if (levels > 32) {
+        return fail(error, QStringLiteral("nombre de niveaux invalide (%1)").arg(levels));
+    }
+
+    if (!device->seek(device->pos() + header.bytesOfKeyValueData)) {
+        return fail(error, QStringLiteral("métadonnées tronquées"));
+    }
+
+    // Table des niveaux : chaque taille annoncée doit être présente dans le fichier
+    qint64 dataBytes = 0;
+    for (quint32 level = 0; level < levels; ++level) {
+        quint32 bytes = 0;
+        if (device->read(reinterpret_cast<char*>(&bytes), 4) != 4) {
+            return fail(error, QStringLiteral("niveau %1 absent").arg(level));
+        }
+        bytes = swapped ? qFromBigEndian(bytes) : qFromLittleEndian(bytes);
+
+        const qint64 next = device->pos() + bytes + padding4(bytes);
+        if (next > device->size() + qint64(padding4(bytes)) || !device->seek(qMin(next, device->size()))) {
+            return fail(error, QStringLiteral("niveau %1 tronqué").arg(level));
+        }
+        dataBytes += bytes;
+    }
+
+    info.glInternalFormat = header.glInternalFormat;
+    info.width = int(header.pixelWidth);
+    info.height = int(header.pixelHeight);
+    info.levels = int(levels);
+    info.dataBytes = dataBytes;
+    return true;
+}
+
+} // namespace KtxTexture
@@ -0,0 +1,52 @@
+#ifndef KTXTEXTURE_H
+#define KTXTEXTURE_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+
+class QIODevice;
+
+/**
+ * @brief Conteneur KTX 1.1 (textures compressées prémipmappées)
+ *
+ * Format lu nativement par Qt Quick 3D (Texture.source sur un .ktx) : les
+ * niveaux de mipmap sont envoyés tels quels au GPU, sans décodage ni
+ * génération à l'exécution. Écrit hors ligne par orbifrance_texturebaker,
+ * relu à l'exécution par TextureLoader pour validation.
+ */
+namespace KtxTexture {
+
+// Formats OpenGL utilisés (glInternalFormat / glBaseInternalFormat)
+const quint32 GL_COMPRESSED_RGB_S3TC_DXT1 = 0x83F0;    // BC1, 4 bits par pixel
+const quint32 GL_RGB = 0x1907;
+
+/**
+ * @brief Description d'un fichier KTX
+ */
+struct Info {
+    quint32 glInternalFormat = 0;
+    int width = 0;
+    int height = 0;
+    int levels = 0;
+    qint64 dataBytes = 0;       // Somme des niveaux (octets envoyés au GPU)
+};
+
+/**
+ * @brief Écrit une texture 2D compressée et sa chaîne de mipmaps
+ * @param levels Données de chaque niveau, du plus grand au plus petit
+ * @return false en cas d'erreur d'écriture
+ */
+bool write(QIODevice* device, quint32 glInternalFormat, quint32 glBaseInternalFormat,
+           int width, int height, const QVector<QByteArray>& levels);
+
+/**
+ * @brief Lit et vérifie l'en-tête et la table des niveaux
+ * @param error [out] Message en cas d'échec (optionnel)
+ * @return false si le fichier n'est pas un KTX 1.1 2D complet
+ */
+bool readInfo(QIODevice* device, Info& info, QString* error = nullptr);
+
+} // namespace KtxTexture
+
+#endif // KTXTEXTURE_H
@@ -0,0 +1,330 @@
+#include "OrbitGeometry.h"
+#include <QByteArray>
+#include <QDebug>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+const int FLOATS_PER_VERTEX = 3;
+
+// Liaisons passé → position courante → futur, après les segments des cases
+const int JUNCTION_SEGMENTS = 2;
+
+OrbitGeometry::OrbitGeometry(QQuick3DObject *parent)
+    : RingGeometry(parent)
+    , m_segment(WholeTrack)
+    , m_rebuildPending(false)
+    , m_vertexCount(0)
+    , m_uploadedNow(0)
+    , m_fullUpload(true)
+    , m_trackUpdatePending(false)
+{
+    rebuild();
+}
+
+void OrbitGeometry::setPath(OrbitPath* path)
+{
+    if (m_path == path)
+        return;
+
+    if (m_path) {
+        disconnect(m_path, nullptr, this, nullptr);
+    }
+
+    m_path = path;
+    if (m_path) {
+        connect(m_path, &OrbitPath::orbitChanged, this, &OrbitGeometry::updateFromPath);
+    }
+
+    emit pathChanged();
+    updateFromPath();
+}
+
+void OrbitGeometry::updateFromPath()
+{
+    if (!m_path) {
+        clearTracks();
+        return;
+    }
+
+    setTrack(m_path->orbitPoints());
+}
+
+void OrbitGeometry::setTrackSource(OrbitTrack* track)
+{
+    if (m_track == track)
+        return;
+
+    if (m_track) {
+        disconnect(m_track, nullptr, this, nullptr);
+    }
+
+    m_track = track;
+    m_fullUpload = true;
+    if (m_track) {
+        connect(m_track, &OrbitTrack::trackChanged, this, &OrbitGeometry::updateFromTrack);
+    }
+
+    emit trackSourceChanged();
+    if (m_track) {
+        updateFromTrack();
+    } else {
+        clearTracks();
+    }
+}
+
+void OrbitGeometry::setSegment(TrackSegment segment)
+{
+    if (m_segment == segment)
+        return;
+
+    m_segment = segment;
+    m_fullUpload = true;
+    emit segmentChanged();
+    updateFromTrack();
+}
+
+void OrbitGeometry::updateFromTrack()
+{
+    // Un seul envoi au GPU par tour de boucle, même si la trace glisse plusieurs fois
+    if (!m_track || m_trackUpdatePending)
+        return;
+
+    m_trackUpdatePending = true;
+    QMetaObject::invokeMethod(this, &OrbitGeometry::updateTrackBuffers, Qt::QueuedConnection);
+}
+
+void OrbitGeometry::setTrack(const QVector<QVector3D>& points)
+{
+    m_points.clear();
+    m_trackOffsets.clear();
+    addTrack(points);
+    scheduleRebuild();
+}
+
+int OrbitGeometry::addTrack(const QVector3D* points, int count)
+{
+    if (count < 2) {
+        return -1;
+    }
+
+    m_trackOffsets.append(m_points.size());
+    m_points.resize(m_points.size() + count);
+    std::memcpy(m_points.data() + m_trackOffsets.last(), points, sizeof(QVector3D) * count);
+
+    scheduleRebuild();
+    return m_trackOffsets.size() - 1;
+}
+
+void OrbitGeometry::clearTracks()
+{
+    m_points.clear();
+    m_trackOffsets.clear();
+    scheduleRebuild();
+}
+
+void OrbitGeometry::scheduleRebuild()
+{
+    // Un seul envoi au GPU par tour de boucle, quel que soit le nombre d'ajouts
+    if (m_rebuildPending)
+        return;
+
+    m_rebuildPending = true;
+    QMetaObject::invokeMethod(this, &OrbitGeometry::rebuild, Qt::QueuedConnection);
+}
+
+void OrbitGeometry::rebuild()
+{
+    m_rebuildPending = false;
+
+    // Trace branchée : les tampons lui appartiennent
+    if (m_track)
+        return;
+
+    clear();
+    m_fullUpload = true;
+
+    const int pointCount = m_points.size();
+    const int tracks = m_trackOffsets.size();
+    m_vertexCount = pointCount;
+
+    // === Sommets : x, y, z (float) ===
+    QByteArray vertices(pointCount * 3 * int(sizeof(float)), Qt::Uninitialized);
+    float* v = reinterpret_cast<float*>(vertices.data());
+
+    QVector3D minBound(std::numeric_limits<float>::max(),
+                       std::numeric_limits<float>::max(),
+                       std::numeric_limits<float>::max());
+    QVector3D maxBound = -minBound;
+
+    for (const QVector3D& point : std::as_const(m_points)) {
+        *v++ = point.x();
+        *v++ = point.y();
+        *v++ = point.z();
+
+        minBound.setX(qMin(minBound.x(), point.x()));
+        minBound.setY(qMin(minBound.y(), point.y()));
+        minBound.setZ(qMin(minBound.z(), point.z()));
+        maxBound.setX(qMax(maxBound.x(), point.x()));
+        maxBound.setY(qMax(maxBound.y(), point.y()));
+        maxBound.setZ(qMax(maxBound.z(), point.z()));
+    }
+
+    setStride(3 * sizeof(float));
+    addAttribute(QQuick3DGeometry::Attribute::PositionSemantic, 0,
+                 QQuick3DGeometry::Attribute::F32Type);
+
+    if (tracks <= 1) {
+        // Une seule trajectoire : bande de lignes, pas d'index
+        setPrimitiveType(QQuick3DGeometry::PrimitiveType::LineStrip);
+    } else {
+        // Plusieurs trajectoires : segments indexés, sans liaison entre trajectoires
+        setPrimitiveType(QQuick3DGeometry::PrimitiveType::Lines);
+
+        QByteArray indices((pointCount - tracks) * 2 * int(sizeof(quint32)), Qt::Uninitialized);
+        quint32* index = reinterpret_cast<quint32*>(indices.data());
+
+        for (int t = 0; t < tracks; ++t) {
+            const int first = m_trackOffsets[t];
+            const int last = (t + 1 < tracks) ? m_trackOffsets[t + 1] : pointCount;
+            for (int i = first; i + 1 < last; ++i) {
+                *index++ = quint32(i);
+                *index++ = quint32(i + 1);
+            }
+        }
+
+        addAttribute(QQuick3DGeometry::Attribute::IndexSemantic, 0,
+                     QQuick3DGeometry::Attribute::U32Type);
+        setIndexData(indices);
+    }
+
+    setVertexData(vertices);
+    if (pointCount > 0) {
+        setBounds(minBound, maxBound);
+    }
+
+    update();
+    emit tracksChanged();
+}
+
+void OrbitGeometry::writeVertex(int vertex, const QVector3D& point)
+{
+    float* v = reinterpret_cast<float*>(m_vertices.data()) + vertex * FLOATS_PER_VERTEX;
+    v[0] = point.x();
+    v[1] = point.y();
+    v[2] = point.z();
+
+    // Bornes élargies, jamais resserrées entre deux envois complets
+    m_minBound = QVector3D(qMin(m_minBound.x(), point.x()), qMin(m_minBound.y(), point.y()),
+                           qMin(m_minBound.z(), point.z()));
+    m_maxBound = QVector3D(qMax(m_maxBound.x(), point.x()), qMax(m_maxBound.y(), point.y()),
+                           qMax(m_maxBound.z(), point.z()));
+}
+
+void OrbitGeometry::writeVertices(int slot)
+{
+    writeVertex(slot, m_track->sampleAt(slot));
+}
+
+void OrbitGeometry::writeSegment(int slot)
+{
+    quint32* segment = reinterpret_cast<quint32*>(m_indices.data()) + slot * 2;
+    segment[0] = quint32(slot);
+    segment[1] = quint32(slot);
+
+    qint64 k;
+    if (!segmentAt(*m_track, slot, k)) {
+        return;
+    }
+
+    // Le segment qui enjambe l'instant courant passe par la position courante
+    const qint64 now = m_track->currentGridIndex();
+    const bool past = (k + 1 <= now);
+    const bool future = (k > now);
+    if ((m_segment == PastSegment && !past) || (m_segment == FutureSegment && !future) || (!past && !future)) {
+        return;
+    }
+
+    segment[1] = quint32(m_track->slotOf(k + 1));
+}
+
+void OrbitGeometry::writeJunctions(qint64 now)
+{
+    const int capacity = m_track->capacity();
+    const quint32 current = quint32(capacity);
+    quint32* junction = reinterpret_cast<quint32*>(m_indices.data()) + capacity * 2;
+    std::fill(junction, junction + JUNCTION_SEGMENTS * 2, current);
+
+    if (m_segment != FutureSegment && m_track->contains(now)) {
+        junction[1] = quint32(m_track->slotOf(now));
+    }
+    if (m_segment != PastSegment && m_track->contains(now + 1)) {
+        junction[3] = quint32(m_track->slotOf(now + 1));
+    }
+}
+
+void OrbitGeometry::updateTrackBuffers()
+{
+    m_trackUpdatePending = false;
+    if (!m_track) {
+        return;
+    }
+
+    const int capacity = m_track->capacity();
+    const qint64 first = m_track->firstGridIndex();
+    const qint64 last = first + m_track->sampleCount() - 1;
+    const qint64 now = m_track->currentGridIndex();
+    const int vertexBytes = FLOATS_PER_VERTEX * int(sizeof(float));
+    const int segmentBytes = 2 * int(sizeof(quint32));
+
+    // Tampons à reprendre entièrement : trace vidée, segment changé ou saut hors fenêtre
+    const bool full = m_fullUpload || !continuesUpload(*m_track)
+                      || m_vertices.size() != (capacity + 1) * vertexBytes;
+
+    if (full) {
+        m_fullUpload = false;
+        m_minBound = QVector3D(std::numeric_limits<float>::max(),
+                               std::numeric_limits<float>::max(),
+                               std::numeric_limits<float>::max());
+        m_maxBound = -m_minBound;
+
+        fillRing(*m_track, vertexBytes, segmentBytes, 1, JUNCTION_SEGMENTS);
+        writeVertex(capacity, m_track->currentPosition());
+        writeJunctions(now);
+
+        clear();
+        setStride(vertexBytes);
+        addAttribute(QQuick3DGeometry::Attribute::PositionSemantic, 0,
+                     QQuick3DGeometry::Attribute::F32Type);
+        setPrimitiveType(QQuick3DGeometry::PrimitiveType::Lines);
+        addAttribute(QQuick3DGeometry::Attribute::IndexSemantic, 0,
+                     QQuick3DGeometry::Attribute::U32Type);
+        setIndexData(m_indices);
+        setVertexData(m_vertices);
+    } else {
+        QVector<int> segmentSlots;
+
+        // Segments qui ont basculé entre passé et futur
+        for (qint64 k = qMax(first, qMin(now, m_uploadedNow)); k <= qMin(last, qMax(now, m_uploadedNow)); ++k) {
+            writeSegment(m_track->slotOf(k));
+            segmentSlots.append(m_track->slotOf(k));
+        }
+
+        // Position courante et liaisons : à chaque image
+        writeVertex(capacity, m_track->currentPosition());
+        writeJunctions(now);
+        segmentSlots.append(capacity);
+        segmentSlots.append(capacity + 1);
+
+        uploadDelta(*m_track, vertexBytes, segmentBytes, QVector<int>{ capacity }, segmentSlots);
+    }
+
+    // Bornes élargies par les nouveaux échantillons, recalculées à chaque envoi complet
+    setBounds(m_minBound, m_maxBound);
+
+    m_uploadedNow = now;
+    m_vertexCount = capacity + 1;
+
+    update();
+    emit tracksChanged();
+}
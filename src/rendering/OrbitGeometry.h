@@ -0,0 +1,125 @@
+#ifndef ORBITGEOMETRY_H
+#define ORBITGEOMETRY_H
+
+#include <QVector>
+#include <QVector3D>
+#include <QPointer>
+#include "RingGeometry.h"
+#include "../orbit/OrbitPath.h"
+#include "../orbit/OrbitTrack.h"
+
+/**
+ * @brief Géométrie Qt Quick 3D des trajectoires orbitales (lignes)
+ *
+ * Toutes les trajectoires sont regroupées dans un seul tampon de sommets
+ * (x, y, z en float) : une trajectoire seule est tracée en LineStrip, un
+ * ensemble de trajectoires en segments indexés (Lines). Un seul Model,
+ * donc un seul appel de dessin, quel que soit le nombre de points.
+ *
+ * Les points sont soit fournis depuis C++ (setTrack(), addTrack()),
+ * soit générés à partir d'un OrbitPath (propriété path), recalculés à
+ * chaque orbitChanged(). Les tampons GPU sont reconstruits une seule fois
+ * par tour de boucle d'événements, même après des milliers d'addTrack().
+ *
+ * Trace SGP4 glissante (propriété track, segment passé ou futur) : un
+ * sommet par case du tampon circulaire d'OrbitTrack (RingGeometry), plus
+ * la position courante, et des segments indexés k → k+1. En plus des
+ * cases entrées ou sorties de la fenêtre, seuls les segments qui
+ * basculent entre passé et futur sont renvoyés à chaque image. Les
+ * trajectoires fournies depuis C++ sont ignorées tant qu'une trace est
+ * branchée.
+ */
+class OrbitGeometry : public RingGeometry
+{
+    Q_OBJECT
+
+    // Propriétés exposées à QML
+    Q_PROPERTY(OrbitPath* path READ path WRITE setPath NOTIFY pathChanged)
+    Q_PROPERTY(OrbitTrack* track READ track WRITE setTrackSource NOTIFY trackSourceChanged)
+    Q_PROPERTY(TrackSegment segment READ segment WRITE setSegment NOTIFY segmentChanged)
+    Q_PROPERTY(int trackCount READ trackCount NOTIFY tracksChanged)
+    Q_PROPERTY(int vertexCount READ vertexCount NOTIFY tracksChanged)
+
+public:
+    /**
+     * @brief Partie d'une OrbitTrack affichée
+     */
+    enum TrackSegment {
+        WholeTrack = 0,
+        PastSegment,        // Jusqu'à la position courante
+        FutureSegment       // Depuis la position courante
+    };
+    Q_ENUM(TrackSegment)
+
+    explicit OrbitGeometry(QQuick3DObject *parent = nullptr);
+
+    // Getters
+    OrbitPath* path() const { return m_path; }
+    OrbitTrack* track() const { return m_track; }
+    TrackSegment segment() const { return m_segment; }
+    int trackCount() const { return m_track ? 1 : m_trackOffsets.size(); }
+    int vertexCount() const { return m_vertexCount; }
+
+    // Setters
+    void setPath(OrbitPath* path);
+    void setTrackSource(OrbitTrack* track);
+    void setSegment(TrackSegment segment);
+
+    /**
+     * @brief Remplace toutes les trajectoires par une seule
+     * @param points Points successifs (unités de la scène)
+     */
+    void setTrack(const QVector<QVector3D>& points);
+
+    /**
+     * @brief Ajoute une trajectoire au tampon commun
+     * @param points Points successifs (unités de la scène)
+     * @param count Nombre de points (une trajectoire de moins de 2 points est ignorée)
+     * @return Indice de la trajectoire, ou -1 si ignorée
+     */
+    int addTrack(const QVector3D* points, int count);
+    int addTrack(const QVector<QVector3D>& points) { return addTrack(points.constData(), points.size()); }
+
+    /**
+     * @brief Retire toutes les trajectoires
+     */
+    Q_INVOKABLE void clearTracks();
+
+signals:
+    void pathChanged();
+    void trackSourceChanged();
+    void segmentChanged();
+    void tracksChanged();
+
+protected:
+    void writeVertices(int slot) override;
+    void writeSegment(int slot) override;
+
+private:
+    QPointer<OrbitPath> m_path;
+    QPointer<OrbitTrack> m_track;
+    TrackSegment m_segment;
+
+    // Points de toutes les trajectoires, bout à bout
+    QVector<QVector3D> m_points;
+    QVector<int> m_trackOffsets;    // Premier point de chaque trajectoire
+    bool m_rebuildPending;
+    int m_vertexCount;
+
+    // Trace glissante : instant courant et bornes des tampons envoyés
+    qint64 m_uploadedNow;
+    QVector3D m_minBound;
+    QVector3D m_maxBound;
+    bool m_fullUpload;
+    bool m_trackUpdatePending;
+
+    void updateFromPath();
+    void updateFromTrack();
+    void scheduleRebuild();
+    void rebuild();
+    void updateTrackBuffers();
+    void writeVertex(int vertex, const QVector3D& point);
+    void writeJunctions(qint64 now);
+};
+
+#endif // ORBITGEOMETRY_H
@@ -0,0 +1,124 @@
+#include "RingGeometry.h"
+#include <algorithm>
+
+RingGeometry::RingGeometry(QQuick3DObject *parent)
+    : QQuick3DGeometry(parent)
+    , m_uploadedFirst(0)
+    , m_uploadedLast(-1)
+    , m_uploadedGeneration(0)
+{
+}
+
+bool RingGeometry::segmentAt(const GridTrack& track, int slot, qint64& gridIndex)
+{
+    const int capacity = track.capacity();
+    const qint64 first = track.firstGridIndex();
+    const qint64 last = first + track.sampleCount() - 1;
+    gridIndex = first + ((slot - track.slotOf(first)) % capacity + capacity) % capacity;
+    return gridIndex < last && track.contains(gridIndex) && track.contains(gridIndex + 1);
+}
+
+bool RingGeometry::continuesUpload(const GridTrack& track) const
+{
+    const qint64 first = track.firstGridIndex();
+    const qint64 last = first + track.sampleCount() - 1;
+    const bool overlap = last >= first && m_uploadedLast >= m_uploadedFirst
+                         && first <= m_uploadedLast && last >= m_uploadedFirst;
+    return overlap && track.generation() == m_uploadedGeneration;
+}
+
+void RingGeometry::fillRing(const GridTrack& track, int vertexBytes, int segmentBytes,
+                            int extraVertexBlocks, int extraSegmentBlocks)
+{
+    const int capacity = track.capacity();
+    const qint64 first = track.firstGridIndex();
+    const qint64 last = first + track.sampleCount() - 1;
+
+    m_vertices.fill('\0', (capacity + extraVertexBlocks) * vertexBytes);
+    m_indices.fill('\0', (capacity + extraSegmentBlocks) * segmentBytes);
+    for (qint64 k = first; k <= last; ++k) {
+        if (track.contains(k)) {
+            writeVertices(track.slotOf(k));
+        }
+    }
+    for (int slot = 0; slot < capacity; ++slot) {
+        writeSegment(slot);
+    }
+
+    markUploaded(track);
+}
+
+int RingGeometry::uploadDelta(const GridTrack& track, int vertexBytes, int segmentBytes,
+                              QVector<int> vertexBlocks, QVector<int> segmentBlocks)
+{
+    const qint64 first = track.firstGridIndex();
+    const qint64 last = first + track.sampleCount() - 1;
+    const int givenVertices = vertexBlocks.size();
+    const int givenSegments = segmentBlocks.size();
+
+    // Entrés dans la fenêtre : sommets, segment sortant et segment entrant
+    for (qint64 k = first; k <= last; ++k) {
+        if (k < m_uploadedFirst || k > m_uploadedLast) {
+            if (track.contains(k)) {
+                vertexBlocks.append(track.slotOf(k));
+            }
+            segmentBlocks.append(track.slotOf(k));
+            segmentBlocks.append(track.slotOf(k - 1));
+        }
+    }
+
+    // Sortis : segments orphelins, redevenus dégénérés
+    for (qint64 k = m_uploadedFirst; k <= m_uploadedLast; ++k) {
+        if (k < first || k > last) {
+            segmentBlocks.append(track.slotOf(k));
+            segmentBlocks.append(track.slotOf(k - 1));
+        }
+    }
+
+    for (int i = givenVertices; i < vertexBlocks.size(); ++i) {
+        writeVertices(vertexBlocks[i]);
+    }
+    for (int i = givenSegments; i < segmentBlocks.size(); ++i) {
+        writeSegment(segmentBlocks[i]);
+    }
+
+    markUploaded(track);
+
+    return uploadRuns(vertexBlocks, m_vertices, vertexBytes, false)
+           + uploadRuns(segmentBlocks, m_indices, segmentBytes, true);
+}
+
+void RingGeometry::markUploaded(const GridTrack& track)
+{
+    m_uploadedFirst = track.firstGridIndex();
+    m_uploadedLast = m_uploadedFirst + track.sampleCount() - 1;
+    m_uploadedGeneration = track.generation();
+}
+
+int RingGeometry::uploadRuns(QVector<int>& blocks, const QByteArray& buffer, int blockBytes, bool indices)
+{
+    std::sort(blocks.begin(), blocks.end());
+    blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+
+    // Plages contiguës de blocs modifiés, une copie vers le GPU par plage
+    int sent = 0;
+    int i = 0;
+    while (i < blocks.size()) {
+        int end = i + 1;
+        while (end < blocks.size() && blocks[end] == blocks[end - 1] + 1) {
+            ++end;
+        }
+
+        const int offset = blocks[i] * blockBytes;
+        const int length = (end - i) * blockBytes;
+        if (indices) {
+            setIndexData(offset, QByteArray(buffer.constData() + offset, length));
+        } else {
+            setVertexData(offset, QByteArray(buffer.constData() + offset, length));
+        }
+        sent += length;
+        i = end;
+    }
+
+    return sent;
+}
@@ -0,0 +1,92 @@
+#ifndef RINGGEOMETRY_H
+#define RINGGEOMETRY_H
+
+#include <QQuick3DGeometry>
+#include <QByteArray>
+#include <QVector>
+#include "../orbit/GridTrack.h"
+
+/**
+ * @brief Base des géométries qui suivent le tampon circulaire d'une GridTrack
+ *
+ * Les tampons GPU ont un bloc de sommets et un bloc d'indices (le segment
+ * k → k+1) par case du tampon circulaire, éventuellement suivis de blocs
+ * propres à la géométrie. Ils gardent leur taille tant que la fenêtre de
+ * la trace n'est pas vidée. À chaque mise à jour, la fenêtre courante est
+ * comparée à celle des tampons envoyés : seuls les sommets des instants
+ * entrés et les segments qui touchent un instant entré ou sorti sont
+ * recalculés (writeVertices(), writeSegment()) et transmis par plages
+ * contiguës (setVertexData(offset, ...), setIndexData(offset, ...)).
+ *
+ * Un segment hors fenêtre ou touchant un échantillon invalide est
+ * dégénéré (indices confondus sur le sommet de sa case) : aucun trou dans
+ * le tampon.
+ */
+class RingGeometry : public QQuick3DGeometry
+{
+    Q_OBJECT
+
+public:
+    explicit RingGeometry(QQuick3DObject *parent = nullptr);
+
+protected:
+    // Copie des tampons envoyés au GPU
+    QByteArray m_vertices;
+    QByteArray m_indices;
+
+    /**
+     * @brief Écrit les sommets d'une case (instant valide de la fenêtre)
+     */
+    virtual void writeVertices(int slot) = 0;
+
+    /**
+     * @brief Écrit le segment d'une case, dégénéré si segmentAt() est faux
+     */
+    virtual void writeSegment(int slot) = 0;
+
+    /**
+     * @brief Instant de grille rangé dans une case pour la fenêtre courante
+     * @param gridIndex [out] Instant k de la case
+     * @return Vrai si le segment k → k+1 est dans la fenêtre et entre deux échantillons valides
+     */
+    static bool segmentAt(const GridTrack& track, int slot, qint64& gridIndex);
+
+    /**
+     * @brief Vrai si les tampons envoyés prolongent la fenêtre courante
+     *
+     * Faux après un vidage de la trace ou un saut sans recouvrement : les
+     * tampons sont alors à reprendre entièrement (fillRing()).
+     */
+    bool continuesUpload(const GridTrack& track) const;
+
+    /**
+     * @brief Remplit les tampons entiers (sommets à zéro hors fenêtre)
+     * @param extraVertexBlocks Blocs de sommets propres à la géométrie, après les cases
+     * @param extraSegmentBlocks Blocs d'indices propres à la géométrie, après les cases
+     */
+    void fillRing(const GridTrack& track, int vertexBytes, int segmentBytes,
+                  int extraVertexBlocks = 0, int extraSegmentBlocks = 0);
+
+    /**
+     * @brief Recalcule et envoie les cases modifiées depuis le dernier envoi
+     * @param vertexBlocks Blocs de sommets déjà écrits par l'appelant, à envoyer aussi
+     * @param segmentBlocks Blocs d'indices déjà écrits par l'appelant, à envoyer aussi
+     * @return Octets envoyés
+     */
+    int uploadDelta(const GridTrack& track, int vertexBytes, int segmentBytes,
+                    QVector<int> vertexBlocks = QVector<int>(), QVector<int> segmentBlocks = QVector<int>());
+
+    /**
+     * @brief Retient la fenêtre reflétée par les tampons envoyés
+     */
+    void markUploaded(const GridTrack& track);
+
+private:
+    qint64 m_uploadedFirst;
+    qint64 m_uploadedLast;
+    quint64 m_uploadedGeneration;
+
+    int uploadRuns(QVector<int>& blocks, const QByteArray& buffer, int blockBytes, bool indices);
+};
+
+#endif // RINGGEOMETRY_H
@@ -0,0 +1,407 @@
+#include "SatelliteCuller.h"
+#include "../profiling/Profiler.h"
+#include "../simulation/Frames.h"
+#include <QtMath>
+#include <QDebug>
+#include <cstring>
+
+const double DEFAULT_OCCLUDER_RADIUS = 150.0;
+
+// Cadence de propagation (temps réel) et pas maximal entre images clés :
+// Hermite sur 600 s en LEO, erreur de l'ordre de 4 km (~0,1 unité de scène)
+const double DEFAULT_PROPAGATION_RATE = 20.0;
+const double DEFAULT_MAX_KEYFRAME_STEP = 600.0;
+const double MIN_KEYFRAME_STEP = 1.0;
+
+// Caméra de main.qml au repos
+const double DEFAULT_FIELD_OF_VIEW = 45.0;
+const double DEFAULT_CLIP_NEAR = 1.0;
+const double DEFAULT_CLIP_FAR = 20000.0;
+
+// Modèle complet : #Cube de 100 unités × markerScale 0.01 (SatelliteInstancing)
+const double DEFAULT_MARKER_SIZE = 1.0;
+
+// Seuils de niveau de détail (pixels de la taille projetée du modèle)
+const double DEFAULT_MODEL_PIXEL_SIZE = 4.0;
+const double DEFAULT_MIN_PIXEL_SIZE = 0.1;
+const double DEFAULT_BILLBOARD_PIXEL_SIZE = 2.0;
+
+SatelliteCuller::SatelliteCuller(QObject *parent)
+    : QObject(parent)
+    , m_unitsPerKm(Frames::SCENE_UNITS_PER_KM)
+    , m_propagationRate(DEFAULT_PROPAGATION_RATE)
+    , m_maxKeyframeStep(DEFAULT_MAX_KEYFRAME_STEP)
+    , m_cameraPosition(0.0f, 0.0f, 1000.0f)
+    , m_cameraForward(0.0f, 0.0f, -1.0f)
+    , m_cameraUp(0.0f, 1.0f, 0.0f)
+    , m_cameraRight(1.0f, 0.0f, 0.0f)
+    , m_fieldOfView(DEFAULT_FIELD_OF_VIEW)
+    , m_tanHalfFov(qTan(qDegreesToRadians(DEFAULT_FIELD_OF_VIEW) * 0.5))
+    , m_aspectRatio(1.5)
+    , m_viewportHeight(800.0)
+    , m_clipNear(DEFAULT_CLIP_NEAR)
+    , m_clipFar(DEFAULT_CLIP_FAR)
+    , m_occluderRadius(DEFAULT_OCCLUDER_RADIUS)
+    , m_markerSize(DEFAULT_MARKER_SIZE)
+    , m_modelPixelSize(DEFAULT_MODEL_PIXEL_SIZE)
+    , m_minPixelSize(DEFAULT_MIN_PIXEL_SIZE)
+    , m_billboardPixelSize(DEFAULT_BILLBOARD_PIXEL_SIZE)
+    , m_cullPending(false)
+{
+    std::memset(m_counts, 0, sizeof(m_counts));
+    std::memset(m_illuminationCounts, 0, sizeof(m_illuminationCounts));
+    updateKeyframeStep();
+}
+
+void SatelliteCuller::setCatalog(BatchPropagator* catalog)
+{
+    if (m_catalog == catalog)
+        return;
+
+    m_catalog = catalog;
+    m_keyframes.setCatalog(catalog);
+    m_positionsKm.clear();
+    m_status.clear();
+    m_illumination.clear();
+    std::memset(m_illuminationCounts, 0, sizeof(m_illuminationCounts));
+    emit catalogChanged();
+
+    if (m_catalog && m_clock) {
+        propagateTo(m_clock->julianDate());
+    } else {
+        cull();
+    }
+}
+
+void SatelliteCuller::setScheduler(PropagationScheduler* scheduler)
+{
+    if (m_keyframes.scheduler() == scheduler)
+        return;
+
+    if (m_keyframes.scheduler()) {
+        disconnect(m_keyframes.scheduler(), nullptr, this, nullptr);
+    }
+
+    m_keyframes.setScheduler(scheduler);
+    if (scheduler) {
+        connect(scheduler, &PropagationScheduler::jobFinished, this,
+                [this](quint64 jobId, QSharedPointer<const PropagationResult> result) {
+                    m_keyframes.deliver(jobId, result);
+                });
+    }
+}
+
+void SatelliteCuller::setClock(SimulationClock* clock)
+{
+    if (m_clock == clock)
+        return;
+
+    if (m_clock) {
+        disconnect(m_clock, nullptr, this, nullptr);
+    }
+
+    m_clock = clock;
+    if (m_clock) {
+        connect(m_clock, &SimulationClock::frameAdvanced, this, &SatelliteCuller::propagateTo);
+        connect(m_clock, &SimulationClock::timeScaleChanged, this, &SatelliteCuller::updateKeyframeStep);
+    }
+
+    updateKeyframeStep();
+    emit clockChanged();
+
+    if (m_clock) {
+        propagateTo(m_clock->julianDate());
+    }
+}
+
+void SatelliteCuller::setUnitsPerKm(double unitsPerKm)
+{
+    if (qFuzzyCompare(m_unitsPerKm, unitsPerKm))
+        return;
+
+    m_unitsPerKm = unitsPerKm;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setPropagationRate(double hertz)
+{
+    if (qFuzzyCompare(m_propagationRate, hertz))
+        return;
+
+    m_propagationRate = qMax(hertz, 0.1);
+    updateKeyframeStep();
+}
+
+void SatelliteCuller::setMaxKeyframeStep(double seconds)
+{
+    if (qFuzzyCompare(m_maxKeyframeStep, seconds))
+        return;
+
+    m_maxKeyframeStep = qMax(seconds, MIN_KEYFRAME_STEP);
+    updateKeyframeStep();
+}
+
+void SatelliteCuller::updateKeyframeStep()
+{
+    // Cadence fixe en temps réel : l'intervalle simulé suit l'accélération
+    const double timeScale = m_clock ? m_clock->timeScale() : 1.0;
+    const double step = qBound(MIN_KEYFRAME_STEP, timeScale / m_propagationRate, m_maxKeyframeStep);
+
+    m_keyframes.setStepSeconds(step);
+    emit propagationChanged();
+}
+
+void SatelliteCuller::setCameraPosition(const QVector3D& position)
+{
+    if (m_cameraPosition == position)
+        return;
+
+    m_cameraPosition = position;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setCameraForward(const QVector3D& forward)
+{
+    if (m_cameraForward == forward)
+        return;
+
+    m_cameraForward = forward.normalized();
+    m_cameraRight = QVector3D::crossProduct(m_cameraForward, m_cameraUp).normalized();
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setCameraUp(const QVector3D& up)
+{
+    if (m_cameraUp == up)
+        return;
+
+    m_cameraUp = up.normalized();
+    m_cameraRight = QVector3D::crossProduct(m_cameraForward, m_cameraUp).normalized();
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setFieldOfView(double degrees)
+{
+    if (qFuzzyCompare(m_fieldOfView, degrees))
+        return;
+
+    m_fieldOfView = degrees;
+    m_tanHalfFov = qTan(qDegreesToRadians(degrees) * 0.5);
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setAspectRatio(double ratio)
+{
+    if (qFuzzyCompare(m_aspectRatio, ratio))
+        return;
+
+    m_aspectRatio = ratio;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setViewportHeight(double pixels)
+{
+    if (qFuzzyCompare(m_viewportHeight, pixels))
+        return;
+
+    m_viewportHeight = pixels;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setClipNear(double distance)
+{
+    if (qFuzzyCompare(m_clipNear, distance))
+        return;
+
+    m_clipNear = distance;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setClipFar(double distance)
+{
+    if (qFuzzyCompare(m_clipFar, distance))
+        return;
+
+    m_clipFar = distance;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setOccluderRadius(double radius)
+{
+    if (qFuzzyCompare(m_occluderRadius, radius))
+        return;
+
+    m_occluderRadius = radius;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setMarkerSize(double size)
+{
+    if (qFuzzyCompare(m_markerSize, size))
+        return;
+
+    m_markerSize = size;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setModelPixelSize(double pixels)
+{
+    if (qFuzzyCompare(m_modelPixelSize, pixels))
+        return;
+
+    m_modelPixelSize = pixels;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setMinPixelSize(double pixels)
+{
+    if (qFuzzyCompare(m_minPixelSize, pixels))
+        return;
+
+    m_minPixelSize = pixels;
+    emit viewChanged();
+    scheduleCull();
+}
+
+void SatelliteCuller::setBillboardPixelSize(double pixels)
+{
+    if (qFuzzyCompare(m_billboardPixelSize, pixels))
+        return;
+
+    m_billboardPixelSize = pixels;
+    emit viewChanged();
+    scheduleCull();
+}
+
+bool SatelliteCuller::propagateTo(double julianDate)
+{
+    if (!m_catalog) {
+        return false;
+    }
+
+    m_positionsKm.resize(3 * m_catalog->size());
+    m_status.resize(m_catalog->size());
+    {
+        ORBI_PROFILE_SCOPE("Propagation du catalogue", Profiler::Propagation);
+        const qint64 before = m_keyframes.propagationCount();
+        m_keyframes.evaluate(julianDate, m_positionsKm.data(), m_status.data());
+        ORBI_PROFILE_COUNT(Profiler::Propagations, m_keyframes.propagationCount() - before);
+        ORBI_PROFILE_COUNT(Profiler::PropagatedObjects,
+                           (m_keyframes.propagationCount() - before) * m_catalog->size());
+    }
+    classifyIllumination(julianDate);
+    cull();
+    return true;
+}
+
+void SatelliteCuller::classifyIllumination(double julianDate)
+{
+    const int count = m_status.size();
+    double sun[3];
+    Sunlight::sunPositionKm(julianDate, sun);
+
+    m_illumination.resize(count);
+    Sunlight::classify(m_positionsKm.constData(), count, sun, m_illumination.data());
+
+    std::memset(m_illuminationCounts, 0, sizeof(m_illuminationCounts));
+    for (int i = 0; i < count; ++i) {
+        if (m_status[i] == SGP4Status::Ok) {
+            ++m_illuminationCounts[m_illumination[i]];
+        }
+    }
+}
+
+float SatelliteCuller::billboardWorldSize(float depth) const
+{
+    return float(m_billboardPixelSize * depth * 2.0 * m_tanHalfFov / m_viewportHeight);
+}
+
+SatelliteCuller::Lod SatelliteCuller::classify(const QVector3D& scenePosition, bool testOcclusion) const
+{
+    const QVector3D v = scenePosition - m_cameraPosition;
+    const double margin = m_markerSize;
+
+    // === Frustum : profondeur puis bords de l'écran, avec une marge d'un marqueur ===
+    const double depth = QVector3D::dotProduct(v, m_cameraForward);
+    // (comparaison inversée : une position NaN est rejetée ici)
+    if (!(depth >= m_clipNear - margin && depth <= m_clipFar + margin)) {
+        return OutsideFrustum;
+    }
+
+    const double halfHeight = depth * m_tanHalfFov + margin;
+    if (qAbs(QVector3D::dotProduct(v, m_cameraUp)) > halfHeight
+        || qAbs(QVector3D::dotProduct(v, m_cameraRight)) > halfHeight * m_aspectRatio) {
+        return OutsideFrustum;
+    }
+
+    // === Occultation : le segment caméra -> objet traverse-t-il la Terre ? ===
+    if (testOcclusion) {
+        const double r2 = m_occluderRadius * m_occluderRadius;
+        if (scenePosition.lengthSquared() < r2) {
+            return Occluded;
+        }
+
+        const double t = -QVector3D::dotProduct(m_cameraPosition, v) / v.lengthSquared();
+        if (t > 0.0 && t < 1.0 && (m_cameraPosition + float(t) * v).lengthSquared() < r2) {
+            return Occluded;
+        }
+    }
+
+    // === Niveau de détail selon la taille projetée ===
+    const double pixels = m_markerSize * m_viewportHeight / (2.0 * m_tanHalfFov * qMax(depth, m_clipNear));
+    if (pixels >= m_modelPixelSize) {
+        return Model;
+    }
+    return pixels >= m_minPixelSize ? Billboard : Skipped;
+}
+
+void SatelliteCuller::cull()
+{
+    ORBI_PROFILE_SCOPE("Culling du catalogue", Profiler::Culling);
+    m_cullPending = false;
+
+    const int count = m_positionsKm.size() / 3;
+    const float* positions = m_positionsKm.constData();
+    const quint8* status = (m_status.size() == count) ? m_status.constData() : nullptr;
+
+    m_lods.resize(count);
+    m_depths.resize(count);
+    std::memset(m_counts, 0, sizeof(m_counts));
+
+    const float scale = float(m_unitsPerKm);
+    for (int i = 0; i < count; ++i) {
+        const float* p = positions + 3 * i;
+        const QVector3D scenePosition(p[0] * scale, p[1] * scale, p[2] * scale);
+
+        const Lod lod = (status && status[i] != SGP4Status::Ok) ? Invalid : classify(scenePosition);
+        m_lods[i] = quint8(lod);
+        m_depths[i] = QVector3D::dotProduct(scenePosition - m_cameraPosition, m_cameraForward);
+        ++m_counts[lod];
+    }
+
+    ORBI_PROFILE_COUNT(Profiler::CulledObjects,
+                       m_counts[OutsideFrustum] + m_counts[Occluded] + m_counts[Skipped]);
+    emit culled();
+}
+
+void SatelliteCuller::scheduleCull()
+{
+    // Plusieurs liaisons de caméra changent ensemble : un seul classement
+    if (m_cullPending)
+        return;
+
+    m_cullPending = true;
+    QMetaObject::invokeMethod(this, &SatelliteCuller::cull, Qt::QueuedConnection);
+}
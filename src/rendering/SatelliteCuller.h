@@ -0,0 +1,238 @@
+#ifndef SATELLITECULLER_H
+#define SATELLITECULLER_H
+
+#include <QObject>
+#include <QVector>
+#include <QVector3D>
+#include <QPointer>
+#include "../propagation/BatchPropagator.h"
+#include "../propagation/CatalogKeyframes.h"
+#include "../simulation/SimulationClock.h"
+#include "../simulation/Sunlight.h"
+
+/**
+ * @brief Étage de culling entre la propagation du catalogue et le rendu
+ *
+ * À chaque image publiée par l'horloge, les positions du catalogue sont
+ * obtenues en un lot (CatalogKeyframes : propagation à cadence fixe,
+ * interpolation entre deux images clés) puis chaque satellite est classé :
+ *  - hors du frustum de la caméra (plans proche/lointain et bords de l'écran) ;
+ *  - caché par la Terre (sphère occultante centrée à l'origine) ;
+ *  - sinon, niveau de détail selon sa taille projetée à l'écran :
+ *    modèle complet, point (billboard de taille constante) ou ignoré.
+ *
+ * La cadence de propagation est fixée en temps réel (propagationRate) :
+ * l'intervalle entre images clés, en temps simulé, croît avec
+ * l'accélération de l'horloge, jusqu'à maxKeyframeStep.
+ *
+ * Les tables d'instances (SatelliteInstancing.culler) ne reçoivent que les
+ * satellites de leur niveau ; les traces (OrbitTrack.culler) ne sont pas
+ * générées pour un objet hors champ ou ignoré. Un mouvement de caméra
+ * relance le classement, sans repropager, une fois par tour de boucle.
+ *
+ * Chaque lot propagé est aussi classé selon l'éclairement (Soleil, pénombre,
+ * ombre de la Terre) en un passage sur le tampon de positions : couleurs
+ * d'instance (SatelliteInstancing.ColorByIllumination) et compteurs.
+ *
+ * Positions de la scène : repère TEME mis à l'échelle (unitsPerKm).
+ */
+class SatelliteCuller : public QObject
+{
+    Q_OBJECT
+
+    // Sources
+    Q_PROPERTY(BatchPropagator* catalog READ catalog WRITE setCatalog NOTIFY catalogChanged)
+    Q_PROPERTY(SimulationClock* clock READ clock WRITE setClock NOTIFY clockChanged)
+    Q_PROPERTY(double unitsPerKm READ unitsPerKm WRITE setUnitsPerKm NOTIFY viewChanged)
+    Q_PROPERTY(double propagationRate READ propagationRate WRITE setPropagationRate NOTIFY propagationChanged)
+    Q_PROPERTY(double maxKeyframeStep READ maxKeyframeStep WRITE setMaxKeyframeStep NOTIFY propagationChanged)
+    Q_PROPERTY(double keyframeStep READ keyframeStep NOTIFY propagationChanged)
+
+    // Caméra (liée depuis QML : scenePosition, forward, up de la PerspectiveCamera)
+    Q_PROPERTY(QVector3D cameraPosition READ cameraPosition WRITE setCameraPosition NOTIFY viewChanged)
+    Q_PROPERTY(QVector3D cameraForward READ cameraForward WRITE setCameraForward NOTIFY viewChanged)
+    Q_PROPERTY(QVector3D cameraUp READ cameraUp WRITE setCameraUp NOTIFY viewChanged)
+    Q_PROPERTY(double fieldOfView READ fieldOfView WRITE setFieldOfView NOTIFY viewChanged)
+    Q_PROPERTY(double aspectRatio READ aspectRatio WRITE setAspectRatio NOTIFY viewChanged)
+    Q_PROPERTY(double viewportHeight READ viewportHeight WRITE setViewportHeight NOTIFY viewChanged)
+    Q_PROPERTY(double clipNear READ clipNear WRITE setClipNear NOTIFY viewChanged)
+    Q_PROPERTY(double clipFar READ clipFar WRITE setClipFar NOTIFY viewChanged)
+
+    // Occultation et seuils de niveau de détail
+    Q_PROPERTY(double occluderRadius READ occluderRadius WRITE setOccluderRadius NOTIFY viewChanged)
+    Q_PROPERTY(double markerSize READ markerSize WRITE setMarkerSize NOTIFY viewChanged)
+    Q_PROPERTY(double modelPixelSize READ modelPixelSize WRITE setModelPixelSize NOTIFY viewChanged)
+    Q_PROPERTY(double minPixelSize READ minPixelSize WRITE setMinPixelSize NOTIFY viewChanged)
+    Q_PROPERTY(double billboardPixelSize READ billboardPixelSize WRITE setBillboardPixelSize NOTIFY viewChanged)
+
+    // Compteurs du dernier classement (profilage)
+    Q_PROPERTY(int totalCount READ totalCount NOTIFY culled)
+    Q_PROPERTY(int frustumCulledCount READ frustumCulledCount NOTIFY culled)
+    Q_PROPERTY(int occludedCount READ occludedCount NOTIFY culled)
+    Q_PROPERTY(int skippedCount READ skippedCount NOTIFY culled)
+    Q_PROPERTY(int modelCount READ modelCount NOTIFY culled)
+    Q_PROPERTY(int billboardCount READ billboardCount NOTIFY culled)
+    Q_PROPERTY(int drawnCount READ drawnCount NOTIFY culled)
+    Q_PROPERTY(qint64 propagationCount READ propagationCount NOTIFY culled)
+    Q_PROPERTY(int sunlitCount READ sunlitCount NOTIFY culled)
+    Q_PROPERTY(int penumbraCount READ penumbraCount NOTIFY culled)
+    Q_PROPERTY(int umbraCount READ umbraCount NOTIFY culled)
+
+public:
+    /**
+     * @brief Résultat du classement d'un objet
+     */
+    enum Lod {
+        Model = 0,          // Modèle complet
+        Billboard,          // Point de taille constante face à la caméra
+        Skipped,            // Trop petit à l'écran
+        OutsideFrustum,     // Hors du champ de la caméra
+        Occluded,           // Derrière la Terre
+        Invalid             // Échec de propagation
+    };
+    Q_ENUM(Lod)
+
+    explicit SatelliteCuller(QObject *parent = nullptr);
+
+    // Getters
+    BatchPropagator* catalog() const { return m_catalog; }
+    SimulationClock* clock() const { return m_clock; }
+    double unitsPerKm() const { return m_unitsPerKm; }
+    double propagationRate() const { return m_propagationRate; }
+    double maxKeyframeStep() const { return m_maxKeyframeStep; }
+    double keyframeStep() const { return m_keyframes.stepSeconds(); }
+    QVector3D cameraPosition() const { return m_cameraPosition; }
+    QVector3D cameraForward() const { return m_cameraForward; }
+    QVector3D cameraUp() const { return m_cameraUp; }
+    double fieldOfView() const { return m_fieldOfView; }
+    double aspectRatio() const { return m_aspectRatio; }
+    double viewportHeight() const { return m_viewportHeight; }
+    double clipNear() const { return m_clipNear; }
+    double clipFar() const { return m_clipFar; }
+    double occluderRadius() const { return m_occluderRadius; }
+    double markerSize() const { return m_markerSize; }
+    double modelPixelSize() const { return m_modelPixelSize; }
+    double minPixelSize() const { return m_minPixelSize; }
+    double billboardPixelSize() const { return m_billboardPixelSize; }
+
+    int totalCount() const { return m_lods.size(); }
+    int frustumCulledCount() const { return m_counts[OutsideFrustum]; }
+    int occludedCount() const { return m_counts[Occluded]; }
+    int skippedCount() const { return m_counts[Skipped]; }
+    int modelCount() const { return m_counts[Model]; }
+    int billboardCount() const { return m_counts[Billboard]; }
+    int drawnCount() const { return m_counts[Model] + m_counts[Billboard]; }
+    qint64 propagationCount() const { return m_keyframes.propagationCount(); }
+    int sunlitCount() const { return m_illuminationCounts[Illumination::Sunlit]; }
+    int penumbraCount() const { return m_illuminationCounts[Illumination::Penumbra]; }
+    int umbraCount() const { return m_illuminationCounts[Illumination::Umbra]; }
+
+    /**
+     * @brief Ordonnanceur pour propager l'image clé suivante en arrière-plan
+     * (catalogue détenu par QSharedPointer uniquement, voir CatalogKeyframes)
+     */
+    void setScheduler(PropagationScheduler* scheduler);
+    PropagationScheduler* scheduler() const { return m_keyframes.scheduler(); }
+
+    // Setters
+    void setCatalog(BatchPropagator* catalog);
+    void setClock(SimulationClock* clock);
+    void setUnitsPerKm(double unitsPerKm);
+    void setPropagationRate(double hertz);
+    void setMaxKeyframeStep(double seconds);
+    void setCameraPosition(const QVector3D& position);
+    void setCameraForward(const QVector3D& forward);
+    void setCameraUp(const QVector3D& up);
+    void setFieldOfView(double degrees);
+    void setAspectRatio(double ratio);
+    void setViewportHeight(double pixels);
+    void setClipNear(double distance);
+    void setClipFar(double distance);
+    void setOccluderRadius(double radius);
+    void setMarkerSize(double size);
+    void setModelPixelSize(double pixels);
+    void setMinPixelSize(double pixels);
+    void setBillboardPixelSize(double pixels);
+
+    /**
+     * @brief Positions du catalogue à l'instant donné (images clés) puis classement
+     * @return false si aucun catalogue n'est défini
+     */
+    Q_INVOKABLE bool propagateTo(double julianDate);
+
+    /**
+     * @brief Classe un objet isolé
+     * @param scenePosition Position dans la scène (unités de la scène)
+     * @param testOcclusion false pour ignorer la sphère occultante
+     */
+    Lod classify(const QVector3D& scenePosition, bool testOcclusion = true) const;
+
+    /**
+     * @brief Données du dernier lot (une entrée par satellite du catalogue)
+     */
+    const QVector<float>& positionsKm() const { return m_positionsKm; }
+    const QVector<quint8>& status() const { return m_status; }
+    const QVector<quint8>& lods() const { return m_lods; }
+    const QVector<float>& depths() const { return m_depths; }
+    const QVector<quint8>& illumination() const { return m_illumination; }   // Illumination::Code
+
+    /**
+     * @brief Taille dans la scène d'un objet de billboardPixelSize pixels à la profondeur donnée
+     */
+    float billboardWorldSize(float depth) const;
+
+    QVector3D cameraRight() const { return m_cameraRight; }
+
+signals:
+    void catalogChanged();
+    void clockChanged();
+    void viewChanged();
+    void propagationChanged();
+    void culled();
+
+private:
+    QPointer<BatchPropagator> m_catalog;
+    QPointer<SimulationClock> m_clock;
+    double m_unitsPerKm;
+
+    CatalogKeyframes m_keyframes;
+    double m_propagationRate;       // Images clés par seconde de temps réel
+    double m_maxKeyframeStep;       // Borne de l'erreur d'interpolation (s simulées)
+
+    QVector3D m_cameraPosition;
+    QVector3D m_cameraForward;
+    QVector3D m_cameraUp;
+    QVector3D m_cameraRight;
+    double m_fieldOfView;           // Vertical, en degrés
+    double m_tanHalfFov;
+    double m_aspectRatio;
+    double m_viewportHeight;
+    double m_clipNear;
+    double m_clipFar;
+
+    double m_occluderRadius;
+    double m_markerSize;            // Taille du modèle complet dans la scène
+    double m_modelPixelSize;        // Au-dessus : modèle complet
+    double m_minPixelSize;          // En dessous : ignoré
+    double m_billboardPixelSize;
+
+    // Dernier lot propagé et son classement
+    QVector<float> m_positionsKm;
+    QVector<quint8> m_status;
+    QVector<quint8> m_lods;
+    QVector<float> m_depths;        // Profondeur caméra (unités de la scène)
+    int m_counts[Invalid + 1];
+
+    // Éclairement du dernier lot (satellites propagés avec succès)
+    QVector<quint8> m_illumination;
+    int m_illuminationCounts[Illumination::CodeCount];
+
+    bool m_cullPending;
+
+    void cull();
+    void classifyIllumination(double julianDate);
+    void scheduleCull();
+    void updateKeyframeStep();
+};
+
+#endif // SATELLITECULLER_H
@@ -0,0 +1,354 @@
+#include "SatelliteInstancing.h"
+#include "../simulation/Frames.h"
+#include <QDebug>
+#include <cmath>
+#include <cstring>
+
+// Primitives intégrées (#Cube, #Rectangle) : 100 unités de côté
+const float PRIMITIVE_SIZE = 100.0f;
+
+// Marqueur de 1 unité environ
+const float DEFAULT_MARKER_SCALE = 1.0f / PRIMITIVE_SIZE;
+
+// Dégradé d'altitude : échelle logarithmique de 150 km à 50 000 km
+const float EARTH_RADIUS_KM = 6371.0f;
+const float ALTITUDE_LOG_MIN = 2.176f;     // log10(150)
+const float ALTITUDE_LOG_MAX = 4.699f;     // log10(50000)
+const int ALTITUDE_COLOR_STEPS = 256;
+
+// Palette des catégories (régimes orbitaux dans l'ordre d'OrbitRegime::Code)
+const QVector4D CATEGORY_PALETTE[] = {
+    QVector4D(0.30f, 0.75f, 1.00f, 1.0f),   // LEO : bleu clair
+    QVector4D(0.40f, 1.00f, 0.45f, 1.0f),   // MEO : vert
+    QVector4D(1.00f, 0.65f, 0.20f, 1.0f),   // GEO : orange
+    QVector4D(1.00f, 0.35f, 0.85f, 1.0f),   // HEO : magenta
+    QVector4D(1.00f, 1.00f, 0.40f, 1.0f),
+    QVector4D(0.65f, 0.50f, 1.00f, 1.0f),
+    QVector4D(1.00f, 0.40f, 0.40f, 1.0f),
+    QVector4D(0.85f, 0.85f, 0.85f, 1.0f),
+};
+const int CATEGORY_PALETTE_SIZE = sizeof(CATEGORY_PALETTE) / sizeof(CATEGORY_PALETTE[0]);
+
+// Éclairement, dans l'ordre d'Illumination::Code
+const QVector4D ILLUMINATION_PALETTE[Illumination::CodeCount] = {
+    QVector4D(1.00f, 0.95f, 0.60f, 1.0f),   // Éclairé : jaune pâle
+    QVector4D(1.00f, 0.50f, 0.20f, 1.0f),   // Pénombre : orange
+    QVector4D(0.25f, 0.30f, 0.60f, 1.0f),   // Ombre : bleu sombre
+};
+
+SatelliteInstancing::SatelliteInstancing(QQuick3DObject *parent)
+    : QQuick3DInstancing(parent)
+    , m_lod(SatelliteCuller::Model)
+    , m_colorMode(ColorByAltitude)
+    , m_markerScale(DEFAULT_MARKER_SCALE)
+    , m_unitsPerKm(float(Frames::SCENE_UNITS_PER_KM))
+    , m_visibleCount(0)
+{
+    buildAltitudeColors();
+}
+
+void SatelliteInstancing::setCatalog(BatchPropagator* catalog)
+{
+    if (m_catalog == catalog)
+        return;
+
+    m_catalog = catalog;
+    m_positionsKm.clear();
+    m_status.clear();
+    emit catalogChanged();
+
+    if (m_catalog && m_clock) {
+        propagateTo(m_clock->julianDate());
+    } else {
+        refresh();
+    }
+}
+
+void SatelliteInstancing::setClock(SimulationClock* clock)
+{
+    if (m_clock == clock)
+        return;
+
+    if (m_clock) {
+        disconnect(m_clock, nullptr, this, nullptr);
+    }
+
+    m_clock = clock;
+    if (m_clock) {
+        connect(m_clock, &SimulationClock::frameAdvanced, this, &SatelliteInstancing::propagateTo);
+        propagateTo(m_clock->julianDate());
+    }
+
+    emit clockChanged();
+}
+
+void SatelliteInstancing::setCuller(SatelliteCuller* culler)
+{
+    if (m_culler == culler)
+        return;
+
+    if (m_culler) {
+        disconnect(m_culler, nullptr, this, nullptr);
+    }
+
+    m_culler = culler;
+    if (m_culler) {
+        connect(m_culler, &SatelliteCuller::culled, this, &SatelliteInstancing::refresh);
+    }
+
+    emit cullerChanged();
+    refresh();
+}
+
+void SatelliteInstancing::setLod(SatelliteCuller::Lod lod)
+{
+    if (m_lod == lod)
+        return;
+
+    m_lod = lod;
+    emit lodChanged();
+    refresh();
+}
+
+void SatelliteInstancing::setColorMode(ColorMode mode)
+{
+    if (m_colorMode == mode)
+        return;
+
+    m_colorMode = mode;
+    emit colorModeChanged();
+    refresh();
+}
+
+void SatelliteInstancing::setMarkerScale(float scale)
+{
+    if (qFuzzyCompare(m_markerScale, scale))
+        return;
+
+    m_markerScale = scale;
+    emit markerScaleChanged();
+    refresh();
+}
+
+void SatelliteInstancing::setUnitsPerKm(float unitsPerKm)
+{
+    if (qFuzzyCompare(m_unitsPerKm, unitsPerKm))
+        return;
+
+    m_unitsPerKm = unitsPerKm;
+    emit unitsPerKmChanged();
+    refresh();
+}
+
+void SatelliteInstancing::setCategories(const QVector<quint8>& categories)
+{
+    m_categories = categories;
+    if (m_colorMode == ColorByCategory) {
+        refresh();
+    }
+}
+
+bool SatelliteInstancing::propagateTo(double julianDate)
+{
+    if (!m_catalog) {
+        return false;
+    }
+
+    const int count = m_catalog->size();
+    m_positionsKm.resize(3 * count);
+    m_catalog->propagate(julianDate, m_positionsKm.data());
+    m_status = m_catalog->status();
+
+    double sun[3];
+    Sunlight::sunPositionKm(julianDate, sun);
+    m_illumination.resize(count);
+    Sunlight::classify(m_positionsKm.constData(), count, sun, m_illumination.data());
+
+    refresh();
+    return true;
+}
+
+void SatelliteInstancing::setPositions(const float* positionsKm, int count, const quint8* status)
+{
+    m_positionsKm.resize(3 * count);
+    std::memcpy(m_positionsKm.data(), positionsKm, sizeof(float) * 3 * count);
+    m_illumination.clear();
+
+    if (status) {
+        m_status.resize(count);
+        std::memcpy(m_status.data(), status, count);
+    } else {
+        m_status.clear();
+    }
+
+    refresh();
+}
+
+void SatelliteInstancing::refresh()
+{
+    if (m_culler) {
+        refreshFromCuller();
+        return;
+    }
+
+    const int count = m_positionsKm.size() / 3;
+    const float* positions = m_positionsKm.constData();
+    const quint8* status = m_status.size() == count ? m_status.constData() : nullptr;
+    const quint8* illumination = m_illumination.size() == count ? m_illumination.constData() : nullptr;
+
+    // Tampon réutilisé d'une image à l'autre : QByteArray garde sa capacité
+    // quand il rétrécit, pas de réallocation en régime établi
+    const int entrySize = int(sizeof(QQuick3DInstancing::InstanceTableEntry));
+    m_instanceData.resize(count * entrySize);
+    auto* entries = reinterpret_cast<QQuick3DInstancing::InstanceTableEntry*>(m_instanceData.data());
+
+    const float scale = m_markerScale;
+    int visible = 0;
+
+    for (int i = 0; i < count; ++i) {
+        if (status && status[i] != SGP4Status::Ok) {
+            continue;
+        }
+
+        const float* p = positions + 3 * i;
+
+        // Matrice 3×4 écrite directement : échelle uniforme + translation, sans rotation
+        QQuick3DInstancing::InstanceTableEntry& entry = entries[visible++];
+        entry.row0 = QVector4D(scale, 0.0f, 0.0f, p[0] * m_unitsPerKm);
+        entry.row1 = QVector4D(0.0f, scale, 0.0f, p[1] * m_unitsPerKm);
+        entry.row2 = QVector4D(0.0f, 0.0f, scale, p[2] * m_unitsPerKm);
+        entry.color = instanceColor(i, p, illumination);
+        entry.instanceData = QVector4D(float(i), 0.0f, 0.0f, 0.0f);   // Indice catalogue (picking)
+    }
+
+    m_instanceData.resize(visible * entrySize);
+
+    if (visible != m_visibleCount) {
+        m_visibleCount = visible;
+        emit visibleCountChanged();
+    }
+
+    markDirty();
+}
+
+void SatelliteInstancing::refreshFromCuller()
+{
+    const QVector<quint8>& lods = m_culler->lods();
+    const QVector<float>& depths = m_culler->depths();
+    const float* positions = m_culler->positionsKm().constData();
+    const int count = lods.size();
+    const quint8* illumination = m_culler->illumination().size() == count
+                                     ? m_culler->illumination().constData() : nullptr;
+
+    const int entrySize = int(sizeof(QQuick3DInstancing::InstanceTableEntry));
+    m_instanceData.resize(count * entrySize);
+    auto* entries = reinterpret_cast<QQuick3DInstancing::InstanceTableEntry*>(m_instanceData.data());
+
+    // Repère du billboard : axes écran de la caméra, normale vers la caméra
+    const QVector3D right = m_culler->cameraRight();
+    const QVector3D up = m_culler->cameraUp();
+    const QVector3D normal = -m_culler->cameraForward();
+    const bool billboard = (m_lod == SatelliteCuller::Billboard);
+
+    int visible = 0;
+    for (int i = 0; i < count; ++i) {
+        if (lods[i] != m_lod) {
+            continue;
+        }
+
+        const float* p = positions + 3 * i;
+        const float x = p[0] * m_unitsPerKm;
+        const float y = p[1] * m_unitsPerKm;
+        const float z = p[2] * m_unitsPerKm;
+
+        QQuick3DInstancing::InstanceTableEntry& entry = entries[visible++];
+        if (billboard) {
+            const float s = m_culler->billboardWorldSize(depths[i]) / PRIMITIVE_SIZE;
+            entry.row0 = QVector4D(right.x() * s, up.x() * s, normal.x() * s, x);
+            entry.row1 = QVector4D(right.y() * s, up.y() * s, normal.y() * s, y);
+            entry.row2 = QVector4D(right.z() * s, up.z() * s, normal.z() * s, z);
+        } else {
+            entry.row0 = QVector4D(m_markerScale, 0.0f, 0.0f, x);
+            entry.row1 = QVector4D(0.0f, m_markerScale, 0.0f, y);
+            entry.row2 = QVector4D(0.0f, 0.0f, m_markerScale, z);
+        }
+        entry.color = instanceColor(i, p, illumination);
+        entry.instanceData = QVector4D(float(i), 0.0f, 0.0f, 0.0f);
+    }
+
+    m_instanceData.resize(visible * entrySize);
+
+    if (visible != m_visibleCount) {
+        m_visibleCount = visible;
+        emit visibleCountChanged();
+    }
+
+    markDirty();
+}
+
+QByteArray SatelliteInstancing::getInstanceBuffer(int *instanceCount)
+{
+    if (instanceCount) {
+        *instanceCount = m_visibleCount;
+    }
+    return m_instanceData;
+}
+
+void SatelliteInstancing::buildAltitudeColors()
+{
+    // Points de passage du dégradé, en fraction de l'échelle logarithmique
+    struct Stop { float at; QVector4D color; };
+    const Stop stops[] = {
+        { 0.00f, QVector4D(0.20f, 0.45f, 1.00f, 1.0f) },     // 150 km
+        { 0.45f, QVector4D(0.30f, 0.95f, 1.00f, 1.0f) },     // ~2000 km (limite LEO)
+        { 0.75f, QVector4D(0.45f, 1.00f, 0.40f, 1.0f) },     // ~10 000 km (MEO)
+        { 0.93f, QVector4D(1.00f, 0.85f, 0.25f, 1.0f) },     // ~30 000 km
+        { 1.00f, QVector4D(1.00f, 0.30f, 0.25f, 1.0f) },     // GEO et au-delà
+    };
+    const int stopCount = sizeof(stops) / sizeof(stops[0]);
+
+    m_altitudeColors.resize(ALTITUDE_COLOR_STEPS);
+    int stop = 0;
+    for (int k = 0; k < ALTITUDE_COLOR_STEPS; ++k) {
+        const float t = float(k) / (ALTITUDE_COLOR_STEPS - 1);
+        while (stop + 2 < stopCount && t > stops[stop + 1].at) {
+            ++stop;
+        }
+        const float u = qBound(0.0f, (t - stops[stop].at) / (stops[stop + 1].at - stops[stop].at), 1.0f);
+        m_altitudeColors[k] = stops[stop].color * (1.0f - u) + stops[stop + 1].color * u;
+    }
+}
+
+QVector4D SatelliteInstancing::altitudeColor(float radiusKm) const
+{
+    const float altitude = qMax(radiusKm - EARTH_RADIUS_KM, 1.0f);
+    const float t = (std::log10(altitude) - ALTITUDE_LOG_MIN) / (ALTITUDE_LOG_MAX - ALTITUDE_LOG_MIN);
+    const int k = qBound(0, int(t * (ALTITUDE_COLOR_STEPS - 1) + 0.5f), ALTITUDE_COLOR_STEPS - 1);
+    return m_altitudeColors[k];
+}
+
+QVector4D SatelliteInstancing::categoryColor(int satellite) const
+{
+    const BatchPropagator* catalog = m_culler ? m_culler->catalog() : m_catalog.data();
+
+    int category = 0;
+    if (satellite < m_categories.size()) {
+        category = m_categories[satellite];
+    } else if (catalog && satellite < catalog->orbitRegimes().size()) {
+        category = catalog->orbitRegimes()[satellite];
+    }
+    return CATEGORY_PALETTE[category % CATEGORY_PALETTE_SIZE];
+}
+
+QVector4D SatelliteInstancing::instanceColor(int satellite, const float* positionKm, const quint8* illumination) const
+{
+    if (m_colorMode == ColorByCategory) {
+        return categoryColor(satellite);
+    }
+    // Éclairement inconnu (positions reçues sans instant) : couleur d'altitude
+    if (m_colorMode == ColorByIllumination && illumination) {
+        return ILLUMINATION_PALETTE[illumination[satellite]];
+    }
+    return altitudeColor(std::sqrt(positionKm[0] * positionKm[0] + positionKm[1] * positionKm[1]
+                                   + positionKm[2] * positionKm[2]));
+}
@@ -0,0 +1,142 @@
+#ifndef SATELLITEINSTANCING_H
+#define SATELLITEINSTANCING_H
+
+#include <QQuick3DInstancing>
+#include <QVector>
+#include <QVector4D>
+#include <QByteArray>
+#include <QPointer>
+#include "../propagation/BatchPropagator.h"
+#include "../simulation/SimulationClock.h"
+#include "SatelliteCuller.h"
+
+/**
+ * @brief Table d'instances Qt Quick 3D pour tout le catalogue
+ *
+ * Chaque satellite est une instance du même Model (un seul appel de
+ * dessin instancié) : aucun objet QML par satellite. La table est remplie
+ * directement depuis un tampon de positions (km, x y z par satellite) tel
+ * que produit par BatchPropagator ; seules les données d'instance sont
+ * réécrites à chaque image, dans un tampon réutilisé.
+ *
+ * Avec une horloge (propriété clock), le catalogue est propagé une fois
+ * par image publiée, sans appel depuis QML. Avec un étage de culling
+ * (propriété culler), la table reprend le lot du culler et ne contient que
+ * les satellites du niveau de détail lod : Model (modèle orienté comme la
+ * scène) ou Billboard (face à la caméra, taille constante à l'écran).
+ *
+ * Les satellites en échec de propagation ne sont pas dessinés. La couleur
+ * d'instance code l'altitude, la catégorie (par défaut le régime orbital
+ * du catalogue) ou l'éclairement (Soleil, pénombre, ombre de la Terre).
+ */
+class SatelliteInstancing : public QQuick3DInstancing
+{
+    Q_OBJECT
+
+    // Propriétés exposées à QML
+    Q_PROPERTY(BatchPropagator* catalog READ catalog WRITE setCatalog NOTIFY catalogChanged)
+    Q_PROPERTY(SimulationClock* clock READ clock WRITE setClock NOTIFY clockChanged)
+    Q_PROPERTY(SatelliteCuller* culler READ culler WRITE setCuller NOTIFY cullerChanged)
+    Q_PROPERTY(SatelliteCuller::Lod lod READ lod WRITE setLod NOTIFY lodChanged)
+    Q_PROPERTY(ColorMode colorMode READ colorMode WRITE setColorMode NOTIFY colorModeChanged)
+    Q_PROPERTY(float markerScale READ markerScale WRITE setMarkerScale NOTIFY markerScaleChanged)
+    Q_PROPERTY(float unitsPerKm READ unitsPerKm WRITE setUnitsPerKm NOTIFY unitsPerKmChanged)
+    Q_PROPERTY(int visibleCount READ visibleCount NOTIFY visibleCountChanged)
+
+public:
+    /**
+     * @brief Information codée par la couleur d'instance
+     */
+    enum ColorMode {
+        ColorByAltitude = 0,    // Dégradé bleu (LEO) -> rouge (GEO et au-delà)
+        ColorByCategory,        // Palette indexée par catégorie
+        ColorByIllumination     // Éclairé, pénombre, ombre (Sunlight::classify)
+    };
+    Q_ENUM(ColorMode)
+
+    explicit SatelliteInstancing(QQuick3DObject *parent = nullptr);
+
+    // Getters
+    BatchPropagator* catalog() const { return m_catalog; }
+    SimulationClock* clock() const { return m_clock; }
+    SatelliteCuller* culler() const { return m_culler; }
+    SatelliteCuller::Lod lod() const { return m_lod; }
+    ColorMode colorMode() const { return m_colorMode; }
+    float markerScale() const { return m_markerScale; }
+    float unitsPerKm() const { return m_unitsPerKm; }
+    int visibleCount() const { return m_visibleCount; }
+
+    // Setters
+    void setCatalog(BatchPropagator* catalog);
+    void setClock(SimulationClock* clock);
+    void setCuller(SatelliteCuller* culler);
+    void setLod(SatelliteCuller::Lod lod);
+    void setColorMode(ColorMode mode);
+    void setMarkerScale(float scale);
+    void setUnitsPerKm(float unitsPerKm);
+
+    /**
+     * @brief Catégories personnalisées (remplacent les régimes orbitaux)
+     * @param categories Une catégorie par satellite, indice dans la palette (vide = régimes)
+     */
+    void setCategories(const QVector<quint8>& categories);
+
+    /**
+     * @brief Propage le catalogue et met à jour la table d'instances
+     * @param julianDate Instant (date julienne UTC)
+     * @return false si aucun catalogue n'est défini
+     */
+    Q_INVOKABLE bool propagateTo(double julianDate);
+
+    /**
+     * @brief Met à jour la table depuis un tampon de positions existant
+     * @param positionsKm 3 × count valeurs (km, repère TEME)
+     * @param count Nombre de satellites
+     * @param status count codes SGP4Status::Code, ou nullptr (tous valides)
+     */
+    void setPositions(const float* positionsKm, int count, const quint8* status = nullptr);
+
+signals:
+    void catalogChanged();
+    void clockChanged();
+    void cullerChanged();
+    void lodChanged();
+    void colorModeChanged();
+    void markerScaleChanged();
+    void unitsPerKmChanged();
+    void visibleCountChanged();
+
+protected:
+    QByteArray getInstanceBuffer(int *instanceCount) override;
+
+private:
+    QPointer<BatchPropagator> m_catalog;
+    QPointer<SimulationClock> m_clock;
+    QPointer<SatelliteCuller> m_culler;
+    SatelliteCuller::Lod m_lod;
+    ColorMode m_colorMode;
+    float m_markerScale;
+    float m_unitsPerKm;
+
+    QVector<quint8> m_categories;   // Vide = régimes orbitaux du catalogue
+
+    // Dernier état reçu (tampon de propagation de propagateTo()), conservé
+    // pour recolorer ou redimensionner sans repropager
+    QVector<float> m_positionsKm;
+    QVector<quint8> m_status;
+    QVector<quint8> m_illumination; // Vide après setPositions() (instant inconnu)
+
+    QByteArray m_instanceData;      // InstanceTableEntry × m_visibleCount
+    int m_visibleCount;
+
+    QVector<QVector4D> m_altitudeColors;    // Table de dégradé (log de l'altitude)
+
+    void buildAltitudeColors();
+    QVector4D altitudeColor(float radiusKm) const;
+    QVector4D categoryColor(int satellite) const;
+    QVector4D instanceColor(int satellite, const float* positionKm, const quint8* illumination) const;
+    void refresh();
+    void refreshFromCuller();
+};
+
+#endif // SATELLITEINSTANCING_H
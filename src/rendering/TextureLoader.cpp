@@ -0,0 +1,225 @@
+#include "TextureLoader.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QUrl>
+#include <QElapsedTimer>
+#include <QDebug>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#elif defined(Q_OS_MACOS)
+#include <sys/sysctl.h>
+#endif
+
+// Seuils de mémoire disponible pour chaque palier
+const qint64 GIB = qint64(1024) * 1024 * 1024;
+const qint64 HIGH_TIER_MEMORY = 8 * GIB;
+const qint64 MEDIUM_TIER_MEMORY = 2 * GIB;
+
+// Lectures de fichiers en parallèle (hors thread GUI)
+const int LOADER_THREADS = 2;
+const qint64 READ_CHUNK_BYTES = 1024 * 1024;
+
+TextureLoader::TextureLoader(QObject *parent)
+    : QObject(parent)
+    , m_tier(tierForMemory(availableMemory()))
+    , m_pending(0)
+    , m_generation(0)
+{
+    m_pool.setMaxThreadCount(LOADER_THREADS);
+}
+
+TextureLoader::~TextureLoader()
+{
+    // Les lectures en cours publient vers this : attendre leur fin
+    m_pool.waitForDone();
+}
+
+void TextureLoader::setDirectory(const QString& directory)
+{
+    if (m_directory == directory)
+        return;
+
+    m_directory = directory;
+}
+
+void TextureLoader::setTier(Tier tier)
+{
+    if (m_tier == tier)
+        return;
+
+    m_tier = tier;
+    ++m_generation;
+    m_pending = 0;
+    emit tierChanged();
+
+    qDebug() << "🖼️ Palier de textures:" << tierName(m_tier);
+    for (const QString& name : std::as_const(m_names)) {
+        startLoad(name);
+    }
+    emit sourcesChanged();
+}
+
+void TextureLoader::load(const QString& name)
+{
+    if (m_names.contains(name))
+        return;
+
+    m_names.append(name);
+    startLoad(name);
+    emit sourcesChanged();
+}
+
+void TextureLoader::startLoad(const QString& name)
+{
+    ++m_pending;
+
+    const QString directory = m_directory;
+    const quint64 generation = m_generation;
+    const Tier tier = m_tier;
+
+    m_pool.start([this, directory, name, generation, tier]() {
+        LoadResult result = readTexture(directory, name, tier);
+        result.generation = generation;
+        QMetaObject::invokeMethod(this, [this, result]() { finishLoad(result); },
+                                  Qt::QueuedConnection);
+    });
+}
+
+TextureLoader::LoadResult TextureLoader::readTexture(const QString& directory, const QString& name, Tier tier)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    LoadResult result;
+    result.name = name;
+
+    // Palier demandé, puis les paliers inférieurs, puis les supérieurs
+    QVector<Tier> candidates;
+    for (int t = tier; t >= Low; --t) {
+        candidates.append(Tier(t));
+    }
+    for (int t = tier + 1; t <= High; ++t) {
+        candidates.append(Tier(t));
+    }
+
+    for (Tier candidate : candidates) {
+        const QString path = QStringLiteral("%1/%2-%3.ktx").arg(directory, name, tierName(candidate));
+        QFile file(path);
+        if (!file.exists()) {
+            continue;
+        }
+
+        if (!file.open(QIODevice::ReadOnly)) {
+            result.error = QStringLiteral("%1 : %2").arg(path, file.errorString());
+            continue;
+        }
+
+        QString error;
+        if (!KtxTexture::readInfo(&file, result.info, &error)) {
+            result.error = QStringLiteral("%1 : %2").arg(path, error);
+            continue;
+        }
+
+        // Lecture complète : le fichier est dans le cache système quand le
+        // thread de rendu le charge (envoi direct au GPU, sans décodage)
+        file.seek(0);
+        while (!file.atEnd() && !file.read(READ_CHUNK_BYTES).isEmpty()) {
+        }
+
+        result.tier = candidate;
+        result.path = QFileInfo(path).absoluteFilePath();
+        result.error.clear();
+        break;
+    }
+
+    if (result.path.isEmpty() && result.error.isEmpty()) {
+        result.error = QStringLiteral("aucun fichier %1-*.ktx dans %2").arg(name, directory);
+    }
+
+    result.elapsedMs = timer.elapsed();
+    return result;
+}
+
+void TextureLoader::finishLoad(const LoadResult& result)
+{
+    // Palier changé entre-temps : une nouvelle lecture est déjà en cours
+    if (result.generation != m_generation)
+        return;
+
+    --m_pending;
+
+    if (result.path.isEmpty()) {
+        qWarning() << "⚠️ Texture" << result.name << "non chargée (texture de remplacement conservée):"
+                   << result.error;
+        emit textureFailed(result.name, result.error);
+        emit sourcesChanged();
+        return;
+    }
+
+    m_sources.insert(result.name, QUrl::fromLocalFile(result.path));
+
+    qDebug() << "🖼️ Texture" << result.name << "prête:"
+             << result.info.width << "x" << result.info.height << ","
+             << result.info.levels << "niveaux,"
+             << QString::number(result.info.dataBytes / (1024.0 * 1024.0), 'f', 1) << "Mo GPU,"
+             << "palier" << tierName(result.tier) << "en" << result.elapsedMs << "ms";
+    emit sourcesChanged();
+}
+
+qint64 TextureLoader::availableMemory()
+{
+#if defined(Q_OS_LINUX)
+    QFile meminfo(QStringLiteral("/proc/meminfo"));
+    if (!meminfo.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return -1;
+    }
+
+    // "MemAvailable:   12345678 kB"
+    while (!meminfo.atEnd()) {
+        const QByteArray line = meminfo.readLine();
+        if (line.startsWith("MemAvailable:")) {
+            const QList<QByteArray> fields = line.simplified().split(' ');
+            bool ok = false;
+            const qint64 kib = fields.size() >= 2 ? fields.at(1).toLongLong(&ok) : 0;
+            return ok ? kib * 1024 : -1;
+        }
+    }
+    return -1;
+#elif defined(Q_OS_WIN)
+    MEMORYSTATUSEX status;
+    status.dwLength = sizeof(status);
+    return GlobalMemoryStatusEx(&status) ? qint64(status.ullAvailPhys) : -1;
+#elif defined(Q_OS_MACOS)
+    // Pas de mémoire « disponible » simple sous macOS : mémoire physique totale
+    qint64 total = 0;
+    size_t size = sizeof(total);
+    return sysctlbyname("hw.memsize", &total, &size, nullptr, 0) == 0 ? total : -1;
+#else
+    return -1;
+#endif
+}
+
+TextureLoader::Tier TextureLoader::tierForMemory(qint64 availableBytes)
+{
+    if (availableBytes < 0) {
+        return Medium;
+    }
+    if (availableBytes >= HIGH_TIER_MEMORY) {
+        return High;
+    }
+    return availableBytes >= MEDIUM_TIER_MEMORY ? Medium : Low;
+}
+
+QString TextureLoader::tierName(Tier tier)
+{
+    switch (tier) {
+    case Low:
+        return QStringLiteral("low");
+    case Medium:
+        return QStringLiteral("medium");
+    case High:
+        return QStringLiteral("high");
+    }
+    return QStringLiteral("medium");
+}
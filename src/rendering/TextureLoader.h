@@ -0,0 +1,114 @@
+#ifndef TEXTURELOADER_H
+#define TEXTURELOADER_H
+
+#include <QObject>
+#include <QStringList>
+#include <QThreadPool>
+#include <QVariantMap>
+#include "KtxTexture.h"
+
+/**
+ * @brief Chargement asynchrone des textures KTX prémipmappées
+ *
+ * Les textures sont converties hors ligne (orbifrance_texturebaker, étape
+ * de build) en KTX compressé BC1 avec toute la chaîne de mipmaps, pour
+ * trois paliers de résolution : <nom>-low.ktx (2048 px de large),
+ * <nom>-medium.ktx (4096) et <nom>-high.ktx (8192).
+ *
+ * Le palier est choisi selon la mémoire disponible (tierForMemory). La
+ * lecture et la vérification des fichiers se font dans un thread de
+ * travail ; une fois un fichier prêt, son URL est publiée dans sources
+ * et QML bascule de la texture de remplacement (qrc, quelques Ko) vers
+ * la version compressée. Aucun décodage JPEG ni génération de mipmaps
+ * n'a lieu à l'exécution.
+ *
+ * Usage QML :
+ *   source: textureLoader.sources["earth-day"] || "qrc:/res/textures/earth-day2.jpg"
+ */
+class TextureLoader : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(Tier tier READ tier WRITE setTier NOTIFY tierChanged)
+    Q_PROPERTY(QVariantMap sources READ sources NOTIFY sourcesChanged)
+    Q_PROPERTY(int pendingCount READ pendingCount NOTIFY sourcesChanged)
+
+public:
+    /**
+     * @brief Palier de résolution (largeur maximale des textures)
+     */
+    enum Tier {
+        Low = 0,    // 2048 px
+        Medium,     // 4096 px
+        High        // 8192 px
+    };
+    Q_ENUM(Tier)
+
+    explicit TextureLoader(QObject *parent = nullptr);
+    ~TextureLoader() override;
+
+    // Getters
+    QString directory() const { return m_directory; }
+    Tier tier() const { return m_tier; }
+    QVariantMap sources() const { return m_sources; }
+    int pendingCount() const { return m_pending; }
+
+    // Setters
+    void setDirectory(const QString& directory);
+
+    /**
+     * @brief Change de palier : les textures déjà demandées sont rechargées,
+     * les précédentes restent affichées jusqu'à l'arrivée des nouvelles
+     */
+    void setTier(Tier tier);
+
+    /**
+     * @brief Demande le chargement d'une texture (retour immédiat)
+     * @param name Nom de base, sans palier ni extension (ex. "earth-day")
+     */
+    Q_INVOKABLE void load(const QString& name);
+
+    /**
+     * @brief Mémoire physique disponible en octets, -1 si inconnue
+     */
+    static qint64 availableMemory();
+
+    /**
+     * @brief Palier adapté à la mémoire disponible (Medium si inconnue)
+     */
+    static Tier tierForMemory(qint64 availableBytes);
+
+    static QString tierName(Tier tier);
+
+signals:
+    void tierChanged();
+    void sourcesChanged();
+    void textureFailed(const QString& name, const QString& error);
+
+private:
+    /**
+     * @brief Résultat d'une lecture, produit dans le thread de travail
+     */
+    struct LoadResult {
+        QString name;
+        quint64 generation = 0;
+        Tier tier = Low;
+        QString path;
+        KtxTexture::Info info;
+        QString error;
+        qint64 elapsedMs = 0;
+    };
+
+    QString m_directory;
+    Tier m_tier;
+    QStringList m_names;            // Textures demandées (rechargées au changement de palier)
+    QVariantMap m_sources;          // Nom -> URL du fichier KTX prêt
+    int m_pending;
+    quint64 m_generation;           // Écarte les résultats d'un palier abandonné
+    QThreadPool m_pool;
+
+    void startLoad(const QString& name);
+    void finishLoad(const LoadResult& result);
+    static LoadResult readTexture(const QString& directory, const QString& name, Tier tier);
+};
+
+#endif // TEXTURELOADER_H
@@ -0,0 +1,183 @@
+#include "Frames.h"
+#include <QtMath>
+#include <cmath>
+
+const double JD_J2000 = 2451545.0;
+
+namespace {
+
+/**
+ * @brief Constantes de la formule de Vermeille pour WGS84
+ */
+struct Ellipsoid {
+    double e2;                  // Excentricité au carré
+    double e4;
+    double invA2;               // 1 / a²
+    double oneMinusE2OverA2;    // (1 - e²) / a²
+
+    Ellipsoid()
+        : e2(Frames::WGS84_F * (2.0 - Frames::WGS84_F))
+        , e4(e2 * e2)
+        , invA2(1.0 / (Frames::WGS84_A_KM * Frames::WGS84_A_KM))
+        , oneMinusE2OverA2((1.0 - e2) * invA2)
+    {
+    }
+};
+
+const Ellipsoid WGS84;
+
+/**
+ * @brief Rotation d'angle -θ autour de z (TEME → ECEF)
+ */
+struct EarthRotation {
+    double c;
+    double s;
+
+    explicit EarthRotation(double julianDate)
+    {
+        const double gmst = Frames::gmstRadians(julianDate);
+        c = std::cos(gmst);
+        s = std::sin(gmst);
+    }
+
+    void apply(double& x, double& y) const
+    {
+        const double ex = c * x + s * y;
+        y = -s * x + c * y;
+        x = ex;
+    }
+};
+
+/**
+ * @brief Une position ECEF (km) → latitude, longitude (degrés), altitude (km)
+ *
+ * Calcul en double quel que soit le tampon : en float, l'altitude perdrait
+ * le mètre (différence de termes voisins de 1).
+ */
+inline void geodetic(double x, double y, double z, double* out)
+{
+    const double rho2 = x * x + y * y;
+    const double p = rho2 * WGS84.invA2;
+    const double q = z * z * WGS84.oneMinusE2OverA2;
+    const double r = (p + q - WGS84.e4) / 6.0;
+    const double s = WGS84.e4 * p * q / (4.0 * r * r * r);
+    const double t = std::cbrt(1.0 + s + std::sqrt(s * (2.0 + s)));
+    const double u = r * (1.0 + t + 1.0 / t);
+    const double v = std::sqrt(u * u + WGS84.e4 * q);
+    const double w = WGS84.e2 * (u + v - q) / (2.0 * v);
+    const double k = std::sqrt(u + v + w * w) - w;
+    const double d = k * std::sqrt(rho2) / (k + WGS84.e2);
+    const double dz = std::sqrt(d * d + z * z);
+
+    out[0] = qRadiansToDegrees(2.0 * std::atan2(z, d + dz));
+    out[1] = qRadiansToDegrees(std::atan2(y, x));
+    out[2] = (k + WGS84.e2 - 1.0) / k * dz;
+}
+
+template <typename Real>
+void rotateBuffer(Real* positions, int count, const EarthRotation& rotation)
+{
+    for (int i = 0; i < count; ++i) {
+        Real* p = positions + 3 * i;
+        double x = p[0], y = p[1];
+        rotation.apply(x, y);
+        p[0] = Real(x);
+        p[1] = Real(y);
+    }
+}
+
+template <typename Real>
+void geodeticBuffer(Real* positions, int count, const EarthRotation* rotation)
+{
+    double out[3];
+    for (int i = 0; i < count; ++i) {
+        Real* p = positions + 3 * i;
+        double x = p[0], y = p[1];
+        if (rotation) {
+            rotation->apply(x, y);
+        }
+        geodetic(x, y, p[2], out);
+        p[0] = Real(out[0]);
+        p[1] = Real(out[1]);
+        p[2] = Real(out[2]);
+    }
+}
+
+} // namespace
+
+double Frames::gmstRadians(double julianDate)
+{
+    // Siècles juliens UT1 depuis J2000 (UT1 ≈ UTC à l'échelle de l'affichage)
+    const double t = (julianDate - JD_J2000) / 36525.0;
+
+    // Secondes de temps sidéral, formule de Vallado (gstime de SGP4)
+    double seconds = -6.2e-6 * t * t * t + 0.093104 * t * t
+                     + (876600.0 * 3600.0 + 8640184.812866) * t + 67310.54841;
+
+    double gmst = std::fmod(qDegreesToRadians(seconds / 240.0), 2.0 * M_PI);
+    if (gmst < 0.0) {
+        gmst += 2.0 * M_PI;
+    }
+    return gmst;
+}
+
+void Frames::temeToEcef(float* positionsKm, int count, double julianDate)
+{
+    rotateBuffer(positionsKm, count, EarthRotation(julianDate));
+}
+
+void Frames::temeToEcef(double* positionsKm, int count, double julianDate)
+{
+    rotateBuffer(positionsKm, count, EarthRotation(julianDate));
+}
+
+void Frames::ecefToGeodetic(float* positions, int count)
+{
+    geodeticBuffer(positions, count, nullptr);
+}
+
+void Frames::ecefToGeodetic(double* positions, int count)
+{
+    geodeticBuffer(positions, count, nullptr);
+}
+
+void Frames::temeToGeodetic(float* positions, int count, double julianDate)
+{
+    const EarthRotation rotation(julianDate);
+    geodeticBuffer(positions, count, &rotation);
+}
+
+void Frames::temeToGeodetic(double* positions, int count, double julianDate)
+{
+    const EarthRotation rotation(julianDate);
+    geodeticBuffer(positions, count, &rotation);
+}
+
+void Frames::geodeticToEcef(double latitudeDeg, double longitudeDeg, double altitudeKm, double* ecefKm)
+{
+    const double lat = qDegreesToRadians(latitudeDeg);
+    const double lon = qDegreesToRadians(longitudeDeg);
+    const double sinLat = std::sin(lat), cosLat = std::cos(lat);
+
+    const double n = WGS84_A_KM / std::sqrt(1.0 - WGS84.e2 * sinLat * sinLat);
+    ecefKm[0] = (n + altitudeKm) * cosLat * std::cos(lon);
+    ecefKm[1] = (n + altitudeKm) * cosLat * std::sin(lon);
+    ecefKm[2] = (n * (1.0 - WGS84.e2) + altitudeKm) * sinLat;
+}
+
+void Frames::temeToScene(float* positions, int count, float unitsPerKm)
+{
+    // Rotation de -90° autour de x (temeFrame) : (x, y, z) → (x, z, -y)
+    for (int i = 0; i < count; ++i) {
+        float* p = positions + 3 * i;
+        const float y = p[1];
+        p[0] = p[0] * unitsPerKm;
+        p[1] = p[2] * unitsPerKm;
+        p[2] = -y * unitsPerKm;
+    }
+}
+
+QVector3D Frames::temeToScene(const QVector3D& temeKm, float unitsPerKm)
+{
+    return QVector3D(temeKm.x(), temeKm.z(), -temeKm.y()) * unitsPerKm;
+}
@@ -0,0 +1,76 @@
+#ifndef FRAMES_H
+#define FRAMES_H
+
+#include <QVector3D>
+
+/**
+ * @brief Changements de repère par lots : TEME → ECEF → géodésique, TEME → scène
+ *
+ * Les tampons sont ceux de BatchPropagator (x, y, z puis satellite
+ * suivant, km) et sont transformés en place, en un seul passage : le temps
+ * sidéral est évalué une fois par appel (un instant commun), pas par
+ * satellite.
+ *
+ * TEME → ECEF : rotation du temps sidéral moyen de Greenwich (IAU 1982,
+ * comme SGP4), sans mouvement du pôle. ECEF → géodésique : formule fermée
+ * de Vermeille (2011) sur l'ellipsoïde WGS84, exacte hors du voisinage du
+ * centre de la Terre, sans itération ni branchement.
+ *
+ * Scène : l'axe des pôles (z TEME) est le y de la scène, comme dans le
+ * nœud temeFrame de main.qml ; la Terre de la scène (#Sphere de rayon 50,
+ * échelle 3) mesure 150 unités pour 6371 km.
+ */
+namespace Frames {
+
+// Ellipsoïde WGS84
+const double WGS84_A_KM = 6378.137;
+const double WGS84_F = 1.0 / 298.257223563;
+
+// Échelle de la scène (unités Qt Quick 3D par km)
+// Terre de main.qml : #Sphere (rayon 50 unités) × 3 = 150 unités pour 6371 km
+const double SCENE_UNITS_PER_KM = 150.0 / 6371.0;
+
+/**
+ * @brief Temps sidéral moyen de Greenwich (IAU 1982, comme SGP4)
+ * @param julianDate Date julienne UTC
+ * @return Angle en radians, dans [0, 2π[
+ */
+double gmstRadians(double julianDate);
+
+/**
+ * @brief TEME → ECEF en place (km)
+ * @param positionsKm 3 × count valeurs
+ * @param julianDate Instant commun des positions (date julienne UTC)
+ */
+void temeToEcef(float* positionsKm, int count, double julianDate);
+void temeToEcef(double* positionsKm, int count, double julianDate);
+
+/**
+ * @brief ECEF → géodésique en place
+ * @param positions 3 × count valeurs : x, y, z (km) en entrée ; latitude
+ *        (degrés, [-90, 90]), longitude (degrés, ]-180, 180]), altitude
+ *        au-dessus de l'ellipsoïde (km) en sortie
+ */
+void ecefToGeodetic(float* positions, int count);
+void ecefToGeodetic(double* positions, int count);
+
+/**
+ * @brief TEME → géodésique en place, rotation et conversion en un passage
+ */
+void temeToGeodetic(float* positions, int count, double julianDate);
+void temeToGeodetic(double* positions, int count, double julianDate);
+
+/**
+ * @brief Géodésique → ECEF (stations sol)
+ * @param ecefKm [out] 3 valeurs (km)
+ */
+void geodeticToEcef(double latitudeDeg, double longitudeDeg, double altitudeKm, double* ecefKm);
+
+/**
+ * @brief TEME (km) → coordonnées de la racine de la scène, en place
+ */
+void temeToScene(float* positions, int count, float unitsPerKm = float(SCENE_UNITS_PER_KM));
+QVector3D temeToScene(const QVector3D& temeKm, float unitsPerKm = float(SCENE_UNITS_PER_KM));
+}
+
+#endif // FRAMES_H
@@ -0,0 +1,141 @@
+#include "SimulationClock.h"
+#include "Frames.h"
+#include "Sunlight.h"
+#include <QQuickWindow>
+#include <QDebug>
+#include <QtMath>
+#include <cmath>
+
+// Date julienne de J2000, instant de départ par défaut
+const double JD_J2000 = 2451545.0;
+
+// Au-delà, l'intervalle entre deux images est un gel (fenêtre masquée,
+// débogueur) : le temps simulé ne saute pas
+const double MAX_FRAME_SECONDS = 0.25;
+
+SimulationClock::SimulationClock(QObject *parent)
+    : QObject(parent)
+    , m_lastWallNs(0)
+    , m_startJulian(JD_J2000)
+    , m_seconds(0.0)
+    , m_running(false)
+    , m_timeScale(MIN_TIME_SCALE)
+    , m_dirty(true)
+    , m_frameCount(0)
+{
+    m_wallClock.start();
+}
+
+void SimulationClock::attachToWindow(QQuickWindow* window)
+{
+    if (m_window) {
+        disconnect(m_window, nullptr, this, nullptr);
+    }
+
+    m_window = window;
+    if (!m_window) {
+        return;
+    }
+
+    // Thread GUI, avant la synchronisation : les données poussées ici sont
+    // prises en compte dans l'image en cours
+    connect(m_window, &QQuickWindow::afterAnimating, this, &SimulationClock::advanceFrame,
+            Qt::DirectConnection);
+
+    qDebug() << "⏱️ SimulationClock cadencée sur la fenêtre" << m_window->title();
+    requestFrame();
+}
+
+void SimulationClock::setStartJulian(double julianDate)
+{
+    if (qFuzzyCompare(m_startJulian, julianDate))
+        return;
+
+    m_startJulian = julianDate;
+    m_dirty = true;
+    requestFrame();
+}
+
+void SimulationClock::setSimulationSeconds(double seconds)
+{
+    if (qFuzzyCompare(m_seconds, seconds))
+        return;
+
+    // Publié à la prochaine image, avec le reste du lot
+    m_seconds = seconds;
+    m_dirty = true;
+    requestFrame();
+}
+
+void SimulationClock::setRunning(bool running)
+{
+    if (m_running == running)
+        return;
+
+    m_running = running;
+    m_lastWallNs = m_wallClock.nsecsElapsed();
+    emit runningChanged();
+    requestFrame();
+}
+
+void SimulationClock::setTimeScale(double scale)
+{
+    scale = qBound(MIN_TIME_SCALE, scale, MAX_TIME_SCALE);
+    if (qFuzzyCompare(m_timeScale, scale))
+        return;
+
+    m_timeScale = scale;
+    emit timeScaleChanged();
+}
+
+void SimulationClock::step(double seconds)
+{
+    setRunning(false);
+    setSimulationSeconds(m_seconds + seconds);
+}
+
+double SimulationClock::gmstDegrees() const
+{
+    return qRadiansToDegrees(Frames::gmstRadians(julianDate()));
+}
+
+QVector3D SimulationClock::sunDirection() const
+{
+    return Sunlight::sunDirection(julianDate());
+}
+
+QQuaternion SimulationClock::sunRotation() const
+{
+    return QQuaternion::rotationTo(QVector3D(0.0f, 0.0f, 1.0f), sunDirection());
+}
+
+void SimulationClock::advanceFrame()
+{
+    const qint64 now = m_wallClock.nsecsElapsed();
+    if (m_running) {
+        const double wallSeconds = qMin((now - m_lastWallNs) * 1e-9, MAX_FRAME_SECONDS);
+        m_seconds += wallSeconds * m_timeScale;
+        m_dirty = true;
+    }
+    m_lastWallNs = now;
+
+    if (!m_dirty) {
+        return;
+    }
+
+    m_dirty = false;
+    ++m_frameCount;
+    emit frameAdvanced(julianDate());
+
+    // En lecture, l'image suivante est demandée tout de suite
+    if (m_running) {
+        requestFrame();
+    }
+}
+
+void SimulationClock::requestFrame()
+{
+    if (m_window) {
+        m_window->update();
+    }
+}
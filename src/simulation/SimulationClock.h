@@ -0,0 +1,126 @@
+#ifndef SIMULATIONCLOCK_H
+#define SIMULATIONCLOCK_H
+
+#include <QObject>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QVector3D>
+#include <QQuaternion>
+
+class QQuickWindow;
+
+/**
+ * @brief Horloge de simulation cadencée par les images de la fenêtre
+ *
+ * L'horloge avance une seule fois par image, dans le thread GUI, juste
+ * avant la synchronisation de la scène (QQuickWindow::afterAnimating).
+ * Elle publie alors un unique frameAdvanced() : les consommateurs C++
+ * (catalogue instancié, traces, satellite de démonstration) calculent
+ * toutes leurs positions en un lot et poussent le résultat vers QML,
+ * sans appel Q_INVOKABLE par satellite ni par liaison.
+ *
+ * En lecture, le temps simulé avance du temps réel écoulé multiplié par
+ * le facteur d'accélération timeScale (1× à 10⁵×). Hors lecture, aucune
+ * image n'est demandée : seul un déplacement du curseur
+ * (setSimulationSeconds) ou un pas (step) déclenche une publication.
+ *
+ * La rotation de la Terre suit le temps sidéral de Greenwich (gmstDegrees)
+ * de la même horloge, l'éclairage de la scène la direction du Soleil
+ * (sunDirection, sunRotation) : le terminateur jour/nuit est à sa place.
+ */
+class SimulationClock : public QObject
+{
+    Q_OBJECT
+
+    // Propriétés exposées à QML (une seule notification par image)
+    Q_PROPERTY(double julianDate READ julianDate NOTIFY frameAdvanced)
+    Q_PROPERTY(double simulationSeconds READ simulationSeconds WRITE setSimulationSeconds NOTIFY frameAdvanced)
+    Q_PROPERTY(double gmstDegrees READ gmstDegrees NOTIFY frameAdvanced)
+    Q_PROPERTY(QVector3D sunDirection READ sunDirection NOTIFY frameAdvanced)
+    Q_PROPERTY(QQuaternion sunRotation READ sunRotation NOTIFY frameAdvanced)
+    Q_PROPERTY(bool running READ isRunning WRITE setRunning NOTIFY runningChanged)
+    Q_PROPERTY(double timeScale READ timeScale WRITE setTimeScale NOTIFY timeScaleChanged)
+    Q_PROPERTY(qint64 frameCount READ frameCount NOTIFY frameAdvanced)
+
+public:
+    /**
+     * @brief Bornes du facteur d'accélération
+     */
+    static constexpr double MIN_TIME_SCALE = 1.0;
+    static constexpr double MAX_TIME_SCALE = 1.0e5;
+
+    explicit SimulationClock(QObject *parent = nullptr);
+
+    /**
+     * @brief Cadence l'horloge sur les images d'une fenêtre
+     */
+    void attachToWindow(QQuickWindow* window);
+
+    /**
+     * @brief Instant de départ (simulationSeconds = 0), date julienne UTC
+     */
+    void setStartJulian(double julianDate);
+    double startJulian() const { return m_startJulian; }
+
+    // Getters
+    double julianDate() const { return m_startJulian + m_seconds / 86400.0; }
+    double simulationSeconds() const { return m_seconds; }
+    double gmstDegrees() const;
+    bool isRunning() const { return m_running; }
+    double timeScale() const { return m_timeScale; }
+    qint64 frameCount() const { return m_frameCount; }
+
+    /**
+     * @brief Direction du Soleil (vecteur unitaire, repère TEME)
+     */
+    QVector3D sunDirection() const;
+
+    /**
+     * @brief Orientation d'une DirectionalLight placée dans le repère TEME
+     * (axe +z local vers le Soleil : la lumière suit -z)
+     */
+    QQuaternion sunRotation() const;
+
+    // Setters
+    void setSimulationSeconds(double seconds);
+    void setRunning(bool running);
+    void setTimeScale(double scale);
+
+    /**
+     * @brief Met en pause et avance le temps simulé d'un pas
+     * @param seconds Pas en secondes (négatif pour reculer)
+     */
+    Q_INVOKABLE void step(double seconds);
+
+    /**
+     * @brief Avance d'une image et publie le nouvel instant s'il a changé
+     *
+     * Appelé automatiquement par la fenêtre attachée ; utilisable
+     * directement sans fenêtre (mesures, tests).
+     */
+    void advanceFrame();
+
+signals:
+    /**
+     * @brief Nouvel instant publié (une fois par image au plus)
+     */
+    void frameAdvanced(double julianDate);
+    void runningChanged();
+    void timeScaleChanged();
+
+private:
+    QPointer<QQuickWindow> m_window;
+    QElapsedTimer m_wallClock;
+    qint64 m_lastWallNs;
+
+    double m_startJulian;
+    double m_seconds;               // Temps de simulation depuis m_startJulian
+    bool m_running;
+    double m_timeScale;
+    bool m_dirty;                   // Instant à publier à la prochaine image
+    qint64 m_frameCount;
+
+    void requestFrame();
+};
+
+#endif // SIMULATIONCLOCK_H
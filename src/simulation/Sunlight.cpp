@@ -0,0 +1,151 @@
+#include "Sunlight.h"
+#include <QtMath>
+#include <cmath>
+
+const double JD_J2000 = 2451545.0;
+const double AU_KM = 149597870.7;
+
+// Rayons de l'ombre : Terre équatoriale (WGS84) et photosphère
+const double EARTH_RADIUS_KM = 6378.137;
+const double SUN_RADIUS_KM = 696000.0;
+
+const char* Illumination::name(Code code)
+{
+    switch (code) {
+    case Sunlit:
+        return "éclairé";
+    case Penumbra:
+        return "pénombre";
+    case Umbra:
+        return "ombre";
+    }
+    return "inconnu";
+}
+
+namespace {
+
+/**
+ * @brief Paramètres d'un cône d'ombre pour une position du Soleil
+ *
+ * À la distance p derrière la Terre (le long de l'axe anti-solaire), le
+ * rayon de l'ombre vaut R - p·tanUmbra et celui de la pénombre
+ * R + p·tanPenumbra (demi-angles des cônes tangents, petits angles).
+ */
+struct ShadowCone {
+    double axis[3];             // Direction du Soleil (unitaire)
+    double tanUmbra;
+    double tanPenumbra;
+
+    ShadowCone(const double* sunKm, Sunlight::ShadowModel model)
+    {
+        const double distance = std::sqrt(sunKm[0] * sunKm[0] + sunKm[1] * sunKm[1] + sunKm[2] * sunKm[2]);
+        for (int k = 0; k < 3; ++k) {
+            axis[k] = sunKm[k] / distance;
+        }
+        if (model == Sunlight::Cylindrical) {
+            tanUmbra = 0.0;
+            tanPenumbra = 0.0;
+        } else {
+            tanUmbra = (SUN_RADIUS_KM - EARTH_RADIUS_KM) / distance;
+            tanPenumbra = (SUN_RADIUS_KM + EARTH_RADIUS_KM) / distance;
+        }
+    }
+};
+
+/**
+ * @brief Boucle commune aux tampons float et double
+ *
+ * Comparaisons combinées en entiers : aucun branchement par satellite, la
+ * boucle est vectorisée par le compilateur.
+ */
+template <typename Real>
+void classifyBuffer(const Real* positionsKm, int count, const ShadowCone& cone, quint8* illumination)
+{
+    const Real sx = Real(cone.axis[0]);
+    const Real sy = Real(cone.axis[1]);
+    const Real sz = Real(cone.axis[2]);
+    const Real radius = Real(EARTH_RADIUS_KM);
+    const Real tanUmbra = Real(cone.tanUmbra);
+    const Real tanPenumbra = Real(cone.tanPenumbra);
+
+    for (int i = 0; i < count; ++i) {
+        const Real x = positionsKm[3 * i];
+        const Real y = positionsKm[3 * i + 1];
+        const Real z = positionsKm[3 * i + 2];
+
+        // Distance derrière la Terre et carré de la distance à l'axe
+        const Real behind = -(x * sx + y * sy + z * sz);
+        const Real axial2 = x * x + y * y + z * z - behind * behind;
+
+        const Real umbraRadius = radius - behind * tanUmbra;
+        const Real penumbraRadius = radius + behind * tanPenumbra;
+
+        const int inPenumbra = int(behind > Real(0)) & int(axial2 < penumbraRadius * penumbraRadius);
+        const int inUmbra = inPenumbra & int(umbraRadius > Real(0)) & int(axial2 < umbraRadius * umbraRadius);
+        illumination[i] = quint8(inPenumbra + inUmbra);
+    }
+}
+
+} // namespace
+
+void Sunlight::sunPositionKm(double julianDate, double* positionKm)
+{
+    // Siècles juliens depuis J2000 (UT1 ≈ UTC à cette précision)
+    const double t = (julianDate - JD_J2000) / 36525.0;
+
+    const double meanLongitude = 280.460 + 36000.771 * t;
+    const double meanAnomaly = qDegreesToRadians(357.5291092 + 35999.05034 * t);
+    const double longitude = qDegreesToRadians(meanLongitude + 1.914666471 * std::sin(meanAnomaly)
+                                               + 0.019994643 * std::sin(2.0 * meanAnomaly));
+    const double obliquity = qDegreesToRadians(23.439291 - 0.0130042 * t);
+    const double distance = (1.000140612 - 0.016708617 * std::cos(meanAnomaly)
+                             - 0.000139589 * std::cos(2.0 * meanAnomaly)) * AU_KM;
+
+    positionKm[0] = distance * std::cos(longitude);
+    positionKm[1] = distance * std::cos(obliquity) * std::sin(longitude);
+    positionKm[2] = distance * std::sin(obliquity) * std::sin(longitude);
+}
+
+QVector3D Sunlight::sunDirection(double julianDate)
+{
+    double sun[3];
+    sunPositionKm(julianDate, sun);
+    return QVector3D(float(sun[0]), float(sun[1]), float(sun[2])).normalized();
+}
+
+void Sunlight::classify(const float* positionsKm, int count, const double* sunKm, quint8* illumination,
+                        ShadowModel model)
+{
+    classifyBuffer(positionsKm, count, ShadowCone(sunKm, model), illumination);
+}
+
+void Sunlight::classify(const double* positionsKm, int count, const double* sunKm, quint8* illumination,
+                        ShadowModel model)
+{
+    classifyBuffer(positionsKm, count, ShadowCone(sunKm, model), illumination);
+}
+
+double Sunlight::penumbraMarginKm(const double* positionKm, const double* sunKm, double* umbraMarginKm)
+{
+    const ShadowCone cone(sunKm, Conical);
+    const double x = positionKm[0], y = positionKm[1], z = positionKm[2];
+    const double r = std::sqrt(x * x + y * y + z * z);
+    const double behind = -(x * cone.axis[0] + y * cone.axis[1] + z * cone.axis[2]);
+
+    // Côté jour : altitude plus distance au plan du terminateur, égale aux
+    // marges des cônes en behind = 0 et croissante vers le Soleil (un seul
+    // minimum par orbite, du côté nuit)
+    if (behind <= 0.0) {
+        const double margin = r - EARTH_RADIUS_KM - behind;
+        if (umbraMarginKm) {
+            *umbraMarginKm = margin;
+        }
+        return margin;
+    }
+
+    const double axial = std::sqrt(qMax(0.0, r * r - behind * behind));
+    if (umbraMarginKm) {
+        *umbraMarginKm = axial - (EARTH_RADIUS_KM - behind * cone.tanUmbra);
+    }
+    return axial - (EARTH_RADIUS_KM + behind * cone.tanPenumbra);
+}
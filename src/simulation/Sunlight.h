@@ -0,0 +1,84 @@
+#ifndef SUNLIGHT_H
+#define SUNLIGHT_H
+
+#include <QVector3D>
+#include <QtGlobal>
+
+/**
+ * @brief État d'éclairement d'un satellite (un octet par satellite)
+ */
+namespace Illumination {
+enum Code : quint8 {
+    Sunlit = 0,         // Soleil entièrement visible
+    Penumbra,           // Soleil partiellement masqué par la Terre
+    Umbra               // Soleil entièrement masqué
+};
+
+const int CodeCount = Umbra + 1;
+
+/**
+ * @brief Nom lisible d'un code (journaux, interface)
+ */
+const char* name(Code code);
+}
+
+/**
+ * @brief Éphéméride solaire basse précision et test d'ombre par lots
+ *
+ * Position du Soleil : série de l'Astronomical Almanac (longitude
+ * écliptique et distance en fonction de l'anomalie moyenne), précise à
+ * 0,01° près de 1950 à 2050. Elle est exprimée dans le repère équatorial
+ * moyen de la date, confondu avec TEME à cette précision.
+ *
+ * Ombre de la Terre : cônes d'ombre et de pénombre tangents à la Terre
+ * (sphère de rayon équatorial) et au Soleil, ou cylindre de la Terre.
+ * Sans réfraction ni aplatissement : l'entrée dans l'ombre est décalée de
+ * quelques secondes en LEO.
+ */
+namespace Sunlight {
+
+/**
+ * @brief Modèle de l'ombre de la Terre
+ */
+enum ShadowModel {
+    Conical = 0,        // Ombre et pénombre (cônes tangents)
+    Cylindrical         // Ombre cylindrique, sans pénombre
+};
+
+/**
+ * @brief Position géocentrique du Soleil
+ * @param julianDate Date julienne UTC
+ * @param positionKm [out] 3 valeurs (km, repère TEME)
+ */
+void sunPositionKm(double julianDate, double* positionKm);
+
+/**
+ * @brief Direction géocentrique du Soleil (vecteur unitaire, repère TEME)
+ */
+QVector3D sunDirection(double julianDate);
+
+/**
+ * @brief Classe un tampon de positions (un passage, sans branche)
+ * @param positionsKm 3 × count valeurs (km, repère TEME), comme BatchPropagator
+ * @param count Nombre de satellites
+ * @param sunKm Position du Soleil (sunPositionKm)
+ * @param illumination [out] count codes Illumination::Code
+ */
+void classify(const float* positionsKm, int count, const double* sunKm, quint8* illumination,
+              ShadowModel model = Conical);
+void classify(const double* positionsKm, int count, const double* sunKm, quint8* illumination,
+              ShadowModel model = Conical);
+
+/**
+ * @brief Marges d'ombre et de pénombre d'une position, continues dans le temps
+ *
+ * Distance (km) de l'objet à la surface du cône, négative à l'intérieur ;
+ * du côté jour, altitude plus distance au plan du terminateur (un seul
+ * minimum par orbite). Zéros = entrée et sortie d'éclipse (recherche de
+ * racines).
+ * @param umbraMarginKm [out] Marge d'ombre, ou nullptr
+ */
+double penumbraMarginKm(const double* positionKm, const double* sunKm, double* umbraMarginKm = nullptr);
+}
+
+#endif // SUNLIGHT_H
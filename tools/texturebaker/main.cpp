@@ -0,0 +1,212 @@
+#include <QCoreApplication>
+#include <QImage>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QDebug>
+#include <climits>
+#include <cstring>
+#include <utility>
+
+#include "rendering/KtxTexture.h"
+
+/**
+ * @brief Conversion hors ligne d'une texture en KTX compressé prémipmappé
+ *
+ * Usage : orbifrance_texturebaker <source> <destination.ktx> <largeur max>
+ *
+ * L'image est réduite à la largeur maximale (rapport conservé), puis chaque
+ * niveau de mipmap est obtenu en réduisant le précédent de moitié jusqu'à
+ * 1×1 et compressé en BC1 (DXT1, 4 bits par pixel : 8 fois moins que RGBA8).
+ * Appelé par CMake pour chaque palier de résolution (voir TextureLoader).
+ */
+
+namespace {
+
+inline quint16 toRgb565(const int rgb[3])
+{
+    return quint16(((rgb[0] * 31 + 127) / 255) << 11
+                   | ((rgb[1] * 63 + 127) / 255) << 5
+                   | ((rgb[2] * 31 + 127) / 255));
+}
+
+inline void fromRgb565(quint16 c, int rgb[3])
+{
+    const int r = (c >> 11) & 31;
+    const int g = (c >> 5) & 63;
+    const int b = c & 31;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+/**
+ * @brief Compresse un bloc 4×4 (ajustement sur l'axe de la boîte englobante)
+ * @param pixels 16 pixels RGB
+ * @param out 8 octets : deux couleurs RGB565 puis 16 indices de 2 bits
+ */
+void encodeBlock(const int pixels[16][3], uchar out[8])
+{
+    // Axe principal approché : diagonale de la boîte englobante des couleurs
+    int lo[3] = { 255, 255, 255 };
+    int hi[3] = { 0, 0, 0 };
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            lo[c] = qMin(lo[c], pixels[i][c]);
+            hi[c] = qMax(hi[c], pixels[i][c]);
+        }
+    }
+    const int axis[3] = { hi[0] - lo[0], hi[1] - lo[1], hi[2] - lo[2] };
+
+    // Extrémités : pixels de projection minimale et maximale sur l'axe
+    int minIndex = 0, maxIndex = 0;
+    int minDot = INT_MAX, maxDot = INT_MIN;
+    for (int i = 0; i < 16; ++i) {
+        const int dot = pixels[i][0] * axis[0] + pixels[i][1] * axis[1] + pixels[i][2] * axis[2];
+        if (dot < minDot) { minDot = dot; minIndex = i; }
+        if (dot > maxDot) { maxDot = dot; maxIndex = i; }
+    }
+
+    quint16 c0 = toRgb565(pixels[maxIndex]);
+    quint16 c1 = toRgb565(pixels[minIndex]);
+
+    // Mode 4 couleurs : c0 > c1 obligatoire
+    if (c0 < c1) {
+        std::swap(c0, c1);
+    }
+
+    int palette[4][3];
+    fromRgb565(c0, palette[0]);
+    fromRgb565(c1, palette[1]);
+    for (int c = 0; c < 3; ++c) {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    quint32 indices = 0;
+    if (c0 != c1) {
+        for (int i = 0; i < 16; ++i) {
+            int best = 0;
+            int bestDistance = INT_MAX;
+            for (int p = 0; p < 4; ++p) {
+                const int dr = pixels[i][0] - palette[p][0];
+                const int dg = pixels[i][1] - palette[p][1];
+                const int db = pixels[i][2] - palette[p][2];
+                const int distance = dr * dr + dg * dg + db * db;
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = p;
+                }
+            }
+            indices |= quint32(best) << (2 * i);
+        }
+    }
+
+    out[0] = uchar(c0 & 0xFF);
+    out[1] = uchar(c0 >> 8);
+    out[2] = uchar(c1 & 0xFF);
+    out[3] = uchar(c1 >> 8);
+    out[4] = uchar(indices & 0xFF);
+    out[5] = uchar((indices >> 8) & 0xFF);
+    out[6] = uchar((indices >> 16) & 0xFF);
+    out[7] = uchar(indices >> 24);
+}
+
+/**
+ * @brief Compresse un niveau complet en BC1 (bords répétés pour les blocs partiels)
+ */
+QByteArray encodeBC1(const QImage& image)
+{
+    const int width = image.width();
+    const int height = image.height();
+    const int blocksX = (width + 3) / 4;
+    const int blocksY = (height + 3) / 4;
+
+    QByteArray data(blocksX * blocksY * 8, Qt::Uninitialized);
+    uchar* out = reinterpret_cast<uchar*>(data.data());
+
+    int pixels[16][3];
+    for (int by = 0; by < blocksY; ++by) {
+        for (int bx = 0; bx < blocksX; ++bx) {
+            for (int y = 0; y < 4; ++y) {
+                const QRgb* line = reinterpret_cast<const QRgb*>(image.constScanLine(qMin(4 * by + y, height - 1)));
+                for (int x = 0; x < 4; ++x) {
+                    const QRgb rgb = line[qMin(4 * bx + x, width - 1)];
+                    pixels[4 * y + x][0] = qRed(rgb);
+                    pixels[4 * y + x][1] = qGreen(rgb);
+                    pixels[4 * y + x][2] = qBlue(rgb);
+                }
+            }
+            encodeBlock(pixels, out);
+            out += 8;
+        }
+    }
+
+    return data;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    const QStringList args = app.arguments();
+
+    if (args.size() != 4) {
+        qCritical() << "Usage: orbifrance_texturebaker <source> <destination.ktx> <largeur max>";
+        return 1;
+    }
+
+    const QString sourcePath = args.at(1);
+    const QString destinationPath = args.at(2);
+    bool ok = false;
+    const int maxWidth = args.at(3).toInt(&ok);
+    if (!ok || maxWidth < 1) {
+        qCritical() << "❌ Largeur maximale invalide:" << args.at(3);
+        return 1;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QImage image(sourcePath);
+    if (image.isNull()) {
+        qCritical() << "❌ Image illisible:" << sourcePath;
+        return 1;
+    }
+
+    image = image.convertToFormat(QImage::Format_RGB32);
+    if (image.width() > maxWidth) {
+        image = image.scaledToWidth(maxWidth, Qt::SmoothTransformation);
+    }
+
+    // === Chaîne de mipmaps complète, jusqu'à 1×1 ===
+    QVector<QByteArray> levels;
+    QImage level = image;
+    while (true) {
+        levels.append(encodeBC1(level));
+        if (level.width() == 1 && level.height() == 1) {
+            break;
+        }
+        level = level.scaled(qMax(1, level.width() / 2), qMax(1, level.height() / 2),
+                             Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    }
+
+    QDir().mkpath(QFileInfo(destinationPath).absolutePath());
+
+    QSaveFile file(destinationPath);
+    if (!file.open(QIODevice::WriteOnly)
+        || !KtxTexture::write(&file, KtxTexture::GL_COMPRESSED_RGB_S3TC_DXT1, KtxTexture::GL_RGB,
+                              image.width(), image.height(), levels)
+        || !file.commit()) {
+        qCritical() << "❌ Écriture impossible:" << destinationPath;
+        return 1;
+    }
+
+    qDebug() << "🗜️" << QFileInfo(destinationPath).fileName() << ":"
+             << image.width() << "x" << image.height() << "," << levels.size() << "niveaux,"
+             << QString::number(QFileInfo(destinationPath).size() / (1024.0 * 1024.0), 'f', 2) << "Mo en"
+             << timer.elapsed() << "ms";
+    return 0;
+}